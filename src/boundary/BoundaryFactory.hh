@@ -18,7 +18,7 @@ namespace detran
 {
 
 /// Class for constructing boundaries and boundary conditions
-template <typename D, template <typename D> class B>
+template <typename D, template <typename> class B>
 class BoundaryFactory
 {
 public:
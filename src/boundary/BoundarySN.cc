@@ -24,8 +24,8 @@ BoundarySN<D>::BoundarySN(SP_input        input,
                           SP_quadrature   quadrature)
   : Base(input, mesh)
   , d_quadrature(quadrature)
-  , d_boundary_flux(2*D::dimension, // number of sides
-                    vec2_boundary_flux(d_number_groups))
+  , d_side_offset(2*D::dimension, 0)
+  , d_side_shape(2*D::dimension, detran_utilities::vec_size_t(2, 1))
   , d_bc(2*D::dimension)
 {
   Require(d_quadrature);
@@ -126,81 +126,49 @@ void BoundarySN<D>::display(bool inout) const
 template <class D>
 void BoundarySN<D>::initialize()
 {
-  THROW("NOT IMPLEMENTED");
-}
-
-//---------------------------------------------------------------------------//
-template <>
-void BoundarySN<_3D>::initialize()
-{
+  // Shape of each side, given as rows by columns.
   size_t nx = d_mesh->number_cells_x();
   size_t ny = d_mesh->number_cells_y();
   size_t nz = d_mesh->number_cells_z();
-  size_t na = d_quadrature->number_angles();
-  for (size_t g = 0; g < d_number_groups; ++g)
+  if (D::dimension == 2)
   {
-    for (size_t a = 0; a < d_quadrature->number_angles(); ++a)
-    {
-      // yz planes
-      d_boundary_flux[Mesh::WEST][g].resize(na, bf_type(nz, vec_dbl(ny, 0.0)));
-      d_boundary_flux[Mesh::EAST][g].resize(na, bf_type(nz, vec_dbl(ny, 0.0)));
-      // zx planes
-      d_boundary_flux[Mesh::SOUTH][g].resize(na, bf_type(nz, vec_dbl(nx, 0.0)));
-      d_boundary_flux[Mesh::NORTH][g].resize(na, bf_type(nz, vec_dbl(nx, 0.0)));
-      // xy planes
-      d_boundary_flux[Mesh::BOTTOM][g].resize(na, bf_type(ny, vec_dbl(nx, 0.0)));
-      d_boundary_flux[Mesh::TOP][g].resize(na, bf_type(ny, vec_dbl(nx, 0.0)));
-    }
+    // vertical sides
+    d_side_shape[Mesh::WEST][0]   = ny;
+    d_side_shape[Mesh::EAST][0]   = ny;
+    // horizontal sides
+    d_side_shape[Mesh::SOUTH][0]  = nx;
+    d_side_shape[Mesh::NORTH][0]  = nx;
   }
-  d_boundary_flux_size[Mesh::WEST]   = na * nz * ny;
-  d_boundary_flux_size[Mesh::EAST]   = na * nz * ny;
-  d_boundary_flux_size[Mesh::SOUTH]  = na * nz * nx;
-  d_boundary_flux_size[Mesh::NORTH]  = na * nz * nx;
-  d_boundary_flux_size[Mesh::BOTTOM] = na * ny * nx;
-  d_boundary_flux_size[Mesh::TOP]    = na * ny * nx;
-}
-
-//---------------------------------------------------------------------------//
-template <>
-void BoundarySN<_2D>::initialize()
-{
-  size_t nx = d_mesh->number_cells_x();
-  size_t ny = d_mesh->number_cells_y();
-  size_t na = d_quadrature->number_angles();
-  for (size_t g = 0; g < d_number_groups; ++g)
+  else if (D::dimension == 3)
   {
-    for (size_t a = 0; a < d_quadrature->number_angles(); ++a)
-    {
-      // vertical sides
-      d_boundary_flux[Mesh::WEST][g].resize(na, bf_type(ny, 0.0));
-      d_boundary_flux[Mesh::EAST][g].resize(na, bf_type(ny, 0.0));
-      // horizontal sides
-      d_boundary_flux[Mesh::SOUTH][g].resize(na, bf_type(nx, 0.0));
-      d_boundary_flux[Mesh::NORTH][g].resize(na, bf_type(nx, 0.0));
-    }
+    // yz planes
+    d_side_shape[Mesh::WEST][0]   = nz;
+    d_side_shape[Mesh::WEST][1]   = ny;
+    d_side_shape[Mesh::EAST][0]   = nz;
+    d_side_shape[Mesh::EAST][1]   = ny;
+    // zx planes
+    d_side_shape[Mesh::SOUTH][0]  = nz;
+    d_side_shape[Mesh::SOUTH][1]  = nx;
+    d_side_shape[Mesh::NORTH][0]  = nz;
+    d_side_shape[Mesh::NORTH][1]  = nx;
+    // xy planes
+    d_side_shape[Mesh::BOTTOM][0] = ny;
+    d_side_shape[Mesh::BOTTOM][1] = nx;
+    d_side_shape[Mesh::TOP][0]    = ny;
+    d_side_shape[Mesh::TOP][1]    = nx;
   }
-  d_boundary_flux_size[Mesh::WEST]  = na * ny;
-  d_boundary_flux_size[Mesh::EAST]  = na * ny;
-  d_boundary_flux_size[Mesh::SOUTH] = na * nx;
-  d_boundary_flux_size[Mesh::NORTH] = na * nx;
-}
 
-//---------------------------------------------------------------------------//
-template <>
-void BoundarySN<_1D>::initialize()
-{
+  // Lay the sides out one after another.
   size_t na = d_quadrature->number_angles();
-  for (size_t g = 0; g < d_number_groups; ++g)
+  size_t size = 0;
+  for (size_t side = 0; side < 2*D::dimension; ++side)
   {
-    for (size_t a = 0; a < d_quadrature->number_angles(); ++a)
-    {
-      // vertical sides
-      d_boundary_flux[Mesh::WEST][g].resize(na, 0.0);
-      d_boundary_flux[Mesh::EAST][g].resize(na, 0.0);
-    }
+    d_side_offset[side] = size;
+    d_boundary_flux_size[side] =
+      na * d_side_shape[side][0] * d_side_shape[side][1];
+    size += d_number_groups * d_boundary_flux_size[side];
   }
-  d_boundary_flux_size[Mesh::WEST] = na;
-  d_boundary_flux_size[Mesh::EAST] = na;
+  d_boundary_flux.assign(size, 0.0);
 }
 
 //---------------------------------------------------------------------------//
@@ -24,6 +24,13 @@ template <class D> class BoundaryCondition;
 /**
  *  @class BoundarySN
  *  @brief Boundary flux container for SN problems.
+ *
+ *  The boundary fluxes of all sides, groups, and angles live in one
+ *  contiguous store, ordered [side][group][angle][space].  Access by
+ *  side, octant, angle, and group returns a view into the store (see
+ *  BoundaryTraits), so sweeps read incident and write outgoing fluxes in
+ *  place rather than copying them.
+ *
  *  @todo Switch accessor to match diffusion (or vv)
  */
 //---------------------------------------------------------------------------//
@@ -44,6 +51,8 @@ public:
   typedef typename Base::SP_mesh                    SP_mesh;
   typedef detran_angle::Quadrature::SP_quadrature   SP_quadrature;
   typedef typename BoundaryTraits<D>::value_type    bf_type;
+  typedef typename BoundaryTraits<D>::view_type     view_type;
+  typedef typename BoundaryTraits<D>::const_view_type const_view_type;
   typedef typename std::vector<bf_type>             vec_boundary_flux;
   typedef typename std::vector<vec_boundary_flux>   vec2_boundary_flux;
   typedef typename std::vector<vec2_boundary_flux>  vec3_boundary_flux;
@@ -55,6 +64,8 @@ public:
 
   using Base::IN;
   using Base::OUT;
+  using Base::GET;
+  using Base::SET;
 
   //-------------------------------------------------------------------------//
   // CONSTRUCTORS & DESTRUCTORS
@@ -91,6 +102,23 @@ public:
   void psi(const size_t g, double *v, const int inout, const int gs,
            bool onlyref = true);
 
+  /**
+   *  @brief Get or set a side's flux for all angles of one octant.
+   *
+   *  The array is ordered angle-innermost, i.e. v[p * na + a], where
+   *  p is the (row-major) position along the side and na the number
+   *  of angles per octant.  This is the layout used by angle-batched
+   *  sweeps.
+   *
+   *  @param    side  Side index.
+   *  @param    o     Octant index.
+   *  @param    g     Energy group.
+   *  @param    v     Pointer to the octant flux array.
+   *  @param    gs    Get or set the boundary flux.
+   */
+  void octant_psi(const size_t side, const size_t o, const size_t g,
+                  double *v, const int gs);
+
   //-------------------------------------------------------------------------//
   // BOUNDARY FLUX ACCESS
   //-------------------------------------------------------------------------//
@@ -99,22 +127,25 @@ public:
    *  @brief Const access to a boundary flux using cardinal indices.
    *
    *  This (and the mutable version) interface is for use
-   *  in sweeping, where octants and angles are cycled.
+   *  in sweeping, where octants and angles are cycled.  This version
+   *  returns a read-only view.  The mutable view is returned const so
+   *  that assigning to it is an error; values are copied with
+   *  BoundaryValue<D>::assign.
    *
    *  @param    side  Side index.
    *  @param    o     Octant index.
    *  @param    a     Angle index (within octant).
    *  @param    g     Energy group.
-   *  @return         Constant reference to boundary flux.
+   *  @return         View of the boundary flux.
    */
-  const bf_type&
+  const_view_type
   operator()(const size_t side,
              const size_t o,
              const size_t a,
              const size_t g) const;
 
   /// Mutable access to boundary flux using cardinal indices.
-  bf_type&
+  const view_type
   operator()(const size_t side,
              const size_t o,
              const size_t a,
@@ -190,8 +221,12 @@ private:
 
   /// Quadrature
   SP_quadrature d_quadrature;
-  /// Boundary flux (side, energy, angle).(space^D)
-  vec3_boundary_flux d_boundary_flux;
+  /// Boundary flux [side][energy][angle][space^(D-1)]
+  vec_dbl d_boundary_flux;
+  /// Offset of each side within the boundary flux
+  detran_utilities::vec_size_t d_side_offset;
+  /// Rows and columns of each side, i.e. its shape in space
+  detran_utilities::vec2_size_t d_side_shape;
   /// Vector of boundary conditions.
   std::vector<SP_bc> d_bc;
 
@@ -202,6 +237,14 @@ private:
   /// Sizes the boundary flux containers.
   void initialize();
 
+  /// Offset of a side, group, and angle within the boundary flux
+  size_t offset(const size_t side, const size_t g, const size_t angle) const
+  {
+    return d_side_offset[side] +
+           (g * d_quadrature->number_angles() + angle) *
+           d_side_shape[side][0] * d_side_shape[side][1];
+  }
+
 };
 
 } // end namespace detran
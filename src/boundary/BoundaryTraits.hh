@@ -14,10 +14,209 @@
 #include "boundary/boundary_export.hh"
 #include "utilities/DBC.hh"
 #include "utilities/Definitions.hh"
+#include <algorithm>
 
 namespace detran
 {
 
+//---------------------------------------------------------------------------//
+/**
+ *  @class ConstBoundaryLineView
+ *  @brief Read-only view of the boundary flux along a line of cells.
+ */
+//---------------------------------------------------------------------------//
+
+class BOUNDARY_EXPORT ConstBoundaryLineView
+{
+public:
+  typedef detran_utilities::size_t  size_t;
+  typedef detran_utilities::vec_dbl vec_dbl;
+  /// Empty view
+  ConstBoundaryLineView() : d_values(0), d_size(0) {}
+  /// View of n contiguous values
+  ConstBoundaryLineView(const double *values, const size_t n)
+    : d_values(values), d_size(n) {}
+  /// Value in a cell
+  const double& operator[](const size_t i) const
+  {
+    Require(i < d_size);
+    return d_values[i];
+  }
+  /// Number of cells
+  size_t size() const { return d_size; }
+  /// Values
+  const double* data() const { return d_values; }
+  /// Copy of the values
+  vec_dbl copy() const { return vec_dbl(d_values, d_values + d_size); }
+private:
+  const double *d_values;
+  size_t        d_size;
+};
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class BoundaryLineView
+ *  @brief View of the boundary flux along a line of cells.
+ *
+ *  A view refers to storage owned elsewhere, usually by BoundarySN.
+ *  Copying a view copies only the reference; the values are copied with
+ *  assign().
+ */
+//---------------------------------------------------------------------------//
+
+class BOUNDARY_EXPORT BoundaryLineView
+{
+public:
+  typedef detran_utilities::size_t  size_t;
+  typedef detran_utilities::vec_dbl vec_dbl;
+  /// Empty view
+  BoundaryLineView() : d_values(0), d_size(0) {}
+  /// View of n contiguous values
+  BoundaryLineView(double *values, const size_t n)
+    : d_values(values), d_size(n) {}
+  /// Value in a cell
+  double& operator[](const size_t i) const
+  {
+    Require(i < d_size);
+    return d_values[i];
+  }
+  /// Number of cells
+  size_t size() const { return d_size; }
+  /// Values
+  double* data() const { return d_values; }
+  /// Read-only view of the same values
+  operator ConstBoundaryLineView() const
+  {
+    return ConstBoundaryLineView(d_values, d_size);
+  }
+  /// Copy the values of another view of the same size
+  void assign(const ConstBoundaryLineView &v) const
+  {
+    Require(v.size() == d_size);
+    std::copy(v.data(), v.data() + d_size, d_values);
+  }
+  /// Copy the values of a vector of the same size
+  void assign(const vec_dbl &v) const
+  {
+    Require(v.size() == d_size);
+    std::copy(v.begin(), v.end(), d_values);
+  }
+  /// Copy of the values
+  vec_dbl copy() const { return vec_dbl(d_values, d_values + d_size); }
+private:
+  double *d_values;
+  size_t  d_size;
+};
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class ConstBoundaryPlaneView
+ *  @brief Read-only view of the boundary flux over a plane of cells.
+ */
+//---------------------------------------------------------------------------//
+
+class BOUNDARY_EXPORT ConstBoundaryPlaneView
+{
+public:
+  typedef detran_utilities::size_t  size_t;
+  typedef detran_utilities::vec2_dbl vec2_dbl;
+  /// Empty view
+  ConstBoundaryPlaneView() : d_values(0), d_rows(0), d_columns(0) {}
+  /// View of a rows by columns plane of contiguous values
+  ConstBoundaryPlaneView(const double *values,
+                         const size_t  rows,
+                         const size_t  columns)
+    : d_values(values), d_rows(rows), d_columns(columns) {}
+  /// A row
+  ConstBoundaryLineView operator[](const size_t j) const
+  {
+    Require(j < d_rows);
+    return ConstBoundaryLineView(d_values + j * d_columns, d_columns);
+  }
+  /// Number of rows
+  size_t size() const { return d_rows; }
+  /// Number of columns
+  size_t columns() const { return d_columns; }
+  /// Values
+  const double* data() const { return d_values; }
+  /// Copy of the values
+  vec2_dbl copy() const
+  {
+    vec2_dbl v(d_rows);
+    for (size_t j = 0; j < d_rows; ++j)
+      v[j] = (*this)[j].copy();
+    return v;
+  }
+private:
+  const double *d_values;
+  size_t        d_rows;
+  size_t        d_columns;
+};
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class BoundaryPlaneView
+ *  @brief View of the boundary flux over a plane of cells.
+ *
+ *  The values are stored row by row, so that view[j][i] is the value in
+ *  row j and column i, as for the 2-D vector it replaces.
+ */
+//---------------------------------------------------------------------------//
+
+class BOUNDARY_EXPORT BoundaryPlaneView
+{
+public:
+  typedef detran_utilities::size_t  size_t;
+  typedef detran_utilities::vec2_dbl vec2_dbl;
+  /// Empty view
+  BoundaryPlaneView() : d_values(0), d_rows(0), d_columns(0) {}
+  /// View of a rows by columns plane of contiguous values
+  BoundaryPlaneView(double *values, const size_t rows, const size_t columns)
+    : d_values(values), d_rows(rows), d_columns(columns) {}
+  /// A row
+  BoundaryLineView operator[](const size_t j) const
+  {
+    Require(j < d_rows);
+    return BoundaryLineView(d_values + j * d_columns, d_columns);
+  }
+  /// Number of rows
+  size_t size() const { return d_rows; }
+  /// Number of columns
+  size_t columns() const { return d_columns; }
+  /// Values
+  double* data() const { return d_values; }
+  /// Read-only view of the same values
+  operator ConstBoundaryPlaneView() const
+  {
+    return ConstBoundaryPlaneView(d_values, d_rows, d_columns);
+  }
+  /// Copy the values of another view of the same shape
+  void assign(const ConstBoundaryPlaneView &v) const
+  {
+    Require(v.size() == d_rows && v.columns() == d_columns);
+    std::copy(v.data(), v.data() + d_rows * d_columns, d_values);
+  }
+  /// Copy the values of a 2-D vector of the same shape
+  void assign(const vec2_dbl &v) const
+  {
+    Require(v.size() == d_rows);
+    for (size_t j = 0; j < d_rows; ++j)
+      (*this)[j].assign(v[j]);
+  }
+  /// Copy of the values
+  vec2_dbl copy() const
+  {
+    vec2_dbl v(d_rows);
+    for (size_t j = 0; j < d_rows; ++j)
+      v[j] = (*this)[j].copy();
+    return v;
+  }
+private:
+  double *d_values;
+  size_t  d_rows;
+  size_t  d_columns;
+};
+
 //---------------------------------------------------------------------------//
 /**
  *  @brief Boundary traits to simplify type access.
@@ -26,6 +225,11 @@ namespace detran
  *  each surface in the form of a value (1-D), 1-D vector (2-D), or
  *  2-D vector (3-D).  This would be used for mesh-based discretizations,
  *  as in SN and diffusion.
+ *
+ *  SN boundaries keep all surfaces in one contiguous store and hand out
+ *  views of it instead: a reference (1-D), a line view (2-D), or a plane
+ *  view (3-D), each with a read-only counterpart for const access.  view()
+ *  builds one from the first value and the shape of the surface.
  */
 //---------------------------------------------------------------------------//
 
@@ -39,18 +243,51 @@ template <>
 struct BOUNDARY_EXPORT BoundaryTraits<_3D>
 {
   typedef detran_utilities::vec2_dbl value_type;
+  typedef BoundaryPlaneView          view_type;
+  typedef ConstBoundaryPlaneView     const_view_type;
+  static view_type view(double *v, const size_t n1, const size_t n2)
+  {
+    return view_type(v, n1, n2);
+  }
+  static const_view_type
+  const_view(const double *v, const size_t n1, const size_t n2)
+  {
+    return const_view_type(v, n1, n2);
+  }
 };
 
 template <>
 struct BOUNDARY_EXPORT BoundaryTraits<_2D>
 {
-  typedef detran_utilities::vec_dbl value_type;
+  typedef detran_utilities::vec_dbl  value_type;
+  typedef BoundaryLineView           view_type;
+  typedef ConstBoundaryLineView      const_view_type;
+  static view_type view(double *v, const size_t n1, const size_t n2 = 1)
+  {
+    return view_type(v, n1);
+  }
+  static const_view_type
+  const_view(const double *v, const size_t n1, const size_t n2 = 1)
+  {
+    return const_view_type(v, n1);
+  }
 };
 
 template <>
 struct BOUNDARY_EXPORT BoundaryTraits<_1D>
 {
-  typedef double value_type;
+  typedef double                     value_type;
+  typedef double&                    view_type;
+  typedef const double&              const_view_type;
+  static view_type view(double *v, const size_t n1 = 1, const size_t n2 = 1)
+  {
+    return *v;
+  }
+  static const_view_type
+  const_view(const double *v, const size_t n1 = 1, const size_t n2 = 1)
+  {
+    return *v;
+  }
 };
 
 //---------------------------------------------------------------------------//
@@ -60,7 +297,7 @@ struct BOUNDARY_EXPORT BoundaryTraits<_1D>
  *  Because we employ a templated boundary type, it can sometimes
  *  complicate simple access within an otherwise general algorithm.
  *  This accessor returns a boundary element given boundary spatial
- *  indices.
+ *  indices, and copies whole boundary fluxes between values and views.
  */
 //---------------------------------------------------------------------------//
 
@@ -93,6 +330,42 @@ struct BOUNDARY_EXPORT BoundaryValue<_3D>
     Require(i < b[0].size());
     return b[j][i];
   }
+  // Const access to boundary value through a view
+  static inline const double&
+  value(const BoundaryTraits<_3D>::const_view_type &b,
+        const size_t                                i,
+        const size_t                                j)
+  {
+    return b[j][i];
+  }
+  // Mutable access to boundary value through a view
+  static inline double&
+  value(const BoundaryTraits<_3D>::view_type &b,
+        const size_t                          i,
+        const size_t                          j)
+  {
+    return b[j][i];
+  }
+  // Copy of a viewed boundary flux
+  static inline BoundaryTraits<_3D>::value_type
+  copy(const BoundaryTraits<_3D>::const_view_type &b)
+  {
+    return b.copy();
+  }
+  // Copy a boundary flux into a view
+  static inline void
+  assign(const BoundaryTraits<_3D>::view_type  &to,
+         const BoundaryTraits<_3D>::value_type &from)
+  {
+    to.assign(from);
+  }
+  // Copy a viewed boundary flux into a view
+  static inline void
+  assign(const BoundaryTraits<_3D>::view_type       &to,
+         const BoundaryTraits<_3D>::const_view_type &from)
+  {
+    to.assign(from);
+  }
 };
 
 template <>
@@ -116,6 +389,42 @@ struct BOUNDARY_EXPORT BoundaryValue<_2D>
     Require(i < b.size());
     return b[i];
   }
+  // Const access to boundary value through a view
+  static inline const double&
+  value(const BoundaryTraits<_2D>::const_view_type &b,
+        const size_t                                i,
+        const size_t                                j = 0)
+  {
+    return b[i];
+  }
+  // Mutable access to boundary value through a view
+  static inline double&
+  value(const BoundaryTraits<_2D>::view_type &b,
+        const size_t                          i,
+        const size_t                          j = 0)
+  {
+    return b[i];
+  }
+  // Copy of a viewed boundary flux
+  static inline BoundaryTraits<_2D>::value_type
+  copy(const BoundaryTraits<_2D>::const_view_type &b)
+  {
+    return b.copy();
+  }
+  // Copy a boundary flux into a view
+  static inline void
+  assign(const BoundaryTraits<_2D>::view_type  &to,
+         const BoundaryTraits<_2D>::value_type &from)
+  {
+    to.assign(from);
+  }
+  // Copy a viewed boundary flux into a view
+  static inline void
+  assign(const BoundaryTraits<_2D>::view_type       &to,
+         const BoundaryTraits<_2D>::const_view_type &from)
+  {
+    to.assign(from);
+  }
 };
 
 template <>
@@ -137,6 +446,19 @@ struct BOUNDARY_EXPORT BoundaryValue<_1D>
   {
     return b;
   }
+  // Copy of a boundary flux
+  static inline BoundaryTraits<_1D>::value_type
+  copy(BoundaryTraits<_1D>::const_view_type b)
+  {
+    return b;
+  }
+  // Copy a boundary flux into a view
+  static inline void
+  assign(BoundaryTraits<_1D>::view_type  to,
+         BoundaryTraits<_1D>::value_type from)
+  {
+    to = from;
+  }
 };
 
 } // end namespace detran
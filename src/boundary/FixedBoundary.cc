@@ -24,7 +24,8 @@ FixedBoundary<D>::FixedBoundary(SP_boundary boundary,
   , d_psi(d_number_groups,
           vec2_bflux(d_quadrature->number_octants()/2,
                      vec1_bflux(d_quadrature->number_angles_octant(),
-                                (*d_boundary)(side, 0, 0, 0))))
+                                BoundaryValue<D>::copy(
+                                  (*d_boundary)(side, 0, 0, 0)))))
 {
   /* ... */
 }
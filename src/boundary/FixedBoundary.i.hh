@@ -25,7 +25,8 @@ FixedBoundary<D>::FixedBoundary(SP_boundary boundary,
   , d_psi(d_number_groups,
           vec2_bflux(d_quadrature->number_octants()/2,
                      vec1_bflux(d_quadrature->number_angles_octant(),
-                                (*d_boundary)(side, 0, 0, 0))))
+                                BoundaryValue<D>::copy(
+                                  (*d_boundary)(side, 0, 0, 0)))))
 {
   /* ... */
 }
@@ -40,7 +41,8 @@ inline void FixedBoundary<D>::set(const size_t g)
     size_t o = d_quadrature->incident_octant(d_side)[io];
     for (size_t a = 0; a < d_quadrature->number_angles_octant(); ++a)
     {
-      (*d_boundary)(d_side, o, a, g) = d_psi[g][io][a];
+      BoundaryValue<D>::assign((*d_boundary)(d_side, o, a, g),
+                               d_psi[g][io][a]);
     }
   }
 }
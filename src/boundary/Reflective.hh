@@ -19,6 +19,9 @@ namespace detran
 /**
  *  @class Reflective
  *  @brief Reflective boundary condition so SN problems.
+ *
+ *  Each incident octant maps directly to the outgoing octant it reflects,
+ *  and the fluxes are copied between views of the boundary store.
  */
 //---------------------------------------------------------------------------//
 
@@ -58,8 +61,14 @@ public:
              SP_quadrature quadrature)
     : Base(boundary, side, input, mesh, quadrature)
     , d_octants(quadrature->number_octants()/2, vec_int(2, 0))
+    , d_reflected_octant(quadrature->number_octants(), -1)
   {
     setup_octant();
+    for (size_t i = 0; i < d_octants.size(); ++i)
+    {
+      d_reflected_octant[d_octants[i][Boundary_T::IN]] =
+        d_octants[i][Boundary_T::OUT];
+    }
   }
 
   //-------------------------------------------------------------------------//
@@ -83,6 +92,8 @@ private:
 
   // Index of octant reflection pairs.
   vec2_int d_octants;
+  // Outgoing octant reflected into each incident octant, or -1.
+  vec_int d_reflected_octant;
 
   // Set up the octant indices.
   void setup_octant();
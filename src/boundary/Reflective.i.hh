@@ -24,31 +24,25 @@ void Reflective<D>::update(const size_t g)
     for (size_t a = 0; a < d_quadrature->number_angles_octant(); ++a)
     {
       // Reroute reflecting fluxes.
-      (*d_boundary)(d_side, d_octants[o][Boundary_T::IN], a, g) =
-        (*d_boundary)(d_side, d_octants[o][Boundary_T::OUT], a, g);
+      BoundaryValue<D>::assign(
+        (*d_boundary)(d_side, d_octants[o][Boundary_T::IN], a, g),
+        (*d_boundary)(d_side, d_octants[o][Boundary_T::OUT], a, g));
     }
   }
 }
 
 //---------------------------------------------------------------------------//
-// \todo This is not the most elegant solution
 template <class D>
 void Reflective<D>::update(const size_t g, const size_t o, const size_t a)
 {
-  int o_out = -1;
-  for (size_t i = 0; i < d_octants.size(); ++i)
-  {
-    if (d_octants[i][Boundary_T::IN] == o)
-    {
-      o_out = d_octants[i][Boundary_T::OUT];
-    }
-  }
+  Require(o < d_reflected_octant.size());
   // Only reroute fluxes if I am an outgoing side.
+  int o_out = d_reflected_octant[o];
   if (o_out >= 0)
   {
     // Reroute reflecting fluxes.
-    (*d_boundary)(d_side, o, a, g) =
-      (*d_boundary)(d_side, o_out, a, g);
+    BoundaryValue<D>::assign((*d_boundary)(d_side, o, a, g),
+                             (*d_boundary)(d_side, o_out, a, g));
   }
 }
 
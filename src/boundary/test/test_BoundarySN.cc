@@ -9,11 +9,13 @@
 
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST                    \
-        FUNC(test_BoundarySN)
+        FUNC(test_BoundarySN)        \
+        FUNC(test_BoundarySN_views)
 
 // Detran headers
 #include "TestDriver.hh"
 #include "boundary/BoundarySN.hh"
+#include "boundary/BoundaryFactory.t.hh"
 #include "angle/QuadratureFactory.hh"
 #include "geometry/Mesh1D.hh"
 #include "geometry/Mesh2D.hh"
@@ -152,6 +154,97 @@ int test_BoundarySN(int argc, char *argv[])
   return 0;
 }
 
+// Views refer to distinct, contiguous parts of one store, and copies between
+// them go through the same storage the sweepers use.
+int test_BoundarySN_views(int argc, char *argv[])
+{
+  typedef BoundarySN<_3D> Boundary_T;
+  typedef BoundaryFactory<_3D, BoundarySN> Factory_T;
+  Boundary_T::SP_input inp(new InputDB());
+  inp->put<int>("number_groups", 2);
+  inp->put<string>("bc_west", "reflect");
+  inp->put<int>("quad_number_polar_octant",   1);
+  inp->put<int>("quad_number_azimuth_octant", 2);
+  Boundary_T::SP_quadrature q;
+  detran_angle::QuadratureFactory qf;
+  qf.build(q, inp, 3);
+  vec_dbl cm(2, 0.0); cm[1] = 1.0;
+  vec_int fx(1, 2), fy(1, 3), fz(1, 4);
+  vec_int mt(1, 0);
+  Boundary_T::SP_mesh mesh(new Mesh3D(fx, fy, fz, cm, cm, cm, mt));
+  Boundary_T::SP_boundary b = Factory_T::build(inp, mesh, q);
+  int na = q->number_angles_octant();
+
+  // Fill every side, group, and angle with distinct values.  West is
+  // nz = 4 rows of ny = 3.
+  for (int side = 0; side < 6; ++side)
+    for (int g = 0; g < 2; ++g)
+      for (int o = 0; o < 8; ++o)
+        for (int a = 0; a < na; ++a)
+        {
+          Boundary_T::view_type v = (*b)(side, o, a, g);
+          for (int j = 0; j < v.size(); ++j)
+            for (int i = 0; i < v.columns(); ++i)
+              v[j][i] = 1000 * side + 100 * g + 10 * (o * na + a) + 3 * j + i;
+        }
+  for (int side = 0; side < 6; ++side)
+    for (int g = 0; g < 2; ++g)
+      for (int o = 0; o < 8; ++o)
+        for (int a = 0; a < na; ++a)
+        {
+          const Boundary_T::view_type v = (*b)(side, o, a, g);
+          for (int j = 0; j < v.size(); ++j)
+            for (int i = 0; i < v.columns(); ++i)
+              TEST(v[j][i] == 1000 * side + 100 * g + 10 * (o * na + a) + 3 * j + i);
+        }
+  Boundary_T::view_type west = (*b)(Mesh::WEST, 0, 0, 0);
+  TEST(west.size() == 4);
+  TEST(west.columns() == 3);
+  TEST(BoundaryValue<_3D>::value(west, 2, 1) == west[1][2]);
+
+  // Const access gives a read-only view of the same values.
+  const Boundary_T &cb = *b;
+  Boundary_T::const_view_type cwest = cb(Mesh::WEST, 0, 0, 0);
+  TEST(cwest.data() == west.data());
+  TEST(cwest.columns() == 3);
+  TEST(BoundaryValue<_3D>::value(cwest, 2, 1) == west[1][2]);
+
+  // The reflected flux is the outgoing flux of the paired octant.
+  b->update(1, 7, 1);
+  TEST(soft_equiv((*b)(Mesh::WEST, 7, 1, 1)[3][2],
+                  (*b)(Mesh::WEST, 6, 1, 1)[3][2]));
+  TEST((*b)(Mesh::WEST, 6, 1, 1)[3][2] == 1000 * 0 + 100 + 10 * (6 * na + 1) + 11);
+  b->update(0);
+  for (int a = 0; a < na; ++a)
+    TEST((*b)(Mesh::WEST, 4, a, 0)[0][0] == (*b)(Mesh::WEST, 5, a, 0)[0][0]);
+
+  // Reflected sides round trip, ordered by octant, angle, row, and column.
+  vec_dbl psi(b->boundary_flux_size(Mesh::WEST), 0.0);
+  b->psi(0, &psi[0], Boundary_T::OUT, Boundary_T::GET);
+  int o_out = q->outgoing_octant(Mesh::WEST)[1];
+  TEST(psi[(na + 1) * 12 + 5] == (*b)(Mesh::WEST, o_out, 1, 0)[1][2]);
+  for (int i = 0; i < psi.size(); ++i)
+    psi[i] = -i;
+  b->psi(0, &psi[0], Boundary_T::IN, Boundary_T::SET);
+  int o_in = q->incident_octant(Mesh::WEST)[1];
+  TEST((*b)(Mesh::WEST, o_in, 1, 0)[1][2] == -((na + 1) * 12 + 5));
+
+  // Values copy in and out of views.
+  vec2_dbl plane = BoundaryValue<_3D>::copy(west);
+  TEST(plane.size() == 4);
+  TEST(plane[3][2] == west[3][2]);
+  plane[3][2] = 1.5;
+  TEST(west[3][2] != 1.5);
+  BoundaryValue<_3D>::assign(west, plane);
+  TEST(west[3][2] == 1.5);
+
+  // Clearing a group leaves the other alone.
+  b->clear(0);
+  TEST((*b)(Mesh::TOP, 3, 1, 0)[2][1] == 0.0);
+  TEST((*b)(Mesh::TOP, 3, 1, 1)[2][1] == 5000 + 100 + 10 * (3 * na + 1) + 7);
+
+  return 0;
+}
 
 //---------------------------------------------------------------------------//
 //              end of test_BoundarySN.cc
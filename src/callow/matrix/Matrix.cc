@@ -9,7 +9,9 @@
 
 #include "Matrix.hh"
 #include "utils/Typedefs.hh"
+#include <algorithm>
 #include <iostream>
+#include <utility>
 
 namespace callow
 {
@@ -26,6 +28,8 @@ Matrix::Matrix()
   , d_diagonals(NULL)
   , d_nnz(0)
   , d_allocated(false)
+  , d_sell_chunk(0)
+  , d_sell_sigma(0)
 {
   /* ... */
 }
@@ -39,6 +43,8 @@ Matrix::Matrix(const int m, const int n)
   , d_diagonals(NULL)
   , d_nnz(0)
   , d_allocated(false)
+  , d_sell_chunk(0)
+  , d_sell_sigma(0)
 {
   /* ... */
 }
@@ -47,6 +53,8 @@ Matrix::Matrix(const int m, const int n)
 Matrix::Matrix(const int m, const int n, const int nnzrow)
   : MatrixBase(m, n)
   , d_allocated(false)
+  , d_sell_chunk(0)
+  , d_sell_sigma(0)
 {
   preallocate(nnzrow);
 }
@@ -54,6 +62,8 @@ Matrix::Matrix(const int m, const int n, const int nnzrow)
 //---------------------------------------------------------------------------//
 Matrix::Matrix(Matrix &A)
   : MatrixBase(A.number_rows(), A.number_columns())
+  , d_sell_chunk(0)
+  , d_sell_sigma(0)
 {
   d_nnz = A.number_nonzeros();
   d_rows      = new int[d_m + 1];
@@ -107,5 +117,75 @@ Matrix::Create(const int m, const int n, const int nnz)
   return p;
 }
 
+//---------------------------------------------------------------------------//
+// SLICED ELLPACK
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+void Matrix::set_sliced_ellpack(const int chunk, const int sigma)
+{
+  Insist(chunk >= 0 && chunk <= MAX_SELL_CHUNK,
+         "The sliced ELLPACK chunk must be in [0, MAX_SELL_CHUNK].");
+  Insist(sigma >= 1, "The sliced ELLPACK sorting window must be positive.");
+  d_sell_chunk = chunk;
+  d_sell_sigma = sigma;
+  if (d_is_ready) build_sliced_ellpack();
+}
+
+//---------------------------------------------------------------------------//
+void Matrix::build_sliced_ellpack()
+{
+  Require(d_is_ready);
+
+  detran_utilities::vec_int().swap(d_sell_slices);
+  detran_utilities::vec_int().swap(d_sell_rows);
+  detran_utilities::vec_int().swap(d_sell_columns);
+  detran_utilities::vec_dbl().swap(d_sell_values);
+  if (!d_sell_chunk || !d_m) return;
+
+  // sort rows by decreasing length within each window.  ties keep
+  // their original order, so the layout is deterministic.
+  d_sell_rows.resize(d_m);
+  std::vector<std::pair<int, int> > length(d_m);
+  for (int i = 0; i < d_m; ++i)
+    length[i] = std::make_pair(d_rows[i] - d_rows[i + 1], i);
+  for (int w = 0; w < d_m; w += d_sell_sigma)
+  {
+    int w_end = std::min(w + d_sell_sigma, d_m);
+    std::sort(length.begin() + w, length.begin() + w_end);
+  }
+  for (int i = 0; i < d_m; ++i)
+    d_sell_rows[i] = length[i].second;
+
+  // slice pointers, with every slice padded to chunk rows
+  int C = d_sell_chunk;
+  int number_slices = (d_m + C - 1) / C;
+  d_sell_slices.resize(number_slices + 1, 0);
+  for (int s = 0; s < number_slices; ++s)
+  {
+    int width = 0;
+    for (int r = s * C; r < std::min((s + 1) * C, d_m); ++r)
+      width = std::max(width, -length[r].first);
+    d_sell_slices[s + 1] = d_sell_slices[s] + width * C;
+  }
+
+  // fill column by column, padding with zeros in column 0
+  d_sell_columns.resize(d_sell_slices[number_slices], 0);
+  d_sell_values.resize(d_sell_slices[number_slices], 0.0);
+  for (int s = 0; s < number_slices; ++s)
+  {
+    for (int r = 0; r < C && s * C + r < d_m; ++r)
+    {
+      int i = d_sell_rows[s * C + r];
+      int q = d_sell_slices[s] + r;
+      for (int p = d_rows[i]; p < d_rows[i + 1]; ++p, q += C)
+      {
+        d_sell_columns[q] = d_columns[p];
+        d_sell_values[q]  = d_values[p];
+      }
+    }
+  }
+}
+
 } // end namespace callow
 
@@ -69,6 +69,25 @@ namespace callow
  * the \ref Jacobi or \ref GaussSeidel solvers, along with
  * certain preconditioner types.
  *
+ * Products are threaded over rows.  Each thread is given a contiguous
+ * block of rows holding roughly the same number of nonzeros, so that
+ * rows of different length do not leave threads idle.  For the transpose
+ * product, each thread scatters its rows into a private buffer, and the
+ * buffers are summed in thread order.  The result is reproducible for a
+ * given thread count.  The row blocks and hence the order of summation
+ * change with the thread count, so results for different counts may
+ * differ in the last bits.
+ *
+ * Optionally, a sliced ELLPACK (SELL-C-sigma) copy of the matrix can be
+ * kept for the product y <-- A * x.  Rows are sorted by length within
+ * windows of sigma rows and grouped into slices of C rows, each padded
+ * to its longest row and stored column by column.  The inner loop then
+ * runs over the C rows of a slice with unit stride, which vectorizes
+ * well for matrices with nearly uniform rows like the diffusion loss
+ * operator.  The copy is built at assembly (or when requested, if
+ * already assembled); values changed afterwards through values() are not
+ * seen until set_sliced_ellpack is called again.
+ *
  */
 
 class CALLOW_EXPORT Matrix: public MatrixBase
@@ -85,6 +104,12 @@ public:
     INSERT, ADD, END_INSERT_TYPE
   };
 
+  /// largest sliced ELLPACK slice
+  enum sell_limits
+  {
+    MAX_SELL_CHUNK = 64
+  };
+
   //---------------------------------------------------------------------------//
   // TYPEDEFS
   //---------------------------------------------------------------------------//
@@ -151,6 +176,17 @@ public:
 
   /// number of nonzeros
   int number_nonzeros() const { return d_nnz; }
+  /// first row of block t of nt row blocks having equal nonzeros
+  int partition(const int t, const int nt) const;
+
+  /**
+   *  @brief Use a sliced ELLPACK copy for the product A * x
+   *  @param chunk  rows per slice (C); 0 reverts to CSR
+   *  @param sigma  rows per sorting window (sigma)
+   */
+  void set_sliced_ellpack(const int chunk, const int sigma = 1);
+  /// is a sliced ELLPACK copy in use?
+  bool sliced_ellpack() const { return d_sell_chunk > 0; }
   /// is memory allocated?
   bool allocated() const {return d_allocated;}
   /// print (i, j, v) to ascii file with 1-based indexing for matlab
@@ -200,6 +236,20 @@ protected:
   std::vector<std::vector<triplet> > d_aij;
   // counts entries added per row
   detran_utilities::vec_int d_counter;
+  /// sliced ELLPACK rows per slice (0 if not used)
+  int d_sell_chunk;
+  /// sliced ELLPACK rows per sorting window
+  int d_sell_sigma;
+  /// sliced ELLPACK slice pointers
+  detran_utilities::vec_int d_sell_slices;
+  /// sliced ELLPACK original row of each sorted row
+  detran_utilities::vec_int d_sell_rows;
+  /// sliced ELLPACK column indices
+  detran_utilities::vec_int d_sell_columns;
+  /// sliced ELLPACK values
+  detran_utilities::vec_dbl d_sell_values;
+  /// per-thread buffers for the transpose product
+  detran_utilities::vec_dbl d_work;
 
   //---------------------------------------------------------------------------//
   // IMPLEMENTATION
@@ -207,6 +257,10 @@ protected:
 
   /// internal preallocation
   void preallocate();
+  /// build the sliced ELLPACK copy from the CSR storage
+  void build_sliced_ellpack();
+  /// product y <-- A * x using the sliced ELLPACK copy
+  void multiply_sliced_ellpack(const Vector &x, Vector &y);
 
 };
 
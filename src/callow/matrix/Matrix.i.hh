@@ -18,6 +18,9 @@
 #include <string>
 #include <sstream>
 #include <stdio.h>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace callow
 {
@@ -154,6 +157,7 @@ inline void Matrix::assemble()
   Assert(!ierr);
 #endif
   d_is_ready = true;
+  if (d_sell_chunk) build_sliced_ellpack();
 }
 
 //---------------------------------------------------------------------------//
@@ -192,6 +196,22 @@ inline int Matrix::column(const int p) const
 }
 
 
+/*
+ *  The row blocks are found by bisection on the row pointers, so they
+ *  need no storage and stay valid for any number of threads.
+ */
+
+inline int Matrix::partition(const int t, const int nt) const
+{
+  Require(d_is_ready);
+  Require(nt > 0);
+  Require(t >= 0 && t <= nt);
+  if (t == nt) return d_m;
+  long target = (long(d_nnz) * t) / nt;
+  return std::lower_bound(d_rows, d_rows + d_m, int(target)) - d_rows;
+}
+
+
 inline double Matrix::operator[](const int p) const
 {
   Require(d_is_ready);
@@ -239,27 +259,71 @@ inline void Matrix::multiply(const Vector &x, Vector &y)
 #ifdef CALLOW_ENABLE_PETSC_OPS
   MatMult(d_petsc_matrix, const_cast<Vector* >(&x)->petsc_vector(), y.petsc_vector());
 #else
-  // clear the output vector
-  y.scale(0);
-  // row pointer
-  int p = 0;
-  // for all rows
-  #pragma omp for private(p)
-  for (int i = 0; i < d_m; i++)
+  if (d_sell_chunk)
+  {
+    multiply_sliced_ellpack(x, y);
+    return;
+  }
+  if (!d_m) return;
+  const double *x_v = d_n ? &x[0] : NULL;
+  double *y_v = &y[0];
+  #pragma omp parallel default(shared)
   {
-    double temp = y[i];
-    // for all columns
-    for (p = d_rows[i]; p < d_rows[i + 1]; p++)
+    int t = 0, nt = 1;
+#ifdef DETRAN_ENABLE_OPENMP
+    t  = omp_get_thread_num();
+    nt = omp_get_num_threads();
+#endif
+    // for all rows in this thread's block
+    int i_end = partition(t + 1, nt);
+    for (int i = partition(t, nt); i < i_end; i++)
     {
-      int j = d_columns[p];
-      temp += x[j] * d_values[p];
+      double temp = 0.0;
+      // for all columns
+      for (int p = d_rows[i]; p < d_rows[i + 1]; p++)
+        temp += x_v[d_columns[p]] * d_values[p];
+      y_v[i] = temp;
     }
-    y[i] = temp;
   }
 #endif
 }
 
-// \todo good threading option needed
+/*
+ *  Each slice is a dense block of chunk rows by width columns, stored
+ *  column by column, so the innermost loop over the rows of a slice is
+ *  unit stride in the values and column indices.
+ */
+
+inline void Matrix::multiply_sliced_ellpack(const Vector &x, Vector &y)
+{
+  Require(d_sell_chunk > 0);
+  const int C = d_sell_chunk;
+  const int number_slices = d_sell_slices.size() - 1;
+  const double *x_v = d_n ? &x[0] : NULL;
+  double *y_v = d_m ? &y[0] : NULL;
+  const int    *col = d_sell_columns.empty() ? NULL : &d_sell_columns[0];
+  const double *val = d_sell_values.empty()  ? NULL : &d_sell_values[0];
+  #pragma omp parallel for default(shared)
+  for (int s = 0; s < number_slices; ++s)
+  {
+    double temp[MAX_SELL_CHUNK];
+    for (int r = 0; r < C; ++r)
+      temp[r] = 0.0;
+    for (int q = d_sell_slices[s]; q < d_sell_slices[s + 1]; q += C)
+      for (int r = 0; r < C; ++r)
+        temp[r] += val[q + r] * x_v[col[q + r]];
+    int r_end = std::min(C, d_m - s * C);
+    for (int r = 0; r < r_end; ++r)
+      y_v[d_sell_rows[s * C + r]] = temp[r];
+  }
+}
+
+/*
+ *  Scattering rows into y from several threads would race, so each
+ *  thread scatters its block of rows into its own buffer, and the
+ *  buffers are then summed in thread order.  With one thread, the rows
+ *  are scattered directly into y.
+ */
 
 inline void Matrix::multiply_transpose(const Vector &x, Vector &y)
 {
@@ -273,14 +337,45 @@ inline void Matrix::multiply_transpose(const Vector &x, Vector &y)
 #else
   // clear the output vector
   y.scale(0);
-  // for all rows (now columns)
-  for (int i = 0; i < d_m; i++)
+  if (!d_n) return;
+  const double *x_v = d_m ? &x[0] : NULL;
+  double *y_v = &y[0];
+  int nt = 1;
+  #pragma omp parallel default(shared)
   {
-    // for all columns (now rows)
-    for (int p = d_rows[i]; p < d_rows[i + 1]; p++)
+    int t = 0;
+#ifdef DETRAN_ENABLE_OPENMP
+    t = omp_get_thread_num();
+    #pragma omp single
     {
-      int j = d_columns[p];
-      y[j] += x[i] * d_values[p];
+      nt = omp_get_num_threads();
+      if (nt > 1 && d_work.size() < size_t(nt) * d_n)
+        d_work.resize(size_t(nt) * d_n);
+    }
+#endif
+    double *w = nt > 1 ? &d_work[size_t(t) * d_n] : y_v;
+    if (nt > 1)
+      for (int j = 0; j < d_n; j++)
+        w[j] = 0.0;
+    // for all rows (now columns) in this thread's block
+    int i_end = partition(t + 1, nt);
+    for (int i = partition(t, nt); i < i_end; i++)
+    {
+      // for all columns (now rows)
+      for (int p = d_rows[i]; p < d_rows[i + 1]; p++)
+        w[d_columns[p]] += x_v[i] * d_values[p];
+    }
+    if (nt > 1)
+    {
+      #pragma omp barrier
+      #pragma omp for
+      for (int j = 0; j < d_n; j++)
+      {
+        double temp = 0.0;
+        for (int tt = 0; tt < nt; tt++)
+          temp += d_work[size_t(tt) * d_n + j];
+        y_v[j] = temp;
+      }
     }
   }
 #endif
@@ -0,0 +1,517 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   PCAMG.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  PCAMG member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#include "PCAMG.hh"
+#include <algorithm>
+#include <cmath>
+
+namespace callow
+{
+
+//---------------------------------------------------------------------------//
+// SETUP KERNELS
+//---------------------------------------------------------------------------//
+
+/*
+ *  The hierarchy is built on plain CSR arrays, since the Galerkin products
+ *  need rows to be built one at a time, and each result is copied into a
+ *  Matrix only once it is complete.
+ */
+
+/// Plain CSR storage for building the hierarchy
+struct amg_csr
+{
+  int m, n;
+  std::vector<int>    row;
+  std::vector<int>    col;
+  std::vector<double> val;
+};
+
+//---------------------------------------------------------------------------//
+static void amg_from_matrix(Matrix &A, amg_csr &C)
+{
+  C.m = A.number_rows();
+  C.n = A.number_columns();
+  C.row.assign(A.rows(), A.rows() + C.m + 1);
+  C.col.assign(A.columns(), A.columns() + A.number_nonzeros());
+  C.val.assign(A.values(), A.values() + A.number_nonzeros());
+}
+
+//---------------------------------------------------------------------------//
+static Matrix::SP_matrix amg_to_matrix(amg_csr &C)
+{
+  Matrix::SP_matrix M(new Matrix(C.m, C.n));
+  std::vector<int> nnz(C.m, 0);
+  for (int i = 0; i < C.m; ++i)
+  {
+    nnz[i] = C.row[i + 1] - C.row[i];
+    Assert(nnz[i] > 0);
+  }
+  M->preallocate(&nnz[0]);
+  for (int i = 0; i < C.m; ++i)
+    M->insert(i, &C.col[C.row[i]], &C.val[C.row[i]], nnz[i]);
+  M->assemble();
+  return M;
+}
+
+//---------------------------------------------------------------------------//
+static void amg_multiply(const amg_csr &A, const amg_csr &B, amg_csr &C)
+{
+  Require(A.n == B.m);
+  C.m = A.m;
+  C.n = B.n;
+  C.row.assign(C.m + 1, 0);
+  C.col.clear();
+  C.val.clear();
+  // position of each column in the current row of C, if present
+  std::vector<int> marker(B.n, -1);
+  for (int i = 0; i < A.m; ++i)
+  {
+    int row_start = C.col.size();
+    for (int p = A.row[i]; p < A.row[i + 1]; ++p)
+    {
+      int j = A.col[p];
+      double a = A.val[p];
+      for (int q = B.row[j]; q < B.row[j + 1]; ++q)
+      {
+        int k = B.col[q];
+        if (marker[k] < row_start)
+        {
+          marker[k] = C.col.size();
+          C.col.push_back(k);
+          C.val.push_back(a * B.val[q]);
+        }
+        else
+        {
+          C.val[marker[k]] += a * B.val[q];
+        }
+      }
+    }
+    C.row[i + 1] = C.col.size();
+  }
+}
+
+//---------------------------------------------------------------------------//
+static void amg_transpose(const amg_csr &A, amg_csr &T)
+{
+  T.m = A.n;
+  T.n = A.m;
+  T.row.assign(T.m + 1, 0);
+  T.col.resize(A.col.size());
+  T.val.resize(A.val.size());
+  for (int p = 0; p < A.row[A.m]; ++p)
+    ++T.row[A.col[p] + 1];
+  for (int i = 0; i < T.m; ++i)
+    T.row[i + 1] += T.row[i];
+  std::vector<int> next(T.row.begin(), T.row.end() - 1);
+  for (int i = 0; i < A.m; ++i)
+  {
+    for (int p = A.row[i]; p < A.row[i + 1]; ++p)
+    {
+      int q = next[A.col[p]]++;
+      T.col[q] = i;
+      T.val[q] = A.val[p];
+    }
+  }
+}
+
+/*
+ *  Aggregation follows the three passes of Vanek et al.  First, each
+ *  unknown whose strong neighbors are all unaggregated forms an aggregate
+ *  with them.  Second, each remaining unknown joins an aggregate of the
+ *  first pass to which it is strongly coupled.  Third, whatever remains
+ *  forms aggregates with its remaining strong neighbors.
+ */
+
+//---------------------------------------------------------------------------//
+static int amg_aggregate(const amg_csr             &A,
+                         const std::vector<double> &diag,
+                         const double               theta,
+                         std::vector<int>          &agg)
+{
+  int n = A.m;
+
+  // strong neighbors of each unknown
+  std::vector<int> s_row(n + 1, 0);
+  std::vector<int> s_col;
+  s_col.reserve(A.col.size());
+  for (int i = 0; i < n; ++i)
+  {
+    for (int p = A.row[i]; p < A.row[i + 1]; ++p)
+    {
+      int j = A.col[p];
+      if (j != i &&
+          std::abs(A.val[p]) >= theta * std::sqrt(std::abs(diag[i] * diag[j])))
+      {
+        s_col.push_back(j);
+      }
+    }
+    s_row[i + 1] = s_col.size();
+  }
+
+  agg.assign(n, -1);
+  int number_aggregates = 0;
+
+  // pass 1: whole neighborhoods
+  for (int i = 0; i < n; ++i)
+  {
+    if (agg[i] != -1) continue;
+    bool free = true;
+    for (int p = s_row[i]; p < s_row[i + 1] && free; ++p)
+      if (agg[s_col[p]] != -1) free = false;
+    if (!free) continue;
+    agg[i] = number_aggregates;
+    for (int p = s_row[i]; p < s_row[i + 1]; ++p)
+      agg[s_col[p]] = number_aggregates;
+    ++number_aggregates;
+  }
+
+  // pass 2: join a neighboring aggregate
+  std::vector<int> agg_1(agg);
+  for (int i = 0; i < n; ++i)
+  {
+    if (agg[i] != -1) continue;
+    for (int p = s_row[i]; p < s_row[i + 1]; ++p)
+    {
+      if (agg_1[s_col[p]] != -1)
+      {
+        agg[i] = agg_1[s_col[p]];
+        break;
+      }
+    }
+  }
+
+  // pass 3: aggregate what remains
+  for (int i = 0; i < n; ++i)
+  {
+    if (agg[i] != -1) continue;
+    agg[i] = number_aggregates;
+    for (int p = s_row[i]; p < s_row[i + 1]; ++p)
+      if (agg[s_col[p]] == -1) agg[s_col[p]] = number_aggregates;
+    ++number_aggregates;
+  }
+
+  return number_aggregates;
+}
+
+//---------------------------------------------------------------------------//
+// CONSTRUCTOR
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+PCAMG::PCAMG(SP_matrix A, SP_db db)
+  : Base("PCAMG")
+  , d_smoother(GAUSS_SEIDEL)
+  , d_sweeps(1)
+{
+  // preconditions
+  Require(A);
+  Require(A->number_rows() == A->number_columns());
+  Insist(dynamic_cast<Matrix*>(A.bp()),
+    "Need an explicit matrix for use with PCAMG");
+
+  double theta = 0.08;
+  int max_levels = 10;
+  int coarse_size = 100;
+  if (db)
+  {
+    if (db->check("pc_amg_strength"))
+      theta = db->get<double>("pc_amg_strength");
+    if (db->check("pc_amg_levels"))
+      max_levels = db->get<int>("pc_amg_levels");
+    if (db->check("pc_amg_coarse_size"))
+      coarse_size = db->get<int>("pc_amg_coarse_size");
+    if (db->check("pc_amg_sweeps"))
+      d_sweeps = db->get<int>("pc_amg_sweeps");
+    if (db->check("pc_amg_smoother"))
+    {
+      std::string smoother = db->get<std::string>("pc_amg_smoother");
+      if (smoother == "jacobi")
+        d_smoother = JACOBI;
+      else if (smoother != "gs")
+        THROW("Unsupported AMG smoother: " + smoother);
+    }
+  }
+  Insist(theta >= 0.0, "The AMG strength threshold must be nonnegative.");
+  Insist(max_levels >= 1, "AMG needs at least one level.");
+  Insist(d_sweeps >= 1, "AMG needs at least one smoothing sweep.");
+
+  // build the hierarchy
+  d_A.push_back(SP_matrixfull(A));
+  amg_csr A_l;
+  amg_from_matrix(*d_A[0], A_l);
+  while (A_l.m > coarse_size && (int)d_A.size() < max_levels)
+  {
+    int n = A_l.m;
+
+    // diagonal and the Gershgorin bound on the spectrum of inv(D)*A
+    std::vector<double> diag(n, 0.0);
+    double rho = 0.0;
+    for (int i = 0; i < n; ++i)
+    {
+      double sum = 0.0;
+      for (int p = A_l.row[i]; p < A_l.row[i + 1]; ++p)
+      {
+        if (A_l.col[p] == i) diag[i] = A_l.val[p];
+        sum += std::abs(A_l.val[p]);
+      }
+      Insist(diag[i] != 0.0, "PCAMG needs a nonzero diagonal.");
+      rho = std::max(rho, sum / std::abs(diag[i]));
+    }
+    double omega = 4.0 / (3.0 * rho);
+
+    // aggregates, stopping if they would not coarsen the level
+    std::vector<int> agg;
+    int nc = amg_aggregate(A_l, diag, theta, agg);
+    if (nc >= n) break;
+
+    // smoothed prolongation, P = (I - omega * inv(D) * A) * P_0, where
+    // P_0 has one entry per row, 1/sqrt(size of the aggregate)
+    std::vector<double> scale(nc, 0.0);
+    for (int i = 0; i < n; ++i)
+      scale[agg[i]] += 1.0;
+    for (int c = 0; c < nc; ++c)
+      scale[c] = 1.0 / std::sqrt(scale[c]);
+    amg_csr P;
+    P.m = n;
+    P.n = nc;
+    P.row.assign(n + 1, 0);
+    std::vector<int> marker(nc, -1);
+    for (int i = 0; i < n; ++i)
+    {
+      int row_start = P.col.size();
+      int c = agg[i];
+      marker[c] = P.col.size();
+      P.col.push_back(c);
+      P.val.push_back(scale[c]);
+      for (int p = A_l.row[i]; p < A_l.row[i + 1]; ++p)
+      {
+        c = agg[A_l.col[p]];
+        double v = -omega * A_l.val[p] / diag[i] * scale[c];
+        if (marker[c] < row_start)
+        {
+          marker[c] = P.col.size();
+          P.col.push_back(c);
+          P.val.push_back(v);
+        }
+        else
+        {
+          P.val[marker[c]] += v;
+        }
+      }
+      P.row[i + 1] = P.col.size();
+    }
+
+    // restriction and the Galerkin coarse operator
+    amg_csr R, AP, A_c;
+    amg_transpose(P, R);
+    amg_multiply(A_l, P, AP);
+    amg_multiply(R, AP, A_c);
+
+    d_omega.push_back(omega);
+    d_P.push_back(amg_to_matrix(P));
+    d_R.push_back(amg_to_matrix(R));
+    d_A.push_back(amg_to_matrix(A_c));
+    std::swap(A_l, A_c);
+  }
+
+  // the coarsest level is not smoothed, but keep one damping per level
+  d_omega.push_back(1.0);
+
+  // work vectors
+  for (int l = 0; l < number_levels(); ++l)
+  {
+    int n = level_size(l);
+    d_x.push_back(SP_vector(new Vector(n, 0.0)));
+    d_b.push_back(SP_vector(new Vector(n, 0.0)));
+    d_r.push_back(SP_vector(new Vector(n, 0.0)));
+  }
+
+  factor_coarse();
+}
+
+//---------------------------------------------------------------------------//
+PCAMG::SP_preconditioner PCAMG::Create(SP_matrix A, SP_db db)
+{
+  SP_preconditioner p(new PCAMG(A, db));
+  return p;
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+void PCAMG::apply(Vector &b, Vector &x)
+{
+  Require(b.size() == level_size(0));
+  Require(x.size() == level_size(0));
+  d_b[0]->copy(b);
+  cycle(0);
+  x.copy(*d_x[0]);
+}
+
+//---------------------------------------------------------------------------//
+int PCAMG::level_size(const int l) const
+{
+  Require(l >= 0 && l < number_levels());
+  return d_A[l]->number_rows();
+}
+
+//---------------------------------------------------------------------------//
+double PCAMG::operator_complexity() const
+{
+  double nnz = 0.0;
+  for (int l = 0; l < number_levels(); ++l)
+    nnz += d_A[l]->number_nonzeros();
+  return nnz / d_A[0]->number_nonzeros();
+}
+
+//---------------------------------------------------------------------------//
+// IMPLEMENTATION
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+void PCAMG::cycle(const int l)
+{
+  if (l == number_levels() - 1)
+  {
+    solve_coarse();
+    return;
+  }
+  Vector &x = *d_x[l];
+  Vector &r = *d_r[l];
+
+  // pre-smooth from a zero guess
+  smooth(l, true, true);
+
+  // restrict the residual, r = b - A*x, and correct from the next level
+  d_A[l]->multiply(x, r);
+  r.axpby(1.0, *d_b[l], -1.0);
+  d_R[l]->multiply(r, *d_b[l + 1]);
+  cycle(l + 1);
+  d_P[l]->multiply(*d_x[l + 1], r);
+  x.add(r);
+
+  // post-smooth
+  smooth(l, false, false);
+}
+
+//---------------------------------------------------------------------------//
+void PCAMG::smooth(const int l, const bool forward, const bool initial)
+{
+  Matrix &A = *d_A[l];
+  const int n = A.number_rows();
+  const int *rows = A.rows();
+  const int *cols = A.columns();
+  const int *diag = A.diagonals();
+  const double *v = A.values();
+  double *x = &(*d_x[l])[0];
+  const double *b = &(*d_b[l])[0];
+  if (initial) d_x[l]->set(0.0);
+
+  for (int s = 0; s < d_sweeps; ++s)
+  {
+    if (d_smoother == GAUSS_SEIDEL)
+    {
+      for (int k = 0; k < n; ++k)
+      {
+        int i = forward ? k : n - 1 - k;
+        double val = b[i];
+        for (int p = rows[i]; p < rows[i + 1]; ++p)
+          if (p != diag[i]) val -= v[p] * x[cols[p]];
+        x[i] = val / v[diag[i]];
+      }
+    }
+    else
+    {
+      // x <-- x + omega * inv(D) * (b - A*x)
+      double *r = &(*d_r[l])[0];
+      const double omega = d_omega[l];
+      A.multiply(*d_x[l], *d_r[l]);
+      #pragma omp parallel for default(shared)
+      for (int i = 0; i < n; ++i)
+        x[i] += omega * (b[i] - r[i]) / v[diag[i]];
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+void PCAMG::factor_coarse()
+{
+  Matrix &A = *d_A.back();
+  int n = A.number_rows();
+
+  // coarsening stalled or ran out of levels above the dense limit, so
+  // approximate the coarse solve rather than form a huge dense factor
+  if (n > MAX_DENSE_SIZE)
+  {
+    d_coarse_ilu0 = new PCILU0(d_A.back());
+    return;
+  }
+
+  d_lu.assign(n * n, 0.0);
+  d_pivot.resize(n);
+  for (int i = 0; i < n; ++i)
+    for (int p = A.start(i); p < A.end(i); ++p)
+      d_lu[i * n + A.column(p)] = A[p];
+
+  // LU with partial pivoting
+  for (int k = 0; k < n; ++k)
+  {
+    int pivot = k;
+    for (int i = k + 1; i < n; ++i)
+      if (std::abs(d_lu[i * n + k]) > std::abs(d_lu[pivot * n + k]))
+        pivot = i;
+    d_pivot[k] = pivot;
+    if (pivot != k)
+      for (int j = 0; j < n; ++j)
+        std::swap(d_lu[k * n + j], d_lu[pivot * n + j]);
+    double a_kk = d_lu[k * n + k];
+    Insist(a_kk != 0.0, "Singular coarsest AMG operator.");
+    for (int i = k + 1; i < n; ++i)
+    {
+      double l_ik = d_lu[i * n + k] / a_kk;
+      d_lu[i * n + k] = l_ik;
+      if (l_ik == 0.0) continue;
+      for (int j = k + 1; j < n; ++j)
+        d_lu[i * n + j] -= l_ik * d_lu[k * n + j];
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+void PCAMG::solve_coarse()
+{
+  Vector &x = *d_x.back();
+  if (d_coarse_ilu0)
+  {
+    d_coarse_ilu0->apply(*d_b.back(), x);
+    return;
+  }
+  x.copy(*d_b.back());
+  int n = x.size();
+  for (int k = 0; k < n; ++k)
+    if (d_pivot[k] != k) std::swap(x[k], x[d_pivot[k]]);
+  for (int i = 1; i < n; ++i)
+    for (int j = 0; j < i; ++j)
+      x[i] -= d_lu[i * n + j] * x[j];
+  for (int i = n - 1; i >= 0; --i)
+  {
+    for (int j = i + 1; j < n; ++j)
+      x[i] -= d_lu[i * n + j] * x[j];
+    x[i] /= d_lu[i * n + i];
+  }
+}
+
+} // end namespace callow
+
+//---------------------------------------------------------------------------//
+//              end of file PCAMG.cc
+//---------------------------------------------------------------------------//
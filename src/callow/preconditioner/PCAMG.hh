@@ -0,0 +1,177 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   PCAMG.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  PCAMG class definition.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef callow_PCAMG_HH_
+#define callow_PCAMG_HH_
+
+#include "Preconditioner.hh"
+#include "PCILU0.hh"
+#include "callow/matrix/Matrix.hh"
+#include "utilities/InputDB.hh"
+#include <vector>
+
+namespace callow
+{
+
+/**
+ *  @class PCAMG
+ *  @brief Smoothed aggregation algebraic multigrid preconditioner
+ *
+ *  One V-cycle of smoothed aggregation AMG (Vanek, Mandel, and Brezina)
+ *  approximates the inverse of A.  The hierarchy is built once from the
+ *  explicit matrix:
+ *    - Two unknowns are strongly coupled if
+ *      \f$ |a_{ij}| \ge \theta \sqrt{|a_{ii} a_{jj}|} \f$.
+ *    - Unknowns are grouped into aggregates of strongly coupled
+ *      neighbors, and each aggregate becomes one coarse unknown.
+ *    - The tentative prolongation is piecewise constant over the
+ *      aggregates.  It is smoothed by one damped Jacobi step,
+ *      \f$ P = (I - \omega D^{-1} A) P_0 \f$ with
+ *      \f$ \omega = 4 / (3 \rho) \f$, where \f$ \rho \f$ bounds the
+ *      spectral radius of \f$ D^{-1} A \f$ by Gershgorin's theorem.
+ *    - The coarse operator is the Galerkin product \f$ P^T A P \f$.
+ *  Coarsening stops at the coarse size or the maximum number of levels,
+ *  or when aggregation no longer reduces the size.  The coarsest system
+ *  is solved by dense LU if it has at most MAX_DENSE_SIZE unknowns and
+ *  is otherwise approximated by ILU(0).  A smaller pc_amg_strength
+ *  treats more couplings as strong and so coarsens more aggressively.
+ *  The smoother is
+ *  Gauss-Seidel, forward before and backward after the coarse
+ *  correction so that the cycle is symmetric, or damped Jacobi, which
+ *  is threaded.
+ *
+ *  The hierarchy targets diffusion-like matrices, for which the
+ *  constant vector approximates the near null space.  For those, the
+ *  number of iterations of a preconditioned Krylov solver stays nearly
+ *  flat as the mesh is refined.
+ *
+ *  Relevant input database entries:
+ *    - pc_amg_strength (0.08)    -- strength of connection threshold
+ *    - pc_amg_levels (10)        -- maximum number of levels
+ *    - pc_amg_coarse_size (100)  -- largest size solved directly
+ *    - pc_amg_smoother ("gs")    -- "gs" or "jacobi"
+ *    - pc_amg_sweeps (1)         -- smoothing sweeps before and after
+ */
+
+class CALLOW_EXPORT PCAMG: public Preconditioner
+{
+
+public:
+
+  //-------------------------------------------------------------------------//
+  // ENUMERATIONS
+  //-------------------------------------------------------------------------//
+
+  enum amg_smoother
+  {
+    GAUSS_SEIDEL, JACOBI, END_AMG_SMOOTHER
+  };
+
+  /// Largest coarsest level that is factored by dense LU
+  enum { MAX_DENSE_SIZE = 4000 };
+
+  //-------------------------------------------------------------------------//
+  // TYPEDEFS
+  //-------------------------------------------------------------------------//
+
+  typedef Preconditioner                        Base;
+  typedef Base::SP_preconditioner               SP_preconditioner;
+  typedef MatrixBase::SP_matrix                 SP_matrix;
+  typedef Matrix::SP_matrix                     SP_matrixfull;
+  typedef Vector::SP_vector                     SP_vector;
+  typedef detran_utilities::InputDB::SP_input   SP_db;
+
+  //-------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Construct an AMG preconditioner for the explicit matrix A
+   *  @param A    explicit matrix
+   *  @param db   optional parameter database
+   */
+  PCAMG(SP_matrix A, SP_db db = SP_db(0));
+
+  /// SP constructor
+  static SP_preconditioner Create(SP_matrix A, SP_db db = SP_db(0));
+
+  /// Virtual destructor
+  virtual ~PCAMG(){};
+
+  //-------------------------------------------------------------------------//
+  // ABSTRACT INTERFACE -- ALL PRECONDITIONERS MUST IMPLEMENT THIS
+  //-------------------------------------------------------------------------//
+
+  /// Solve Px = b with one V-cycle
+  void apply(Vector &b, Vector &x);
+
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /// Number of levels, including the finest
+  int number_levels() const { return d_A.size(); }
+  /// Number of unknowns on a level
+  int level_size(const int l) const;
+  /// Nonzeros of all level operators relative to those of the finest
+  double operator_complexity() const;
+  /// Whether the coarsest system is solved exactly by dense LU
+  bool coarse_direct() const { return !d_coarse_ilu0; }
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // DATA
+  //-------------------------------------------------------------------------//
+
+  /// Operators of each level, finest first
+  std::vector<SP_matrixfull> d_A;
+  /// Prolongation from level l + 1 to level l
+  std::vector<SP_matrixfull> d_P;
+  /// Restriction from level l to level l + 1, the transpose of d_P
+  std::vector<SP_matrixfull> d_R;
+  /// Solution, right hand side, and residual of each level
+  std::vector<SP_vector> d_x;
+  std::vector<SP_vector> d_b;
+  std::vector<SP_vector> d_r;
+  /// Damping of the Jacobi smoother on each level
+  std::vector<double> d_omega;
+  /// Dense LU factors of the coarsest operator, row major
+  std::vector<double> d_lu;
+  /// Pivots of the dense LU factors
+  std::vector<int> d_pivot;
+  /// ILU(0) of a coarsest operator too large for dense LU
+  SP_preconditioner d_coarse_ilu0;
+  /// Smoother
+  int d_smoother;
+  /// Smoothing sweeps before and after the coarse correction
+  int d_sweeps;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Apply the V-cycle on level l to d_b[l], leaving the result in d_x[l]
+  void cycle(const int l);
+  /// Smooth on level l, starting from zero if initial
+  void smooth(const int l, const bool forward, const bool initial);
+  /// Factor the coarsest operator, by dense LU or ILU(0) by its size
+  void factor_coarse();
+  /// Solve the coarsest system
+  void solve_coarse();
+
+};
+
+} // end namespace callow
+
+#endif // callow_PCAMG_HH_
+
+//---------------------------------------------------------------------------//
+//              end of file PCAMG.hh
+//---------------------------------------------------------------------------//
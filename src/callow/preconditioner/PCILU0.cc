@@ -8,85 +8,101 @@
 //---------------------------------------------------------------------------//
 
 #include "PCILU0.hh"
+#include <algorithm>
 
 namespace callow
 {
 
 //---------------------------------------------------------------------------//
-PCILU0::PCILU0(SP_matrix A)
+PCILU0::PCILU0(SP_matrix A, const int type, const int number_blocks)
   : Base("PCILU0")
+  , d_type(type)
 {
   // preconditions
   Require(A);
   Require(A->number_rows() == A->number_columns());
   Insist(dynamic_cast<Matrix*>(A.bp()),
     "Need an explicit matrix for use with PCILU0");
+  Insist(d_type >= 0 && d_type < END_ILU0_TYPE, "Unknown ILU0 type");
+  Require(number_blocks >= 0);
   SP_matrixfull B(A);
 
   // copy A
   d_P = new Matrix(*B);
+  int n = d_P->number_rows();
 
-  using std::cout;
-  using std::endl;
+  // row blocks, which are the whole matrix unless blocked
+  int nb = 1;
+  if (d_type == BLOCK)
+  {
+    nb = number_blocks ? number_blocks : (int)DEFAULT_NUMBER_BLOCKS;
+    nb = std::max(1, std::min(nb, n));
+  }
+  d_blocks.resize(nb + 1, 0);
+  for (int b = 0; b <= nb; ++b)
+    d_blocks[b] = (n * (long)b) / nb;
+
+  // the entries of each row kept in the factors, which for blocks are
+  // those whose columns fall within the row's block
+  d_lower_begin.resize(n);
+  d_upper_end.resize(n);
+  for (int b = 0; b < nb; ++b)
+  {
+    for (int i = d_blocks[b]; i < d_blocks[b + 1]; ++i)
+    {
+      int p = d_P->start(i);
+      while (p < d_P->diagonal(i) && d_P->column(p) < d_blocks[b]) ++p;
+      d_lower_begin[i] = p;
+      p = d_P->end(i);
+      while (p > d_P->diagonal(i) + 1 && d_P->column(p - 1) >= d_blocks[b + 1])
+        --p;
+      d_upper_end[i] = p;
+    }
+  }
+
+  if (d_type == LEVEL) build_levels();
 
   /* the following mostly follows the algorithm of
    * saad in ch 10, which is basically as follows:
    *
    *  for i = 1, m
    *    for k = 0, i-1
-   *      if (A(i,k) > 0) A(i,k) = A(i,k)/A(i,i)
+   *      if (A(i,k) > 0) A(i,k) = A(i,k)/A(k,k)
    *      for j = k+1, n
-   *        if (A(i,j) > 0) A(i,j) = A(i,j) - A(i,j)*A(k,j)
+   *        if (A(i,j) > 0) A(i,j) = A(i,j) - A(i,k)*A(k,j)
    *
+   * row i depends only on the rows k of its lower entries, so the
+   * rows of one level set, or of different blocks, can be factored
+   * concurrently.
    */
 
-  // working array
-  int* iw = new int[A->number_columns()];
-  for (int k = 0; k < A->number_columns(); ++k) iw[k] = -1;
-
-
-  // get the csr structure
-  int n = d_P->number_rows();
-  double *luval = d_P->values();
-
-  // loop over rows
-  for (int i = 1; i < n; ++i)
+  int number_zero_pivots = 0;
+  #pragma omp parallel default(shared) if (d_type != SERIAL) \
+                       reduction(+:number_zero_pivots)
   {
-
-    // pre-store the column pointers for this row.  if
-    // the column isn't present, the value remains -1
-    for (int p = d_P->start(i); p < d_P->diagonal(i); ++p)
-      iw[d_P->column(p)] = p;
-
-    // loop through the columns
-    for (int p = d_P->start(i); p < d_P->diagonal(i); ++p)
+    // working array, with the entry index of each column of row i
+    std::vector<int> iw(n, -1);
+    if (d_type == LEVEL)
     {
-      // column index of row i
-      int k = d_P->column(p);
-
-      // compute row multiplier (aik = aik / akk)
-      double val = luval[p] / luval[d_P->diagonal(k)];
-      luval[p] = val;
-      // for *row* k, loop over the columns j above diagonal
-      for (int q = d_P->diagonal(k) + 1; q < d_P->end(k); ++q)
+      for (int l = 0; l < number_lower_levels(); ++l)
       {
-        int j = d_P->column(q);
-        int pp = iw[j];
-        if (pp != -1) luval[pp] -= val * luval[q];
+        #pragma omp for schedule(static)
+        for (int r = d_lower_levels[l]; r < d_lower_levels[l + 1]; ++r)
+          if (!factor_row(d_lower_rows[r], &iw[0])) ++number_zero_pivots;
       }
     }
-    int d = d_P->diagonal(i);
-    if (luval[d] == 0.0)
+    else
     {
-      THROW("ZERO PIVOT IN ILU0");
+      #pragma omp for schedule(static)
+      for (int b = 0; b < nb; ++b)
+        for (int i = d_blocks[b]; i < d_blocks[b + 1]; ++i)
+          if (!factor_row(i, &iw[0])) ++number_zero_pivots;
     }
-
-    // reset
-    for (int p = d_P->start(i); p < d_P->diagonal(i); ++p)
-      iw[d_P->column(p)] = -1;
   }
-
-  delete [] iw;
+  if (number_zero_pivots)
+  {
+    THROW("ZERO PIVOT IN ILU0");
+  }
 
   // size the working vector
   d_y.resize(d_P->number_rows(), 0.0);
@@ -94,12 +110,94 @@ PCILU0::PCILU0(SP_matrix A)
 }
 
 //---------------------------------------------------------------------------//
-PCILU0::SP_preconditioner PCILU0::Create(SP_matrix A)
+PCILU0::SP_preconditioner
+PCILU0::Create(SP_matrix A, const int type, const int number_blocks)
 {
-  SP_preconditioner p(new PCILU0(A));
+  SP_preconditioner p(new PCILU0(A, type, number_blocks));
   return p;
 }
 
+//---------------------------------------------------------------------------//
+bool PCILU0::factor_row(const int i, int *iw)
+{
+  double *luval = d_P->values();
+  const int *col = d_P->columns();
+  const int *diag = d_P->diagonals();
+
+  // pre-store the entry indices for this row.  if the column isn't
+  // present, the value remains -1
+  for (int p = d_lower_begin[i]; p < d_upper_end[i]; ++p)
+    iw[col[p]] = p;
+
+  // loop through the lower columns
+  for (int p = d_lower_begin[i]; p < diag[i]; ++p)
+  {
+    // column index of row i
+    int k = col[p];
+    // compute row multiplier (aik = aik / akk)
+    double val = luval[p] / luval[diag[k]];
+    luval[p] = val;
+    // for *row* k, loop over the columns j above diagonal
+    for (int q = diag[k] + 1; q < d_upper_end[k]; ++q)
+    {
+      int pp = iw[col[q]];
+      if (pp != -1) luval[pp] -= val * luval[q];
+    }
+  }
+
+  // reset
+  for (int p = d_lower_begin[i]; p < d_upper_end[i]; ++p)
+    iw[col[p]] = -1;
+
+  return luval[diag[i]] != 0.0;
+}
+
+//---------------------------------------------------------------------------//
+void PCILU0::build_levels()
+{
+  int n = d_P->number_rows();
+  const int *col = d_P->columns();
+  const int *diag = d_P->diagonals();
+  std::vector<int> level(n, 0);
+
+  // forward substitution: row i follows the rows of its lower entries
+  int number_levels = 0;
+  for (int i = 0; i < n; ++i)
+  {
+    for (int p = d_lower_begin[i]; p < diag[i]; ++p)
+      level[i] = std::max(level[i], level[col[p]] + 1);
+    number_levels = std::max(number_levels, level[i] + 1);
+  }
+  d_lower_levels.assign(number_levels + 1, 0);
+  for (int i = 0; i < n; ++i)
+    ++d_lower_levels[level[i] + 1];
+  for (int l = 0; l < number_levels; ++l)
+    d_lower_levels[l + 1] += d_lower_levels[l];
+  d_lower_rows.resize(n);
+  std::vector<int> next(d_lower_levels.begin(), d_lower_levels.end() - 1);
+  for (int i = 0; i < n; ++i)
+    d_lower_rows[next[level[i]]++] = i;
+
+  // backward substitution: row i follows the rows of its upper entries
+  level.assign(n, 0);
+  number_levels = 0;
+  for (int i = n - 1; i >= 0; --i)
+  {
+    for (int p = diag[i] + 1; p < d_upper_end[i]; ++p)
+      level[i] = std::max(level[i], level[col[p]] + 1);
+    number_levels = std::max(number_levels, level[i] + 1);
+  }
+  d_upper_levels.assign(number_levels + 1, 0);
+  for (int i = 0; i < n; ++i)
+    ++d_upper_levels[level[i] + 1];
+  for (int l = 0; l < number_levels; ++l)
+    d_upper_levels[l + 1] += d_upper_levels[l];
+  d_upper_rows.resize(n);
+  next.assign(d_upper_levels.begin(), d_upper_levels.end() - 1);
+  for (int i = n - 1; i >= 0; --i)
+    d_upper_rows[next[level[i]]++] = i;
+}
+
 } // end namespace callow
 
 //---------------------------------------------------------------------------//
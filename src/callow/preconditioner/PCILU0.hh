@@ -28,13 +28,28 @@ namespace callow
  *          A(i,k) = A(i,k)/A(k,k)
  *          for j = k + 1 .. n
  *            for (i, j) in nonzeros of upper A
- *              A(i, j) = A(i, j) - A(i, k)*A(k, k)
+ *              A(i, j) = A(i, j) - A(i, k)*A(k, j)
  *            end
  *          end
  *        end
  *      end
  *    end
  *  @endcode
+ *
+ *  Three variants are available:
+ *    - SERIAL factors and solves row by row in order.
+ *    - LEVEL schedules the rows by level sets of the sparsity pattern.
+ *      A row's level is one more than the highest level of the rows on
+ *      which it depends, so all rows of a level are factored or solved
+ *      concurrently.  The level sets of the forward and backward
+ *      substitutions are computed once when the matrix is given and are
+ *      reused by every application.  The result is identical to SERIAL.
+ *    - BLOCK drops all couplings between contiguous blocks of rows and
+ *      factors and solves the blocks concurrently, i.e. block Jacobi
+ *      with ILU(0) on each block.  By default, there are
+ *      DEFAULT_NUMBER_BLOCKS blocks, shared among the threads, so that
+ *      the result does not depend on the number of threads.  This is a
+ *      weaker preconditioner than SERIAL.
  */
 
 class CALLOW_EXPORT PCILU0: public Preconditioner
@@ -42,6 +57,18 @@ class CALLOW_EXPORT PCILU0: public Preconditioner
 
 public:
 
+  //-------------------------------------------------------------------------//
+  // ENUMERATIONS
+  //-------------------------------------------------------------------------//
+
+  enum ilu0_type
+  {
+    SERIAL, LEVEL, BLOCK, END_ILU0_TYPE
+  };
+
+  /// Number of row blocks for BLOCK when none is given
+  enum { DEFAULT_NUMBER_BLOCKS = 8 };
+
   //-------------------------------------------------------------------------//
   // TYPEDEFS
   //-------------------------------------------------------------------------//
@@ -56,11 +83,19 @@ public:
   // CONSTRUCTOR & DESTRUCTOR
   //-------------------------------------------------------------------------//
 
-  /// Construct an ILU0 preconditioner for the explicit matrix A
-  PCILU0(SP_matrix A);
+  /**
+   *  @brief Construct an ILU0 preconditioner for the explicit matrix A
+   *  @param A              explicit matrix
+   *  @param type           serial, level-scheduled, or block variant
+   *  @param number_blocks  number of row blocks for BLOCK; 0 for
+   *                        DEFAULT_NUMBER_BLOCKS
+   */
+  PCILU0(SP_matrix A, const int type = SERIAL, const int number_blocks = 0);
 
   /// SP constructor
-  static SP_preconditioner Create(SP_matrix A);
+  static SP_preconditioner Create(SP_matrix A,
+                                  const int type = SERIAL,
+                                  const int number_blocks = 0);
 
   /// Virtual destructor
   virtual ~PCILU0(){};
@@ -72,12 +107,56 @@ public:
   /// Solve Px = b
   void apply(Vector &b, Vector &x);
 
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /// Number of level sets of the forward substitution
+  int number_lower_levels() const
+  { return d_lower_levels.empty() ? 0 : d_lower_levels.size() - 1; }
+  /// Number of level sets of the backward substitution
+  int number_upper_levels() const
+  { return d_upper_levels.empty() ? 0 : d_upper_levels.size() - 1; }
+  /// Number of row blocks
+  int number_blocks() const { return d_blocks.size() - 1; }
+
 protected:
 
   /// ILU decomposition of A
   SP_matrixfull d_P;
   /// Working vector
   Vector d_y;
+  /// Variant
+  int d_type;
+  /// First lower entry of each row kept in the factors
+  std::vector<int> d_lower_begin;
+  /// One past the last upper entry of each row kept in the factors
+  std::vector<int> d_upper_end;
+  /// Rows of the forward substitution, ordered by level
+  std::vector<int> d_lower_rows;
+  /// Offsets of the forward substitution levels into d_lower_rows
+  std::vector<int> d_lower_levels;
+  /// Rows of the backward substitution, ordered by level
+  std::vector<int> d_upper_rows;
+  /// Offsets of the backward substitution levels into d_upper_rows
+  std::vector<int> d_upper_levels;
+  /// First row of each block, plus the number of rows
+  std::vector<int> d_blocks;
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Compute the level sets of the forward and backward substitutions
+  void build_levels();
+  /// Factor row i; iw is -1 for all columns.  Returns false on zero pivot.
+  bool factor_row(const int i, int *iw);
+  /// Forward substitution for row i
+  void solve_lower(const int i, const double *b);
+  /// Backward substitution for row i
+  void solve_upper(const int i, double *x);
 
 };
 
@@ -19,48 +19,81 @@ namespace callow
 inline void PCILU0::apply(Vector &b, Vector &x)
 {
   // solve LUx = x --> x = inv(U)*inv(L)*x
+  Require(b.size() == d_P->number_rows());
+  Require(x.size() == d_P->number_rows());
+  const double *b_v = &b[0];
+  double *x_v = &x[0];
 
-  // forward substitution
-  //   for i = 0:m-1
-  //     x[i] = 1/L[i,i] * ( b[i] - sum(k=0:i-1, L[i,k]*y[k]) )
-  // but note that in our ILU(0) scheme, L is *unit* lower triangle,
-  // meaning L has ones on the diagonal (whereas U does not)
-  for (int i = 0; i < d_P->number_rows(); ++i)
+  if (d_type == SERIAL)
   {
-    // start index
-    int s = d_P->start(i);
-    // diagonal index
-    int d = d_P->diagonal(i);
-    // invert row
-    d_y[i] = b[i];
-    for (int p = s; p < d; ++p)
-    {
-      // column index
-      int c = d_P->column(p);
-      d_y[i] -= d_P->values()[p] * d_y[c];
-    }
+    for (int i = 0; i < d_P->number_rows(); ++i)
+      solve_lower(i, b_v);
+    for (int i = d_P->number_rows() - 1; i >= 0; --i)
+      solve_upper(i, x_v);
+    return;
   }
 
-  // backward substitution
-  //   for i = m-1:0
-  //     y[i] = 1/U[i,i] * ( b[i] - sum(k=i+1:m-1, U[i,k]*y[k]) )
-  for (int i = d_P->number_rows() - 1; i >= 0; --i)
+  #pragma omp parallel default(shared)
   {
-    // diagonal index
-    int d = d_P->diagonal(i);
-    // end index
-    int e = d_P->end(i);
-    // invert row
-    x[i] = d_y[i];
-    for (int p = d; p < e; ++p)
+    if (d_type == LEVEL)
+    {
+      // the rows of a level depend only on rows of earlier levels
+      for (int l = 0; l < number_lower_levels(); ++l)
+      {
+        #pragma omp for schedule(static)
+        for (int r = d_lower_levels[l]; r < d_lower_levels[l + 1]; ++r)
+          solve_lower(d_lower_rows[r], b_v);
+      }
+      for (int l = 0; l < number_upper_levels(); ++l)
+      {
+        #pragma omp for schedule(static)
+        for (int r = d_upper_levels[l]; r < d_upper_levels[l + 1]; ++r)
+          solve_upper(d_upper_rows[r], x_v);
+      }
+    }
+    else
     {
-      // column index
-      int c = d_P->column(p);
-      x[i] -= d_P->values()[p] * x[c];
+      // the blocks are independent
+      #pragma omp for schedule(static)
+      for (int k = 0; k < number_blocks(); ++k)
+      {
+        for (int i = d_blocks[k]; i < d_blocks[k + 1]; ++i)
+          solve_lower(i, b_v);
+        for (int i = d_blocks[k + 1] - 1; i >= d_blocks[k]; --i)
+          solve_upper(i, x_v);
+      }
     }
-    x[i] /= d_P->values()[d];
   }
+}
 
+//---------------------------------------------------------------------------/
+inline void PCILU0::solve_lower(const int i, const double *b)
+{
+  // forward substitution
+  //   y[i] = 1/L[i,i] * ( b[i] - sum(k=0:i-1, L[i,k]*y[k]) )
+  // but note that in our ILU(0) scheme, L is *unit* lower triangle,
+  // meaning L has ones on the diagonal (whereas U does not)
+  const double *v = d_P->values();
+  const int *col = d_P->columns();
+  double *y = &d_y[0];
+  double val = b[i];
+  for (int p = d_lower_begin[i]; p < d_P->diagonals()[i]; ++p)
+    val -= v[p] * y[col[p]];
+  y[i] = val;
+}
+
+//---------------------------------------------------------------------------/
+inline void PCILU0::solve_upper(const int i, double *x)
+{
+  // backward substitution
+  //   x[i] = 1/U[i,i] * ( y[i] - sum(k=i+1:m-1, U[i,k]*x[k]) )
+  const double *v = d_P->values();
+  const int *col = d_P->columns();
+  const int d = d_P->diagonals()[i];
+  double val = d_y[i];
+  for (int p = d + 1; p < d_upper_end[i]; ++p)
+    val -= v[p] * x[col[p]];
+  x[i] = val / v[d];
 }
 
 } // end namespace detran
@@ -48,8 +48,9 @@ namespace callow
  *      x = \mathbf{P}^{-1} y \, .
  *  \f]
  *
- *  Within callow, the Jacobi and ILU(0) preconditioners are
- *  available along with user-defined shell preconditioners.
+ *  Within callow, the Jacobi, ILU(0), and smoothed aggregation AMG
+ *  preconditioners are available along with user-defined shell
+ *  preconditioners.
  *  If built with PETSc, all preconditioners are available (to PETSc)
  *  as shells.  Otherwise, the user can set PETSc preconditioners
  *  with PetscSolver parameters.
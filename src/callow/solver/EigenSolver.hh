@@ -176,6 +176,12 @@ public:
     return d_lambda;
   }
 
+  /// Get the number of iterations of the last solve
+  int number_iterations()
+  {
+    return d_number_iterations;
+  }
+
 protected:
 
   //-------------------------------------------------------------------------//
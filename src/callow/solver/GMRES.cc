@@ -16,14 +16,20 @@ namespace callow
 GMRES::GMRES(const double  atol,
              const double  rtol,
              const int     maxit,
-             const int     restart)
+             const int     restart,
+             const int     orthog)
   : LinearSolver(atol, rtol, maxit, "solver_gmres")
   , d_restart(restart)
   , d_c(restart+1, 0.0)
   , d_s(restart+1, 0.0)
   , d_reorthog(1)
+  , d_orthog(orthog)
+  , d_basis_size(0)
+  , d_h(restart+1, 0.0)
 {
   Insist(d_restart > 2, "Need a restart of > 2");
+  Insist(d_orthog >= 0 && d_orthog < END_GMRES_ORTHOG,
+         "Unknown GMRES orthogonalization.");
   d_H = new double*[(restart + 1)];
   for (int i = 0; i <= d_restart; i++)
   {
@@ -45,4 +51,25 @@ GMRES::~GMRES()
   delete [] d_H;
 }
 
+//---------------------------------------------------------------------------//
+void GMRES::allocate(const int n)
+{
+  if (n == d_basis_size) return;
+  d_basis_size = n;
+  int m = d_restart + 1;
+  d_basis.assign(m * n, 0.0);
+  d_v.resize(m);
+  for (int j = 0; j < m; ++j)
+    d_v[j] = new Vector(n, &d_basis[j * n]);
+  if (d_orthog == PIPELINED)
+  {
+    d_z_basis.assign(m * n, 0.0);
+    d_z.resize(m);
+    for (int j = 0; j < m; ++j)
+      d_z[j] = new Vector(n, &d_z_basis[j * n]);
+  }
+  d_r.resize(n, 0.0);
+  d_t.resize(n, 0.0);
+}
+
 } // end namespace callow
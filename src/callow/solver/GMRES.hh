@@ -43,6 +43,29 @@ namespace callow
  *  rotation for incremental conversion of the upper Hessenberg
  *  matrix \f$ H \f$ to an upper triangle matrix \f$ R \f$.
  *
+ *  The new Krylov vector can be orthogonalized in three ways:
+ *    - MGS, modified Gram-Schmidt (default), which makes k dependent
+ *      passes of dot and axpy over the basis at step k, with optional
+ *      reorthogonalization following Kelley.
+ *    - CGS2, classical Gram-Schmidt applied twice.  All inner products of
+ *      a pass come from one fused multi-vector kernel, and the update is
+ *      one fused pass as well, so each pass reads the basis only once.
+ *    - PIPELINED, the p(1)-GMRES of Ghysels et al.  An auxiliary basis
+ *      \f$ z_{j+1} = \mathbf{A}v_j \f$ is kept by recurrence, so that the
+ *      next operator application does not wait on the orthogonalization,
+ *      and all inner products and the norm of a step come from one fused
+ *      reduction.  When cancellation in the norm is detected, the step
+ *      falls back to an explicit CGS2 step.  The recurrence assumes the
+ *      preconditioned operator is linear, so preconditioners that apply
+ *      an inexact inner solve should be used with MGS or CGS2 instead.
+ *
+ *  The Krylov basis is one contiguous allocation that is kept across
+ *  solves and resized only when the vector size changes.
+ *
+ *  Reference:
+ *    Ghysels, P., Ashby, T., Meerbergen, K. and Vanroose, W. "Hiding
+ *    global communication latency in the GMRES algorithm on massively
+ *    parallel machines", SIAM J. Sci. Comput. 35 (2013).
  */
 class GMRES: public LinearSolver
 {
@@ -51,12 +74,21 @@ public:
 
   typedef LinearSolver Base;
 
+  //-------------------------------------------------------------------------//
+  // ENUMERATIONS
+  //-------------------------------------------------------------------------//
+
+  enum gmres_orthog
+  {
+    MGS, CGS2, PIPELINED, END_GMRES_ORTHOG
+  };
+
   //-------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
   //-------------------------------------------------------------------------//
 
   GMRES(const double atol, const double rtol, const int maxit,
-        const int restart = 20);
+        const int restart = 20, const int orthog = MGS);
 
   virtual ~GMRES();
 
@@ -94,6 +126,29 @@ private:
   Vector d_c;
   Vector d_s;
 
+  /// orthogonalization [MGS, CGS2, PIPELINED]
+  int d_orthog;
+
+  /// size of the vectors for which the workspace is allocated
+  int d_basis_size;
+
+  /// krylov basis [m+1][n]
+  std::vector<double> d_basis;
+
+  /// auxiliary basis z(j+1) = A*v(j) of the pipelined variant [m+1][n]
+  std::vector<double> d_z_basis;
+
+  /// vectors wrapping the rows of the bases
+  std::vector<SP_vector> d_v;
+  std::vector<SP_vector> d_z;
+
+  /// residual and temporary work vectors
+  Vector d_r;
+  Vector d_t;
+
+  /// inner products of one pass [m+1]
+  std::vector<double> d_h;
+
   //-------------------------------------------------------------------------//
   // ABSTRACT INTERFACE -- ALL LINEAR SOLVERS MUST IMPLEMENT THIS
   //-------------------------------------------------------------------------//
@@ -104,6 +159,18 @@ private:
    */
   void solve_impl(const Vector &b, Vector &x);
 
+  /// pipelined solve
+  void solve_pipelined(const Vector &b, Vector &x);
+
+  /// apply inv(P_L)*A*inv(P_R) to x
+  void apply_operator(Vector &x, Vector &y);
+
+  /// Orthogonalize v(k+1) against v(0:k) and fill column k of H
+  void orthogonalize(const int k);
+
+  /// Allocate the basis and work vectors for vectors of size n
+  void allocate(const int n);
+
   /// apply givens rotation to H
   void apply_givens(const int k);
 
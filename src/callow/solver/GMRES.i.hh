@@ -26,18 +26,25 @@ namespace callow
 
 inline void GMRES::solve_impl(const Vector &b, Vector &x0)
 {
+  if (d_orthog == PIPELINED)
+  {
+    solve_pipelined(b, x0);
+    return;
+  }
+
   int restart = d_restart;
   if (restart >= d_A->number_rows()) restart = d_A->number_rows();
 
   // Unknowns.  If x0 is nonzero, we need to separate it out.
   Vector x(x0);
 
-  // krylov basis
-  std::vector<Vector>  v(d_restart + 1, Vector(x.size(), 0.0));
+  // krylov basis and work vectors, kept across solves
+  allocate(x.size());
+  std::vector<SP_vector> &v = d_v;
 
   // residual
-  Vector r(x.size(), 0.0);
-  Vector t(x.size(), 0.0);
+  Vector &r = d_r;
+  Vector &t = d_t;
 
   // vector such that x = V*y
   Vector y(d_restart, 0.0);
@@ -58,15 +65,12 @@ inline void GMRES::solve_impl(const Vector &b, Vector &x0)
   while (!done && iteration < d_maximum_iterations)
   {
 
-    // clear krylov subspace
-    for (int i = 0; i < d_restart; i++) v[i].set(0.0);
     g.set(0.0);
 
     // compute residual
     //   apply operator
     d_A->multiply(x, r);
-    r.subtract(b);
-    r.scale(-1);
+    r.axpby(1.0, b, -1.0);
 
     //   apply left preconditioner
     if (d_P && d_pc_side == Base::LEFT)
@@ -90,8 +94,8 @@ inline void GMRES::solve_impl(const Vector &b, Vector &x0)
     }
 
     // initial krylov vector
-    v[0].copy(r);
-    v[0].scale(1.0 / rho);
+    v[0]->copy(r);
+    v[0]->scale(1.0 / rho);
     g[0] = rho;
 
     // inner iterations (of size restart)
@@ -110,67 +114,203 @@ inline void GMRES::solve_impl(const Vector &b, Vector &x0)
       // compute v(k+1) <-- inv(P_L)*A*inv(P_R) * v(k)
       //---------------------------------------------------------------------//
 
-      // apply right preconditioner and operator
-      if (d_P && d_pc_side == Base::RIGHT)
+      apply_operator(*v[k], *v[k + 1]);
+
+      //---------------------------------------------------------------------//
+      // orthogonalize v(k+1)
+      //---------------------------------------------------------------------//
+
+      orthogonalize(k);
+
+      //---------------------------------------------------------------------//
+      // watch for happy breakdown: if H[k+1][k] == 0, we've solved Ax=b
+      //---------------------------------------------------------------------//
+      bool happy = false;
+      if (d_H[k+1][k] != 0.0)
       {
-        d_P->apply(v[k], v[k + 1]);
-        t.copy(v[k + 1]);
-        d_A->multiply(t, v[k + 1]);
+        v[k+1]->scale(1.0/d_H[k+1][k]);
       }
       else
       {
-        // save on a copy
-        d_A->multiply(v[k], v[k + 1]);
-      }
-      // apply left preconditioner
-      if (d_P && d_pc_side == Base::LEFT)
-      {
-        t.copy(v[k + 1]);
-        d_P->apply(t, v[k + 1]);
+        happy = true;
+        std::printf("happy breakdown for k = %5i (iteration = %5i) \n",
+                    k, iteration);
       }
 
       //---------------------------------------------------------------------//
-      // use modified gram-schmidt to orthogonalize v(k+1)
+      // apply givens rotations to triangularize H on-the-fly (it's neat!)
       //---------------------------------------------------------------------//
 
-      double norm_Av = v[k+1].norm();
-      for (int j = 0; j <= k; ++j)
+      if (k > 0) apply_givens(k);
+      double nu = std::sqrt(d_H[k][k]*d_H[k][k] + d_H[k+1][k]*d_H[k+1][k]);
+      d_c[k] =  d_H[k  ][k] / nu;
+      d_s[k] = -d_H[k+1][k] / nu;
+      d_H[k  ][k] = d_c[k] * d_H[k][k] - d_s[k]*d_H[k+1][k];
+      d_H[k+1][k] = 0.0;
+      double g_0 = d_c[k]*g[k] - d_s[k]*g[k+1];
+      double g_1 = d_s[k]*g[k] + d_c[k]*g[k+1];
+      g[k  ] = g_0;
+      g[k+1] = g_1;
+      if (happy) cout << " g_0 = " << g_0 << " g_1 = " << g_1 << endl;
+
+      //---------------------------------------------------------------------//
+      // monitor the residual and break if done
+      //---------------------------------------------------------------------//
+
+      rho = std::abs(g_1);
+      if (monitor(iteration, rho))
+      {
+        ++k;
+//        printf("gmres(%3i) terminated at outer iteration %5i ",
+//               d_restart, iteration/d_restart);
+//        printf("(inner iteration %3i) to a solution with residual: %12.8e \n",
+//               k, rho);
+        done = true;
+        break;
+      }
+
+    } // end inners
+
+    //---------------------------------------------------------------------//
+    // update the solution
+    //---------------------------------------------------------------------//
+
+    compute_y(y, g, k);
+
+    // reset the solution
+    x.set(0.0);
+    // update x = v[0]*y[0] + ...
+    x.multi_axpy(v, 0, k, &y[0]);
+    if (d_P && d_pc_side == Base::RIGHT)
+    {
+      t.copy(x);
+      d_P->apply(t, x);
+    }
+    // add the initial guess
+    x.add(x0);
+
+    // This iterate becomes the new initial guess
+    x0.copy(x);
+
+  } // end outers
+
+  // copy solution to outgoing vector
+  x0.copy(x);
+
+  return;
+}
+
+//---------------------------------------------------------------------------//
+inline void GMRES::solve_pipelined(const Vector &b, Vector &x0)
+{
+  // The basis never needs more vectors than there are unknowns.
+  int restart = d_restart;
+  if (restart >= d_A->number_rows()) restart = d_A->number_rows();
+
+  // Unknowns.  If x0 is nonzero, we need to separate it out.
+  Vector x(x0);
+
+  // krylov bases and work vectors, kept across solves
+  allocate(x.size());
+  std::vector<SP_vector> &v = d_v;
+  std::vector<SP_vector> &z = d_z;
+  Vector &r = d_r;
+  Vector &t = d_t;
+
+  // vector such that x = V*y
+  Vector y(restart, 0.0);
+
+  // vector such that g(1:k) = R*y --> x = V*inv(R)*g and |g(k+1)| is the residual
+  Vector g(restart + 1, 0.0);
+
+  // initialize c and s
+  d_c.set(0.0);
+  d_s.set(0.0);
+
+  //-------------------------------------------------------------------------//
+  // outer iterations
+  //-------------------------------------------------------------------------//
+
+  int iteration = 0;  // total iterations
+  bool done = false;
+  while (!done && iteration < d_maximum_iterations)
+  {
+
+    g.set(0.0);
+
+    // compute residual
+    d_A->multiply(x, r);
+    r.axpby(1.0, b, -1.0);
+    if (d_P && d_pc_side == Base::LEFT)
+    {
+      t.copy(r);
+      d_P->apply(t, r);
+    }
+    double rho = r.norm(L2);
+    if (iteration == 0 && monitor_init(rho)) return;
+
+    // initial krylov vector and its image z(1) = A*v(0)
+    v[0]->copy(r);
+    v[0]->scale(1.0 / rho);
+    g[0] = rho;
+    apply_operator(*v[0], *z[1]);
+    double drift = 1.0;
+
+    // inner iterations (of size restart)
+    int k = 0;
+    for (; k < restart; ++k)
+    {
+      ++iteration;
+      // check iteration count
+      if (iteration >= d_maximum_iterations-1)
       {
-        d_H[j][k] = v[k+1].dot(v[j]);
-        v[k+1].add_a_times_x(-d_H[j][k], v[j]);
+        done = true;
+        break;
       }
-      d_H[k+1][k] = v[k+1].norm(L2);
-      double norm_Av_2 = d_H[k+1][k];
 
       //---------------------------------------------------------------------//
-      // optional reorthogonalization
+      // one fused reduction: h(j,k) = <v(j), z(k+1)> and |z(k+1)|^2
       //---------------------------------------------------------------------//
 
-      if ( (d_reorthog == 1 && norm_Av + 0.001 * norm_Av_2 == norm_Av) ||
-           (d_reorthog == 2) )
+      double zz = 0.0;
+      z[k+1]->multi_dot(v, 0, k + 1, &d_h[0], &zz);
+      double hh = 0.0;
+      for (int j = 0; j <= k; ++j)
       {
-        // summarized from kelley:
-        //  if the new vector (i.e. v[k+1]) is very small relative to
-        //  A*v[k], then information might be lost so reorthogonalize.  the
-        //  delta of 0.001 is what kelley uses in his test code.
+        d_H[j][k] = d_h[j];
+        hh += d_h[j] * d_h[j];
+      }
+
+      // v(k+1) = z(k+1) - V*h
+      v[k+1]->copy(*z[k+1]);
+      v[k+1]->multi_axpy(v, 0, k + 1, &d_h[0], -1.0);
 
+      // The norm follows from the inner products unless h(k+1,k) is small
+      // next to |z(k+1)|, where the cancellation would cost accuracy and
+      // orthogonality.  Then the step is made explicitly with CGS2.
+      bool explicit_step = (zz - hh <= 1.0e-2 * zz);
+      if (!explicit_step)
+      {
+        d_H[k+1][k] = std::sqrt(zz - hh);
+      }
+      else
+      {
         if (d_monitor_level > 1) cout << " reorthog ... " << endl;
-        for (int j = 0; j < k; ++j)
-        {
-          double hr = v[j].dot(v[k+1]);
-          d_H[j][k] += hr;
-          v[k+1].add_a_times_x(-hr, v[j]);
-        }
-        d_H[k+1][k] = v[k+1].norm();
+        v[k+1]->multi_dot(v, 0, k + 1, &d_h[0]);
+        v[k+1]->multi_axpy(v, 0, k + 1, &d_h[0], -1.0);
+        for (int j = 0; j <= k; ++j)
+          d_H[j][k] += d_h[j];
+        d_H[k+1][k] = v[k+1]->norm(L2);
       }
+      double h_next = d_H[k+1][k];
 
       //---------------------------------------------------------------------//
       // watch for happy breakdown: if H[k+1][k] == 0, we've solved Ax=b
       //---------------------------------------------------------------------//
       bool happy = false;
-      if (d_H[k+1][k] != 0.0)
+      if (h_next != 0.0)
       {
-        v[k+1].scale(1.0/d_H[k+1][k]);
+        v[k+1]->scale(1.0 / h_next);
       }
       else
       {
@@ -180,7 +320,7 @@ inline void GMRES::solve_impl(const Vector &b, Vector &x0)
       }
 
       //---------------------------------------------------------------------//
-      // apply givens rotations to triangularize H on-the-fly (it's neat!)
+      // apply givens rotations to triangularize H on-the-fly
       //---------------------------------------------------------------------//
 
       if (k > 0) apply_givens(k);
@@ -193,24 +333,45 @@ inline void GMRES::solve_impl(const Vector &b, Vector &x0)
       double g_1 = d_s[k]*g[k] + d_c[k]*g[k+1];
       g[k  ] = g_0;
       g[k+1] = g_1;
-      if (happy) cout << " g_0 = " << g_0 << " g_1 = " << g_1 << endl;
 
       //---------------------------------------------------------------------//
       // monitor the residual and break if done
       //---------------------------------------------------------------------//
 
       rho = std::abs(g_1);
-      if (monitor(iteration, rho))
+      if (monitor(iteration, rho) || happy)
       {
         ++k;
-//        printf("gmres(%3i) terminated at outer iteration %5i ",
-//               d_restart, iteration/d_restart);
-//        printf("(inner iteration %3i) to a solution with residual: %12.8e \n",
-//               k, rho);
         done = true;
         break;
       }
 
+      //---------------------------------------------------------------------//
+      // next image z(k+2) = A*v(k+1)
+      //---------------------------------------------------------------------//
+
+      // The image is not needed at the end of a cycle.
+      if (k + 1 == restart) continue;
+
+      // Each recurrence amplifies the error in z by about |z(k+1)|/h(k+1,k),
+      // so the image is computed directly once the growth is too large.
+      drift *= std::sqrt(zz) / h_next;
+      if (explicit_step || drift > 1.0e4)
+      {
+        apply_operator(*v[k+1], *z[k+2]);
+        drift = 1.0;
+      }
+      else
+      {
+        // A*z(k+1) does not depend on this step's reduction, so the two
+        // may proceed together; here it is deferred until the residual
+        // shows another step is needed.  Then
+        //   z(k+2) = (A*z(k+1) - sum_j h(j,k) z(j+1)) / h(k+1,k)
+        apply_operator(*z[k+1], *z[k+2]);
+        z[k+2]->multi_axpy(z, 1, k + 1, &d_h[0], -1.0);
+        z[k+2]->scale(1.0 / h_next);
+      }
+
     } // end inners
 
     //---------------------------------------------------------------------//
@@ -218,23 +379,14 @@ inline void GMRES::solve_impl(const Vector &b, Vector &x0)
     //---------------------------------------------------------------------//
 
     compute_y(y, g, k);
-
-    // reset the solution
     x.set(0.0);
-    // update x = v[0]*y[0] + ...
-    for (int i = 0; i < k; ++i)
-    {
-      x.add_a_times_x(y[i], v[i]);
-    }
+    x.multi_axpy(v, 0, k, &y[0]);
     if (d_P && d_pc_side == Base::RIGHT)
     {
       t.copy(x);
       d_P->apply(t, x);
     }
-    // add the initial guess
     x.add(x0);
-
-    // This iterate becomes the new initial guess
     x0.copy(x);
 
   } // end outers
@@ -245,6 +397,86 @@ inline void GMRES::solve_impl(const Vector &b, Vector &x0)
   return;
 }
 
+//---------------------------------------------------------------------------//
+inline void GMRES::apply_operator(Vector &x, Vector &y)
+{
+  // apply right preconditioner and operator
+  if (d_P && d_pc_side == Base::RIGHT)
+  {
+    d_P->apply(x, y);
+    d_t.copy(y);
+    d_A->multiply(d_t, y);
+  }
+  else
+  {
+    // save on a copy
+    d_A->multiply(x, y);
+  }
+  // apply left preconditioner
+  if (d_P && d_pc_side == Base::LEFT)
+  {
+    d_t.copy(y);
+    d_P->apply(d_t, y);
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline void GMRES::orthogonalize(const int k)
+{
+  Vector &w = *d_v[k+1];
+
+  if (d_orthog == CGS2)
+  {
+    // classical gram-schmidt, twice, with fused passes over the basis
+    w.multi_dot(d_v, 0, k + 1, &d_h[0]);
+    w.multi_axpy(d_v, 0, k + 1, &d_h[0], -1.0);
+    for (int j = 0; j <= k; ++j)
+      d_H[j][k] = d_h[j];
+    w.multi_dot(d_v, 0, k + 1, &d_h[0]);
+    w.multi_axpy(d_v, 0, k + 1, &d_h[0], -1.0);
+    for (int j = 0; j <= k; ++j)
+      d_H[j][k] += d_h[j];
+    d_H[k+1][k] = w.norm(L2);
+    return;
+  }
+
+  //-------------------------------------------------------------------------//
+  // use modified gram-schmidt to orthogonalize v(k+1)
+  //-------------------------------------------------------------------------//
+
+  double norm_Av = w.norm();
+  for (int j = 0; j <= k; ++j)
+  {
+    d_H[j][k] = w.dot(*d_v[j]);
+    w.add_a_times_x(-d_H[j][k], *d_v[j]);
+  }
+  d_H[k+1][k] = w.norm(L2);
+  double norm_Av_2 = d_H[k+1][k];
+
+  //-------------------------------------------------------------------------//
+  // optional reorthogonalization
+  //-------------------------------------------------------------------------//
+
+  if ( (d_reorthog == 1 && norm_Av + 0.001 * norm_Av_2 == norm_Av) ||
+       (d_reorthog == 2) )
+  {
+    // summarized from kelley:
+    //  if the new vector (i.e. v[k+1]) is very small relative to
+    //  A*v[k], then information might be lost so reorthogonalize.  the
+    //  delta of 0.001 is what kelley uses in his test code.
+
+    if (d_monitor_level > 1) cout << " reorthog ... " << endl;
+    for (int j = 0; j < k; ++j)
+    {
+      double hr = d_v[j]->dot(w);
+      d_H[j][k] += hr;
+      w.add_a_times_x(-hr, *d_v[j]);
+    }
+    d_H[k+1][k] = w.norm();
+  }
+}
+
+//---------------------------------------------------------------------------//
 inline void GMRES::apply_givens(const int k)
 {
   Require(k < d_restart);
@@ -76,8 +76,7 @@ inline void GaussSeidel::solve_impl(const Vector &b, Vector &x)
     if (d_omega != 1.0)
     {
       // x1 <-- (1-w)*x0 + w*x1
-      x1->scale(d_omega);
-      x1->add_a_times_x((1.0-d_omega), *x0);
+      x1->axpby((1.0-d_omega), *x0, d_omega);
     }
 
     //---------------------------------------------------//
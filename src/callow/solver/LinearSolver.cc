@@ -8,6 +8,7 @@
 
 #include "LinearSolver.hh"
 // preconditioners
+#include "callow/preconditioner/PCAMG.hh"
 #include "callow/preconditioner/PCILU0.hh"
 #include "callow/preconditioner/PCJacobi.hh"
 
@@ -64,14 +65,32 @@ set_operators(SP_matrix A,
       pc_type = d_db->get<std::string>("pc_type");
     if (pc_type == "ilu0")
     {
-      d_P = new PCILU0(d_A);
+      std::string ilu0_type = "serial";
+      int number_blocks = 0;
+      if (d_db->check("pc_ilu0_type"))
+        ilu0_type = d_db->get<std::string>("pc_ilu0_type");
+      if (d_db->check("pc_ilu0_number_blocks"))
+        number_blocks = d_db->get<int>("pc_ilu0_number_blocks");
+      int type = PCILU0::SERIAL;
+      if (ilu0_type == "level")
+        type = PCILU0::LEVEL;
+      else if (ilu0_type == "block")
+        type = PCILU0::BLOCK;
+      else if (ilu0_type != "serial")
+        THROW("Unsupported ILU0 type: " + ilu0_type);
+      d_P = new PCILU0(d_A, type, number_blocks);
     }
     else if (pc_type == "jacobi")
     {
       d_P = new PCJacobi(d_A);
     }
+    else if (pc_type == "amg")
+    {
+      d_P = new PCAMG(d_A, d_db);
+    }
     if(d_db->check("pc_side"))
       pc_side = d_db->get<int>("pc_side");
+    if (d_P) d_pc_side = pc_side;
   }
 
 }
@@ -58,7 +58,7 @@ namespace callow
  *    - Jacobi
  *    - Gauss-Seidel
  *    - GMRES(m)
- *  along with Jacobi and ILU0 preconditioners.  If PETSc is enabled,
+ *  along with Jacobi, ILU0, and AMG preconditioners.  If PETSc is enabled,
  *  all of its solvers are potentially available.
  *
  *  Note, some linear solvers require that the matrix provides L, U, and
@@ -110,6 +110,15 @@ public:
   /**
    *  Sets the operators for the linear system to solve.
    *
+   *  If the db sets pc_type to "ilu0", "jacobi", or "amg" (see PCAMG
+   *  for its entries), that preconditioner is built and applied on the
+   *  side given by pc_side (LEFT by default).  This includes the
+   *  diffusion solves of DSA and MGDSA when their db sets a pc_type.
+   *  The ILU(0) variant is set by pc_ilu0_type, which is "serial" (the
+   *  default), "level" for level-scheduled threaded substitutions, or
+   *  "block" for block Jacobi with ILU(0) on pc_ilu0_number_blocks
+   *  blocks (by default, PCILU0::DEFAULT_NUMBER_BLOCKS).
+   *
    *  @param A      linear operator
    *  @param P      optional preconditioning process
    *  @param side   specifies on what side of A the preconditioner operates
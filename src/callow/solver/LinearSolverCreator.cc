@@ -33,6 +33,7 @@ LinearSolverCreator::Create(SP_db db)
   bool monitor_diverge = false;
   double omega = 1.0;
   int restart = 30;
+  int orthog = GMRES::MGS;
 
   if (db)
   {
@@ -58,11 +59,22 @@ LinearSolverCreator::Create(SP_db db)
     {
       omega = db->get<double>("linear_solver_sor_omega");
     }
-    if (solver_type == "gmres" &&
+    if ((solver_type == "gmres" || solver_type == "pgmres") &&
         db->check("linear_solver_gmres_restart"))
     {
       restart = db->get<int>("linear_solver_gmres_restart");
     }
+    if (solver_type == "gmres" &&
+        db->check("linear_solver_gmres_orthog"))
+    {
+      std::string orthog_type = db->get<std::string>("linear_solver_gmres_orthog");
+      if (orthog_type == "mgs")
+        orthog = GMRES::MGS;
+      else if (orthog_type == "cgs2")
+        orthog = GMRES::CGS2;
+      else
+        THROW("Unsupported GMRES orthogonalization: " + orthog_type);
+    }
   }
 
 //  std::cout << " CALLOW:" << std::endl;
@@ -98,7 +110,12 @@ LinearSolverCreator::Create(SP_db db)
   //---------------------------------------------------------------------------//
   else if (solver_type == "gmres")
   {
-    solver = new GMRES(atol, rtol, maxit, restart);
+    solver = new GMRES(atol, rtol, maxit, restart, orthog);
+  }
+  //---------------------------------------------------------------------------//
+  else if (solver_type == "pgmres")
+  {
+    solver = new GMRES(atol, rtol, maxit, restart, GMRES::PIPELINED);
   }
 
   //---------------------------------------------------------------------------//
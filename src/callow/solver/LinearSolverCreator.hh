@@ -40,6 +40,12 @@ public:
 
   /**
    *  @brief Create a linear solver
+   *
+   *  The GMRES solvers are "gmres", whose orthogonalization is set by
+   *  linear_solver_gmres_orthog ("mgs", the default, or "cgs2"), and
+   *  "pgmres", the pipelined variant.  Both take their restart from
+   *  linear_solver_gmres_restart.
+   *
    *  @param  db  Pointer to parameter database
    */
   static SP_solver Create(SP_db db = SP_db(0));
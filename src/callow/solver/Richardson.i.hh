@@ -70,12 +70,10 @@ inline void Richardson::solve_impl(const Vector &b, Vector &x)
       // X1 <-- w * X1 = w * A * X0
       x1->scale(d_omega);
 	}
-    // X1 <-- X1 - X0 =  (A - I) * X0
-    x1->subtract(*x0);
-    // X1 <-- X1 - b = (A - I) * X0 - b
-    x1->subtract(B);
-    // X1 <-- -X1 = (I - A) * X0 + b
-    x1->scale(-1);
+    // X1 <-- X0 - X1 = (I - A) * X0
+    x1->axpby(1.0, *x0, -1.0);
+    // X1 <-- X1 + b = (I - A) * X0 + b
+    x1->add(B);
 
     //---------------------------------------------------//
     // compute residual norm
@@ -14,6 +14,11 @@
         FUNC(test_GaussSeidel) \
         FUNC(test_SOR)         \
         FUNC(test_GMRES)       \
+        FUNC(test_GMRES_CGS2)  \
+        FUNC(test_GMRES_pipelined) \
+        FUNC(test_PCILU0)      \
+        FUNC(test_GMRES_db_pc) \
+        FUNC(test_PCAMG)       \
         FUNC(test_PetscSolver)
 
 #include "utilities/TestDriver.hh"
@@ -31,9 +36,13 @@
 #include "callow/preconditioner/PCJacobi.hh"
 #include "callow/preconditioner/PCILU0.hh"
 #include "callow/preconditioner/PCIdentity.hh"
+#include "callow/preconditioner/PCAMG.hh"
 //
 #include "callow/test/matrix_fixture.hh"
 #include <iostream>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 using namespace callow;
 using namespace detran_test;
@@ -228,6 +237,304 @@ int test_GMRES(int argc, char *argv[])
   return 0;
 }
 
+// Solve with a GMRES variant without and with preconditioning, and then
+// solve a larger system whose basis vectors are split among threads,
+// comparing to the default GMRES.
+bool check_gmres(const std::string &type, const std::string &orthog)
+{
+  GMRES::SP_matrix A = test_matrix_1(n);
+  Vector X(n, 0.0);
+  Vector B(n, 1.0);
+  db = get_db();
+  db->put<std::string>("linear_solver_type", type);
+  db->put<std::string>("linear_solver_gmres_orthog", orthog);
+  db->put<int>("linear_solver_maxit", 50);
+  db->put<int>("linear_solver_gmres_restart", 16);
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(A);
+
+  Preconditioner::SP_preconditioner pc[3];
+  pc[1] = new PCILU0(A);
+  pc[2] = new PCJacobi(A);
+  for (int p = 0; p < 3; ++p)
+  {
+    for (int side = 0; side < (p ? 2 : 1); ++side)
+    {
+      if (pc[p]) solver->set_preconditioner(pc[p], side);
+      X.set(0.0);
+      if (solver->solve(B, X)) return false;
+      for (int i = 0; i < n; ++i)
+        if (!soft_equiv(X[i], X_ref[i], 1e-9)) return false;
+    }
+  }
+
+  int m = 20000;
+  Vector Y(m, 0.0);
+  Vector Y_ref(m, 0.0);
+  Vector C(m, 1.0);
+  db->put<int>("linear_solver_maxit", 500);
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(test_matrix_1(m));
+  if (solver->solve(C, Y)) return false;
+  db->put<std::string>("linear_solver_type", "gmres");
+  db->put<std::string>("linear_solver_gmres_orthog", "mgs");
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(test_matrix_1(m));
+  if (solver->solve(C, Y_ref)) return false;
+  for (int i = 0; i < m; ++i)
+    if (!soft_equiv(Y[i], Y_ref[i], 1e-9)) return false;
+  return true;
+}
+
+int test_GMRES_CGS2(int argc, char *argv[])
+{
+  TEST(check_gmres("gmres", "cgs2"));
+  return 0;
+}
+
+int test_GMRES_pipelined(int argc, char *argv[])
+{
+  TEST(check_gmres("pgmres", "mgs"));
+
+  // A restart longer than the system is clamped to its size.
+  int m = 5;
+  Vector Y(m, 0.0);
+  Vector Y_ref(m, 0.0);
+  Vector C(m, 1.0);
+  db = get_db();
+  db->put<std::string>("linear_solver_type", "pgmres");
+  db->put<int>("linear_solver_gmres_restart", 16);
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(test_matrix_1(m));
+  TEST(solver->solve(C, Y) == 0);
+  db->put<std::string>("linear_solver_type", "gmres");
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(test_matrix_1(m));
+  TEST(solver->solve(C, Y_ref) == 0);
+  for (int i = 0; i < m; ++i)
+    TEST(soft_equiv(Y[i], Y_ref[i], 1e-9));
+  return 0;
+}
+
+// ILU(0) of a tridiagonal matrix is its exact LU factorization, and the
+// level-scheduled variant must reproduce the serial one exactly.  Block
+// Jacobi ILU(0) is only an approximation, but GMRES must still converge.
+int test_PCILU0(int argc, char *argv[])
+{
+  Vector X(n, 0.0);
+  Vector B(n, 1.0);
+  for (int type = PCILU0::SERIAL; type <= PCILU0::LEVEL; ++type)
+  {
+    PCILU0 P(test_matrix_1(n), type);
+    X.set(0.0);
+    P.apply(B, X);
+    for (int i = 0; i < n; ++i)
+      TEST(soft_equiv(X[i], X_ref[i], 1e-9));
+    if (type == PCILU0::LEVEL)
+    {
+      TEST(P.number_lower_levels() == n);
+      TEST(P.number_upper_levels() == n);
+    }
+  }
+
+  Matrix::SP_matrix A = test_matrix_2(20);
+  int m = A->number_rows();
+  Vector Y(m, 0.0), Y_level(m, 0.0), C(m, 1.0);
+  PCILU0 P(A);
+  P.apply(C, Y);
+  PCILU0 P_level(A, PCILU0::LEVEL);
+  P_level.apply(C, Y_level);
+  TEST(P_level.number_lower_levels() < m);
+  for (int i = 0; i < m; ++i)
+    TEST(Y_level[i] == Y[i]);
+
+  // The default block count is fixed, so the block variant gives the
+  // same result for any number of threads.
+  Vector Y_block(m, 0.0);
+#ifdef DETRAN_ENABLE_OPENMP
+  int number_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+#endif
+  PCILU0 P_block(A, PCILU0::BLOCK);
+  P_block.apply(C, Y_block);
+#ifdef DETRAN_ENABLE_OPENMP
+  omp_set_num_threads(4);
+#endif
+  PCILU0 P_block_4(A, PCILU0::BLOCK);
+  P_block_4.apply(C, Y_level);
+#ifdef DETRAN_ENABLE_OPENMP
+  omp_set_num_threads(number_threads);
+#endif
+  TEST(P_block.number_blocks() == PCILU0::DEFAULT_NUMBER_BLOCKS);
+  for (int i = 0; i < m; ++i)
+    TEST(Y_level[i] == Y_block[i]);
+
+  // GMRES preconditioned by the serial and block variants via the db
+  db = get_db();
+  db->put<std::string>("linear_solver_type", "gmres");
+  db->put<int>("linear_solver_gmres_restart", 30);
+  db->put<std::string>("pc_type", "ilu0");
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(A, db);
+  Y.set(0.0);
+  TEST(solver->solve(C, Y) == 0);
+  int number_iterations = solver->number_iterations();
+  db->put<std::string>("pc_ilu0_type", "block");
+  db->put<int>("pc_ilu0_number_blocks", 4);
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(A, db);
+  Y_level.set(0.0);
+  TEST(solver->solve(C, Y_level) == 0);
+  TEST(solver->number_iterations() >= number_iterations);
+  for (int i = 0; i < m; ++i)
+    TEST(soft_equiv(Y_level[i], Y[i], 1e-9));
+  return 0;
+}
+
+// A preconditioner named in the db is applied.  ILU(0) is exact for
+// the tridiagonal test matrix, so GMRES converges in one iteration.
+int test_GMRES_db_pc(int argc, char *argv[])
+{
+  Vector X(n, 0.0);
+  Vector B(n, 1.0);
+  db = get_db();
+  db->put<std::string>("linear_solver_type", "gmres");
+  db->put<int>("linear_solver_maxit", 50);
+  db->put<int>("linear_solver_gmres_restart", 16);
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(test_matrix_1(n), db);
+  int status = solver->solve(B, X);
+  TEST(status == 0);
+  int number_iterations = solver->number_iterations();
+
+  db->put<std::string>("pc_type", "ilu0");
+  X.set(0.0);
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(test_matrix_1(n), db);
+  status = solver->solve(B, X);
+  TEST(status == 0);
+  TEST(solver->number_iterations() <= 2);
+  TEST(solver->number_iterations() < number_iterations);
+  for (int i = 0; i < n; ++i)
+    TEST(soft_equiv(X[i], X_ref[i], 1e-9));
+  return 0;
+}
+
+// One-group diffusion on a k x k grid of unit cells with vacuum edges.
+Matrix::SP_matrix diffusion_matrix(const int k)
+{
+  double D = 1.0, sigma_a = 0.01;
+  Matrix::SP_matrix A(new Matrix(k * k, k * k, 5));
+  for (int j = 0; j < k; ++j)
+  {
+    for (int i = 0; i < k; ++i)
+    {
+      int row = i + j * k;
+      double diag = sigma_a;
+      int neighbor[] = {i > 0     ? row - 1 : -1, i < k - 1 ? row + 1 : -1,
+                        j > 0     ? row - k : -1, j < k - 1 ? row + k : -1};
+      for (int f = 0; f < 4; ++f)
+      {
+        if (neighbor[f] >= 0)
+        {
+          A->insert(row, neighbor[f], -D);
+          diag += D;
+        }
+        else
+        {
+          diag += 2.0 * D / (1.0 + 4.0 * D);
+        }
+      }
+      A->insert(row, row, diag);
+    }
+  }
+  A->assemble();
+  return A;
+}
+
+// With AMG, the GMRES iterations must stay nearly flat as the mesh is
+// refined, and the solutions must match those preconditioned by ILU(0).
+int test_PCAMG(int argc, char *argv[])
+{
+  const char *smoother[] = {"gs", "jacobi"};
+  for (int s = 0; s < 2; ++s)
+  {
+    int number_iterations[3];
+    for (int r = 0; r < 3; ++r)
+    {
+      int k = 16 << r;
+      Matrix::SP_matrix A = diffusion_matrix(k);
+      int m = A->number_rows();
+      Vector X(m, 0.0), X_ref(m, 0.0), B(m, 1.0);
+
+      db = get_db();
+      db->put<int>("linear_solver_monitor_level", 1);
+      db->put<double>("linear_solver_atol", 1e-12);
+      db->put<double>("linear_solver_rtol", 1e-12);
+      db->put<std::string>("linear_solver_type", "gmres");
+      db->put<int>("linear_solver_gmres_restart", 30);
+      db->put<std::string>("pc_type", "ilu0");
+      solver = LinearSolverCreator::Create(db);
+      solver->set_operators(A, db);
+      TEST(solver->solve(B, X_ref) == 0);
+
+      db->put<std::string>("pc_type", "amg");
+      db->put<std::string>("pc_amg_smoother", smoother[s]);
+      db->put<int>("pc_amg_coarse_size", 50);
+      solver = LinearSolverCreator::Create(db);
+      solver->set_operators(A, db);
+      TEST(solver->solve(B, X) == 0);
+      number_iterations[r] = solver->number_iterations();
+      for (int i = 0; i < m; ++i)
+        TEST(soft_equiv(X[i], X_ref[i], 1e-8));
+
+      PCAMG P(A, db);
+      printf(" k = %3i: %i levels, operator complexity %5.3f \n",
+             k, P.number_levels(), P.operator_complexity());
+      TEST(P.number_levels() > 1);
+      TEST(P.level_size(P.number_levels() - 1) <= 50);
+    }
+    TEST(number_iterations[2] <= number_iterations[0] + 6);
+  }
+
+  // a coarsest level too large for dense LU, because the level limit is
+  // reached or because no coupling is strong, falls back to ILU(0)
+  Matrix::SP_matrix A = diffusion_matrix(70);
+  int m = A->number_rows();
+  TEST(m > PCAMG::MAX_DENSE_SIZE);
+  Vector X(m, 0.0), X_ref(m, 0.0), B(m, 1.0);
+  db = get_db();
+  db->put<int>("linear_solver_monitor_level", 1);
+  db->put<double>("linear_solver_atol", 1e-12);
+  db->put<double>("linear_solver_rtol", 1e-12);
+  db->put<int>("linear_solver_maxit", 2000);
+  db->put<std::string>("linear_solver_type", "gmres");
+  db->put<int>("linear_solver_gmres_restart", 30);
+  db->put<std::string>("pc_type", "ilu0");
+  solver = LinearSolverCreator::Create(db);
+  solver->set_operators(A, db);
+  TEST(solver->solve(B, X_ref) == 0);
+  for (int c = 0; c < 2; ++c)
+  {
+    db->put<std::string>("pc_type", "amg");
+    if (c == 0)
+      db->put<int>("pc_amg_levels", 1);
+    else
+      db->put<double>("pc_amg_strength", 10.0);
+    PCAMG P(A, db);
+    TEST(P.number_levels() == 1);
+    TEST(!P.coarse_direct());
+    solver = LinearSolverCreator::Create(db);
+    solver->set_operators(A, db);
+    X.set(0.0);
+    TEST(solver->solve(B, X) == 0);
+    for (int i = 0; i < m; ++i)
+      TEST(soft_equiv(X[i], X_ref[i], 1e-8));
+    db->put<int>("pc_amg_levels", 10);
+  }
+  return 0;
+}
+
 int test_PetscSolver(int argc, char *argv[])
 {
 #ifdef CALLOW_ENABLE_PETSC
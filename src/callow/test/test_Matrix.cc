@@ -8,13 +8,19 @@
 //---------------------------------------------------------------------------//
 
 // LIST OF TEST FUNCTIONS
-#define TEST_LIST         \
-        FUNC(test_Matrix)
+#define TEST_LIST                 \
+        FUNC(test_Matrix)         \
+        FUNC(test_Matrix_threaded) \
+        FUNC(test_Matrix_sell)
 
 #include "TestDriver.hh"
 #include "matrix/Matrix.hh"
 #include "utils/Initialization.hh"
+#include <cstdlib>
 #include <iostream>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 using namespace callow;
 using namespace detran_test;
@@ -173,6 +179,139 @@ int test_Matrix(int argc, char *argv[])
   return 0;
 }
 
+// Matrix with rows of very different length, so that blocks of equal
+// rows would hold very different numbers of nonzeros.
+Matrix::SP_matrix uneven_matrix(const int m, const int n)
+{
+  std::vector<int> nnz(m, 0);
+  for (int i = 0; i < m; ++i)
+    nnz[i] = i % 17 ? 3 : std::min(n, 40);
+  Matrix::SP_matrix A(new Matrix(m, n));
+  A->preallocate(&nnz[0]);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int k = 0; k < nnz[i]; ++k)
+    {
+      int j = (i * 7 + k * 13) % n;
+      A->insert(i, j, 1.0 + 0.01 * i - 0.003 * j, Matrix::ADD);
+    }
+  }
+  A->assemble();
+  return A;
+}
+
+// Serial reference products
+void reference_multiply(Matrix &A, const Vector &x, Vector &y, bool trans)
+{
+  y.set(0.0);
+  for (int i = 0; i < A.number_rows(); ++i)
+  {
+    for (int p = A.start(i); p < A.end(i); ++p)
+    {
+      if (trans)
+        y[A.column(p)] += A[p] * x[i];
+      else
+        y[i] += A[p] * x[A.column(p)];
+    }
+  }
+}
+
+// Threaded products must match the serial ones for any thread count.
+int test_Matrix_threaded(int argc, char *argv[])
+{
+  int m = 301, n = 257;
+  Matrix::SP_matrix A = uneven_matrix(m, n);
+
+  // The row blocks cover all rows and hold similar numbers of nonzeros.
+  for (int nt = 1; nt <= 5; ++nt)
+  {
+    TEST(A->partition(0, nt) == 0);
+    TEST(A->partition(nt, nt) == m);
+    for (int t = 0; t < nt; ++t)
+    {
+      int i0 = A->partition(t, nt), i1 = A->partition(t + 1, nt);
+      TEST(i0 <= i1);
+      int nnz = A->rows()[i1] - A->rows()[i0];
+      TEST(std::abs(nnz - A->number_nonzeros() / nt) <= 50);
+    }
+  }
+
+  Vector x(n, 0.0), x_t(m, 0.0);
+  for (int j = 0; j < n; ++j)
+    x[j] = 1.0 + 0.1 * (j % 11);
+  for (int i = 0; i < m; ++i)
+    x_t[i] = 2.0 - 0.05 * (i % 7);
+  Vector y_ref(m, 0.0), y_t_ref(n, 0.0);
+  reference_multiply(*A, x, y_ref, false);
+  reference_multiply(*A, x_t, y_t_ref, true);
+
+  int number_threads[] = {1, 2, 3, 4};
+  for (int k = 0; k < 4; ++k)
+  {
+#ifdef DETRAN_ENABLE_OPENMP
+    omp_set_num_threads(number_threads[k]);
+#endif
+    Vector y(m, 1.0), y_t(n, 1.0);
+    A->multiply(x, y);
+    A->multiply_transpose(x_t, y_t);
+    for (int i = 0; i < m; ++i)
+      TEST(soft_equiv(y[i], y_ref[i]));
+    for (int j = 0; j < n; ++j)
+      TEST(soft_equiv(y_t[j], y_t_ref[j]));
+  }
+#ifdef DETRAN_ENABLE_OPENMP
+  omp_set_num_threads(1);
+#endif
+
+  return 0;
+}
+
+// The sliced ELLPACK product must match the CSR one.
+int test_Matrix_sell(int argc, char *argv[])
+{
+  int m = 301, n = 257;
+  Matrix::SP_matrix A = uneven_matrix(m, n);
+  Vector x(n, 0.0);
+  for (int j = 0; j < n; ++j)
+    x[j] = 1.0 + 0.1 * (j % 11);
+  Vector y_ref(m, 0.0);
+  A->multiply(x, y_ref);
+
+  int chunk[] = {1, 4, 8, 32};
+  int sigma[] = {1, 8, 64, 301};
+  for (int c = 0; c < 4; ++c)
+  {
+    for (int s = 0; s < 4; ++s)
+    {
+      A->set_sliced_ellpack(chunk[c], sigma[s]);
+      TEST(A->sliced_ellpack());
+      Vector y(m, 1.0);
+      A->multiply(x, y);
+      for (int i = 0; i < m; ++i)
+        TEST(soft_equiv(y[i], y_ref[i]));
+    }
+  }
+  A->set_sliced_ellpack(0);
+  TEST(!A->sliced_ellpack());
+
+  // Requested before assembly, the copy is built by assemble.
+  Matrix B(3, 3);
+  B.preallocate(2);
+  B.insert(0, 0, 1.0);
+  B.insert(1, 1, 2.0);
+  B.insert(1, 2, 3.0);
+  B.insert(2, 0, 4.0);
+  B.set_sliced_ellpack(2, 3);
+  B.assemble();
+  Vector x_b(3, 1.0), y_b(3, 0.0);
+  B.multiply(x_b, y_b);
+  TEST(soft_equiv(y_b[0], 1.0));
+  TEST(soft_equiv(y_b[1], 5.0));
+  TEST(soft_equiv(y_b[2], 4.0));
+
+  return 0;
+}
+
 //---------------------------------------------------------------------------//
 //              end of test_Matrix.cc
 //---------------------------------------------------------------------------//
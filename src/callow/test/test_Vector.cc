@@ -10,12 +10,17 @@
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST               \
         FUNC(test_Vector)       \
-        FUNC(test_Vector_resize)
+        FUNC(test_Vector_resize)\
+        FUNC(test_Vector_fused) \
+        FUNC(test_Vector_benchmark)
 
 #include "TestDriver.hh"
 #include "callow/vector/Vector.hh"
 #include "callow/utils/Initialization.hh"
 #include "utilities/Definitions.hh"
+#include "utilities/Timer.hh"
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
 
 using namespace callow;
@@ -97,6 +102,169 @@ int test_Vector_resize(int argc, char *argv[])
   return 0;
 }
 
+// Fill a vector with values that vary by element and seed.
+void fill(Vector &v, const int seed)
+{
+  for (int i = 0; i < v.size(); ++i)
+    v[i] = 1.0 + 0.5 * std::sin(0.01 * (i + 1) * (seed + 1));
+}
+
+// The fused operations must match their unfused equivalents, for
+// vectors shorter and longer than one reduction block.
+int test_Vector_fused(int argc, char *argv[])
+{
+  int sizes[] = {10, 3 * Vector::BLOCK_SIZE + 17};
+  for (int s = 0; s < 2; ++s)
+  {
+    int n = sizes[s];
+    Vector x(n, 0.0), y(n, 0.0), w(n, 0.0), ref(n, 0.0);
+    fill(x, 0);
+    fill(y, 1);
+
+    // axpby
+    w.copy(y);
+    w.axpby(2.0, x, -3.0);
+    for (int i = 0; i < n; ++i)
+      TEST(soft_equiv(w[i], 2.0 * x[i] - 3.0 * y[i]));
+
+    // waxpy
+    w.waxpy(-0.5, x, y);
+    for (int i = 0; i < n; ++i)
+      TEST(soft_equiv(w[i], y[i] - 0.5 * x[i]));
+
+    // dot and norm
+    double xy = 0.0, yy = 0.0;
+    for (int i = 0; i < n; ++i)
+    {
+      xy += x[i] * y[i];
+      yy += y[i] * y[i];
+    }
+    double norm = 0.0;
+    double dot = y.dot_norm(x, norm);
+    TEST(soft_equiv(dot, xy));
+    TEST(soft_equiv(norm, std::sqrt(yy)));
+    TEST(soft_equiv(y.dot(x), xy));
+    TEST(soft_equiv(y.norm(L2), std::sqrt(yy)));
+
+    // multi-dot and multi-axpy against a block of five vectors
+    std::vector<Vector::SP_vector> V(5);
+    for (int j = 0; j < 5; ++j)
+    {
+      V[j] = new Vector(n, 0.0);
+      fill(*V[j], j + 2);
+    }
+    double h[3], ww = 0.0;
+    y.multi_dot(V, 1, 3, h, &ww);
+    for (int j = 0; j < 3; ++j)
+      TEST(soft_equiv(h[j], V[j + 1]->dot(y)));
+    TEST(soft_equiv(ww, yy));
+    ref.copy(y);
+    for (int j = 0; j < 3; ++j)
+      ref.add_a_times_x(-h[j], *V[j + 1]);
+    y.multi_axpy(V, 1, 3, h, -1.0);
+    for (int i = 0; i < n; ++i)
+      TEST(soft_equiv(y[i], ref[i]));
+  }
+  return 0;
+}
+
+// Time the fused operations against the chains of single operations
+// they replace, for vectors well beyond cache.
+int test_Vector_benchmark(int argc, char *argv[])
+{
+  int n = 2000000;
+  int number_repeats = 10;
+  int k = 10;
+  Vector x(n, 0.0), y(n, 0.0), w(n, 0.0);
+  fill(x, 0);
+  fill(y, 1);
+  std::vector<Vector::SP_vector> V(k);
+  for (int j = 0; j < k; ++j)
+  {
+    V[j] = new Vector(n, 0.0);
+    fill(*V[j], j + 2);
+  }
+  std::vector<double> h(k, 0.0), h_ref(k, 0.0);
+  detran_utilities::Timer timer;
+
+  // w <-- x - w as subtract and scale, and as axpby
+  w.copy(y);
+  timer.tic();
+  for (int r = 0; r < number_repeats; ++r)
+  {
+    w.subtract(x);
+    w.scale(-1.0);
+  }
+  double time_ref = timer.toc();
+  double sum_ref = w[n / 2];
+  w.copy(y);
+  timer.tic();
+  for (int r = 0; r < number_repeats; ++r)
+    w.axpby(1.0, x, -1.0);
+  double time = timer.toc();
+  TEST(soft_equiv(w[n / 2], sum_ref));
+  printf("             subtract, scale: %10.3e s \n", time_ref);
+  printf("                       axpby: %10.3e s (speedup %6.2f) \n",
+         time, time_ref / std::max(time, 1.0e-12));
+
+  // dot and norm, separately and fused
+  double dot_ref = 0.0, norm_ref = 0.0, dot = 0.0, norm = 0.0;
+  timer.tic();
+  for (int r = 0; r < number_repeats; ++r)
+  {
+    dot_ref = y.dot(x);
+    norm_ref = y.norm(L2);
+  }
+  time_ref = timer.toc();
+  timer.tic();
+  for (int r = 0; r < number_repeats; ++r)
+    dot = y.dot_norm(x, norm);
+  time = timer.toc();
+  TEST(soft_equiv(dot, dot_ref));
+  TEST(soft_equiv(norm, norm_ref));
+  printf("                   dot, norm: %10.3e s \n", time_ref);
+  printf("                    dot_norm: %10.3e s (speedup %6.2f) \n",
+         time, time_ref / std::max(time, 1.0e-12));
+
+  // k inner products, one at a time and fused
+  timer.tic();
+  for (int r = 0; r < number_repeats; ++r)
+    for (int j = 0; j < k; ++j)
+      h_ref[j] = y.dot(*V[j]);
+  time_ref = timer.toc();
+  timer.tic();
+  for (int r = 0; r < number_repeats; ++r)
+    y.multi_dot(V, 0, k, &h[0]);
+  time = timer.toc();
+  for (int j = 0; j < k; ++j)
+    TEST(soft_equiv(h[j], h_ref[j]));
+  printf("                  %2i x dot: %10.3e s \n", k, time_ref);
+  printf("                   multi_dot: %10.3e s (speedup %6.2f) \n",
+         time, time_ref / std::max(time, 1.0e-12));
+
+  // k updates, one at a time and fused
+  w.copy(y);
+  timer.tic();
+  for (int r = 0; r < number_repeats; ++r)
+    for (int j = 0; j < k; ++j)
+      w.add_a_times_x(1.0e-3 * h[j], *V[j]);
+  time_ref = timer.toc();
+  sum_ref = w[n / 2];
+  w.copy(y);
+  for (int j = 0; j < k; ++j)
+    h[j] *= 1.0e-3;
+  timer.tic();
+  for (int r = 0; r < number_repeats; ++r)
+    w.multi_axpy(V, 0, k, &h[0]);
+  time = timer.toc();
+  TEST(soft_equiv(w[n / 2], sum_ref));
+  printf("        %2i x add_a_times_x: %10.3e s \n", k, time_ref);
+  printf("                  multi_axpy: %10.3e s (speedup %6.2f) \n",
+         time, time_ref / std::max(time, 1.0e-12));
+
+  return 0;
+}
+
 //---------------------------------------------------------------------------//
 //              end of test_Vector.cc
 //---------------------------------------------------------------------------//
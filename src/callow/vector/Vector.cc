@@ -8,6 +8,8 @@
 //---------------------------------------------------------------------------//
 
 #include "Vector.hh"
+#include <algorithm>
+#include <cmath>
 
 namespace callow
 {
@@ -195,6 +197,204 @@ void Vector::resize(const int n, const double v)
 #endif
 }
 
+//---------------------------------------------------------------------------//
+// FUSED VECTOR OPERATIONS
+//---------------------------------------------------------------------------//
+
+/*
+ *  The reductions below sum each block of BLOCK_SIZE elements into its
+ *  own partial sum, and the partial sums are then added in block order.
+ *  Threads share out the blocks, but since no partial sum depends on
+ *  which thread computed it, the result is the same for any number of
+ *  threads.  Short vectors are summed in one block without a parallel
+ *  region or any allocation.
+ */
+
+//---------------------------------------------------------------------------//
+double Vector::blocked_dot(const double *a, const double *b, const int n)
+{
+  if (n <= BLOCK_SIZE)
+  {
+    double val = 0.0;
+    #pragma omp simd reduction(+:val)
+    for (int i = 0; i < n; ++i)
+      val += a[i] * b[i];
+    return val;
+  }
+  const int number_blocks = (n + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  std::vector<double> partial(number_blocks, 0.0);
+  #pragma omp parallel for default(shared)
+  for (int k = 0; k < number_blocks; ++k)
+  {
+    const int i_end = std::min(n, (k + 1) * BLOCK_SIZE);
+    double val = 0.0;
+    #pragma omp simd reduction(+:val)
+    for (int i = k * BLOCK_SIZE; i < i_end; ++i)
+      val += a[i] * b[i];
+    partial[k] = val;
+  }
+  double val = 0.0;
+  for (int k = 0; k < number_blocks; ++k)
+    val += partial[k];
+  return val;
+}
+
+//---------------------------------------------------------------------------//
+double Vector::dot_norm(const Vector& x, double &norm)
+{
+  Require(x.size() == d_size);
+  const double *x_v = x.d_value;
+  const double *y_v = d_value;
+  const int number_blocks = std::max(1, (d_size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  double partial_small[2] = {0.0, 0.0};
+  std::vector<double> partial_large;
+  double *partial = partial_small;
+  if (number_blocks > 1)
+  {
+    partial_large.assign(2 * number_blocks, 0.0);
+    partial = &partial_large[0];
+  }
+  #pragma omp parallel for default(shared) if (number_blocks > 1)
+  for (int k = 0; k < number_blocks; ++k)
+  {
+    const int i_end = std::min(d_size, (k + 1) * BLOCK_SIZE);
+    double xy = 0.0, yy = 0.0;
+    #pragma omp simd reduction(+:xy,yy)
+    for (int i = k * BLOCK_SIZE; i < i_end; ++i)
+    {
+      xy += x_v[i] * y_v[i];
+      yy += y_v[i] * y_v[i];
+    }
+    partial[2 * k]     = xy;
+    partial[2 * k + 1] = yy;
+  }
+  double xy = 0.0, yy = 0.0;
+  for (int k = 0; k < number_blocks; ++k)
+  {
+    xy += partial[2 * k];
+    yy += partial[2 * k + 1];
+  }
+  norm = std::sqrt(yy);
+  return xy;
+}
+
+//---------------------------------------------------------------------------//
+void Vector::multi_dot(const std::vector<SP_vector> &x,
+                       const int                     first,
+                       const int                     k,
+                       double                       *h,
+                       double                       *ww)
+{
+  Require(first >= 0);
+  Require(first + k <= (int)x.size());
+  const int m = k + 1;
+  const double *y_v = d_value;
+  const int number_blocks = std::max(1, (d_size + BLOCK_SIZE - 1) / BLOCK_SIZE);
+  std::vector<const double*> x_v(m, (const double*)0);
+  for (int j = 0; j < k; ++j)
+  {
+    Require(x[first + j]);
+    Require(x[first + j]->size() == d_size);
+    x_v[j] = x[first + j]->d_value;
+  }
+  std::vector<double> partial(number_blocks * m, 0.0);
+  #pragma omp parallel for default(shared) if (number_blocks > 1)
+  for (int b = 0; b < number_blocks; ++b)
+  {
+    const int i_begin = b * BLOCK_SIZE;
+    const int i_end = std::min(d_size, i_begin + BLOCK_SIZE);
+    double *p = &partial[b * m];
+    // pairs of vectors share each load of this vector
+    int j = 0;
+    for (; j + 1 < k; j += 2)
+    {
+      const double *x_0 = x_v[j];
+      const double *x_1 = x_v[j + 1];
+      double val_0 = 0.0, val_1 = 0.0;
+      #pragma omp simd reduction(+:val_0,val_1)
+      for (int i = i_begin; i < i_end; ++i)
+      {
+        val_0 += x_0[i] * y_v[i];
+        val_1 += x_1[i] * y_v[i];
+      }
+      p[j]     = val_0;
+      p[j + 1] = val_1;
+    }
+    for (; j < k; ++j)
+    {
+      const double *x_j = x_v[j];
+      double val = 0.0;
+      #pragma omp simd reduction(+:val)
+      for (int i = i_begin; i < i_end; ++i)
+        val += x_j[i] * y_v[i];
+      p[j] = val;
+    }
+    if (ww)
+    {
+      double val = 0.0;
+      #pragma omp simd reduction(+:val)
+      for (int i = i_begin; i < i_end; ++i)
+        val += y_v[i] * y_v[i];
+      p[k] = val;
+    }
+  }
+  for (int j = 0; j < k; ++j)
+    h[j] = 0.0;
+  if (ww) *ww = 0.0;
+  for (int b = 0; b < number_blocks; ++b)
+  {
+    for (int j = 0; j < k; ++j)
+      h[j] += partial[b * m + j];
+    if (ww) *ww += partial[b * m + k];
+  }
+}
+
+//---------------------------------------------------------------------------//
+void Vector::multi_axpy(const std::vector<SP_vector> &x,
+                        const int                     first,
+                        const int                     k,
+                        const double                 *a,
+                        const double                  alpha)
+{
+  Require(first >= 0);
+  Require(first + k <= (int)x.size());
+  std::vector<const double*> x_v(k, (const double*)0);
+  for (int j = 0; j < k; ++j)
+  {
+    Require(x[first + j]);
+    Require(x[first + j]->size() == d_size);
+    x_v[j] = x[first + j]->d_value;
+  }
+  double *y_v = d_value;
+  const int number_blocks = (d_size + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  #pragma omp parallel for default(shared) if (number_blocks > 1)
+  for (int b = 0; b < number_blocks; ++b)
+  {
+    const int i_begin = b * BLOCK_SIZE;
+    const int i_end = std::min(d_size, i_begin + BLOCK_SIZE);
+    // pairs of vectors share each load and store of this vector
+    int j = 0;
+    for (; j + 1 < k; j += 2)
+    {
+      const double *x_0 = x_v[j];
+      const double *x_1 = x_v[j + 1];
+      const double a_0 = alpha * a[j];
+      const double a_1 = alpha * a[j + 1];
+      #pragma omp simd
+      for (int i = i_begin; i < i_end; ++i)
+        y_v[i] = (y_v[i] + a_0 * x_0[i]) + a_1 * x_1[i];
+    }
+    for (; j < k; ++j)
+    {
+      const double *x_j = x_v[j];
+      const double a_j = alpha * a[j];
+      #pragma omp simd
+      for (int i = i_begin; i < i_end; ++i)
+        y_v[i] += a_j * x_j[i];
+    }
+  }
+}
+
 //---------------------------------------------------------------------------//
 // IO
 //---------------------------------------------------------------------------//
@@ -125,12 +125,45 @@ public:
   void add_a_times_x(const double a, const Vector& x);
   void add_a_times_x(const double a, SP_vector x);
 
+  //-------------------------------------------------------------------------//
+  // FUSED VECTOR OPERATIONS
+  //-------------------------------------------------------------------------//
+
+  /// This vector <-- a * x + b * this vector
+  void axpby(const double a, const Vector& x, const double b);
+  /// This vector <-- a * x + y
+  void waxpy(const double a, const Vector& x, const Vector& y);
+  /// Inner product with x, and the L2 norm of this vector, in one pass
+  double dot_norm(const Vector& x, double &norm);
+  /**
+   *  @brief Inner products with a block of vectors in one pass
+   *
+   *  Computes h[j] = <x[first + j], this> for j = 0 .. k-1 and, if ww
+   *  is given, the squared L2 norm of this vector, while each block of
+   *  this vector is read only once.
+   */
+  void multi_dot(const std::vector<SP_vector> &x, const int first,
+                 const int k, double *h, double *ww = 0);
+  /// This vector <-- this vector + alpha * sum_j a[j] * x[first + j]
+  void multi_axpy(const std::vector<SP_vector> &x, const int first,
+                  const int k, const double *a, const double alpha = 1.0);
+
   //-------------------------------------------------------------------------//
   // QUERY
   //-------------------------------------------------------------------------//
 
   int size() const { return d_size; }
 
+  /**
+   *  Reductions over more than this many elements are split into blocks
+   *  of this size.  Blocks are summed by any thread, but the block sums
+   *  are always added in block order, so the result does not depend on
+   *  the number of threads.  This order, like the vector lanes used
+   *  within a block, differs from a plain left-to-right sum, so dot()
+   *  and the L2 norm can differ from it in the last bits.
+   */
+  enum { BLOCK_SIZE = 4096 };
+
   //-------------------------------------------------------------------------//
   // IO
   //-------------------------------------------------------------------------//
@@ -159,6 +192,13 @@ protected:
   // Is this also temporary around an extant PETSC vector?
   bool d_temporary_petsc;
 
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Blocked, deterministic inner product of two arrays of length n
+  static double blocked_dot(const double *a, const double *b, const int n);
+
 };
 
 CALLOW_TEMPLATE_EXPORT(detran_utilities::SP<Vector>);
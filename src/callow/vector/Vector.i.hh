@@ -89,9 +89,7 @@ inline double Vector::norm(const int type)
   }
   else if (type == L2 || type == L2GRID)
   {
-    for (int i = 0; i < d_size; i++)
-      val += d_value[i] * d_value[i];
-    val = std::sqrt(val);
+    val = std::sqrt(blocked_dot(d_value, d_value, d_size));
   }
   else if (type == LINF)
   {
@@ -193,8 +191,7 @@ inline double Vector::dot(const Vector& x)
 #ifdef CALLOW_ENABLE_PETSC_OPS
   VecDot(d_petsc_vector, const_cast<Vector* >(&x)->petsc_vector(), &val);
 #else
-  for (int i = 0; i < d_size; i++)
-    val += d_value[i] * x[i];
+  val = blocked_dot(d_value, x.d_value, d_size);
 #endif
   return val;
 }
@@ -230,8 +227,11 @@ inline void Vector::add_a_times_x(const double a, const Vector& x)
 #ifdef CALLOW_ENABLE_PETSC_OPS2
   VecAXPY(d_petsc_vector, a, const_cast<Vector* >(&x)->petsc_vector());
 #else
+  const double *x_v = x.d_value;
+  double *y_v = d_value;
+  #pragma omp parallel for simd default(shared) if (d_size > BLOCK_SIZE)
   for (int i = 0; i < d_size; i++)
-    d_value[i] += a*x[i];
+    y_v[i] += a * x_v[i];
 #endif
 }
 
@@ -241,6 +241,38 @@ inline void Vector::add_a_times_x(const double a, SP_vector x)
   add_a_times_x(a, *x);
 }
 
+//---------------------------------------------------------------------------//
+// FUSED VECTOR OPERATIONS
+//---------------------------------------------------------------------------//
+
+//---------------------------------------------------------------------------//
+inline void Vector::axpby(const double a, const Vector& x, const double b)
+{
+  Require(x.size() == d_size);
+#ifdef CALLOW_ENABLE_PETSC_OPS
+  VecAXPBY(d_petsc_vector, a, b, const_cast<Vector* >(&x)->petsc_vector());
+#else
+  const double *x_v = x.d_value;
+  double *y_v = d_value;
+  #pragma omp parallel for simd default(shared) if (d_size > BLOCK_SIZE)
+  for (int i = 0; i < d_size; i++)
+    y_v[i] = a * x_v[i] + b * y_v[i];
+#endif
+}
+
+//---------------------------------------------------------------------------//
+inline void Vector::waxpy(const double a, const Vector& x, const Vector& y)
+{
+  Require(x.size() == d_size);
+  Require(y.size() == d_size);
+  const double *x_v = x.d_value;
+  const double *y_v = y.d_value;
+  double *w_v = d_value;
+  #pragma omp parallel for simd default(shared) if (d_size > BLOCK_SIZE)
+  for (int i = 0; i < d_size; i++)
+    w_v[i] = a * x_v[i] + y_v[i];
+}
+
 //---------------------------------------------------------------------------//
 inline void Vector::subtract(const Vector &x)
 {
@@ -119,13 +119,8 @@ void Mesh::add_mesh_map(std::string map_key, vec_int mesh_map)
   Require(!map_key.empty());
   Require(mesh_map.size() == d_number_cells);
 
-  // Erase the value associated with the key if it exists.
-  mesh_map_type::iterator it;
-  it = d_mesh_map.find(map_key);
-  if (it != d_mesh_map.end())
-    d_mesh_map.erase(it);
-
-  // Add the new value.
+  // Add the new value, replacing any old one in place so that
+  // existing handles to the map remain valid.
   d_mesh_map[map_key] = mesh_map;
 
 }
@@ -148,6 +143,12 @@ const Mesh::vec_int& Mesh::mesh_map(std::string map_key)
   return d_mesh_map[map_key];
 }
 
+//---------------------------------------------------------------------------//
+MeshMap Mesh::map_handle(std::string map_key)
+{
+  return MeshMap(d_mesh_map[map_key]);
+}
+
 //---------------------------------------------------------------------------//
 void Mesh::setup()
 {
@@ -10,6 +10,7 @@
 #define detran_geometry_MESH_HH_
 
 #include "geometry/geometry_export.hh"
+#include "geometry/MeshMap.hh"
 #include "utilities/Definitions.hh"
 #include "utilities/DBC.hh"
 #include "utilities/Point.hh"
@@ -242,6 +243,19 @@ public:
    */
   const vec_int& mesh_map(std::string map_key);
 
+  /**
+   *  @brief  Get a handle to a map of fine mesh integer properties.
+   *
+   *  The key is looked up once, and the handle then reads the map in
+   *  place.  A map not yet added is created empty.
+   *
+   *  @param   map_key  Key of the map.
+   */
+  MeshMap map_handle(std::string map_key);
+
+  /// Handle to the material map
+  MeshMap material_map() { return map_handle("MATERIAL"); }
+
   /// Return a const reference to the full map (useful for IO)
   const mesh_map_type& get_mesh_map() const;
 
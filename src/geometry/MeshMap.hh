@@ -0,0 +1,91 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file  MeshMap.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief MeshMap class definition.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_geometry_MESHMAP_HH_
+#define detran_geometry_MESHMAP_HH_
+
+#include "utilities/Definitions.hh"
+#include "utilities/DBC.hh"
+
+namespace detran_geometry
+{
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class MeshMap
+ *  @brief Handle to a fine mesh map of a Mesh
+ *
+ *  Looking a map up by key costs a string comparison per level of the
+ *  underlying std::map, and clients often then copied the whole map.
+ *  A handle is resolved once, e.g. when a client is constructed, and
+ *  afterwards reads the values in place.  It stays valid as long as the
+ *  mesh does, and sees any later replacement of the map through
+ *  Mesh::add_mesh_map.
+ */
+//---------------------------------------------------------------------------//
+class MeshMap
+{
+
+public:
+
+  typedef detran_utilities::vec_int   vec_int;
+  typedef detran_utilities::size_t    size_t;
+
+  /// Default constructor gives an unresolved handle
+  MeshMap() : d_map(0) {}
+
+  /// Construct a handle to a map owned by a mesh
+  explicit MeshMap(const vec_int &map) : d_map(&map) {}
+
+  /// Value for a cell
+  int operator[](const size_t cell) const
+  {
+    Require(d_map);
+    Require(cell < d_map->size());
+    return (*d_map)[cell];
+  }
+
+  /// Values for all cells, or NULL if the map is empty
+  const int* data() const
+  {
+    Require(d_map);
+    return d_map->empty() ? 0 : &(*d_map)[0];
+  }
+
+  /// The full map
+  const vec_int& values() const
+  {
+    Require(d_map);
+    return *d_map;
+  }
+
+  /// Number of cells in the map
+  size_t size() const
+  {
+    Require(d_map);
+    return d_map->size();
+  }
+
+  /// Whether the handle has been resolved
+  bool valid() const { return d_map != 0; }
+
+private:
+
+  /// Map owned by the mesh
+  const vec_int *d_map;
+
+};
+
+} // end namespace detran_geometry
+
+#endif // detran_geometry_MESHMAP_HH_
+
+//---------------------------------------------------------------------------//
+//              end of file MeshMap.hh
+//---------------------------------------------------------------------------//
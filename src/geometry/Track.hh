@@ -12,6 +12,7 @@
 #include "utilities/Point.hh"
 #include "Segment.hh"
 #include "utilities/DBC.hh"
+#include "utilities/Definitions.hh"
 #include "utilities/SP.hh"
 #include <iomanip>
 #include <ostream>
@@ -20,9 +21,26 @@
 namespace detran_geometry
 {
 
+/**
+ *  @class SegmentStore
+ *  @brief Segments of many tracks stored contiguously
+ */
+struct GEOMETRY_EXPORT SegmentStore
+{
+  typedef detran_utilities::SP<SegmentStore>  SP_store;
+  /// Segment regions
+  detran_utilities::vec_int regions;
+  /// Segment lengths
+  detran_utilities::vec_dbl lengths;
+};
+
 /**
  *  @class Track
  *  @brief Represents a track across a domain, consisting of several segments
+ *
+ *  A track keeps its own segments until TrackDB::finalize moves them
+ *  into a store shared by all tracks, after which it reads them
+ *  through an offset into that store.
  */
 class GEOMETRY_EXPORT Track
 {
@@ -40,6 +58,7 @@ public:
   typedef vec_segment::const_iterator         iterator;
   typedef vec_segment::const_reverse_iterator riterator;
   typedef detran_utilities::size_t            size_t;
+  typedef SegmentStore::SP_store              SP_store;
 
   //-------------------------------------------------------------------------//
   // PUBLIC INTERFACE
@@ -51,7 +70,9 @@ public:
    *  @param r1   Exit point
    */
   Track(Point r0, Point r1)
-    : d_enter(r0)
+    : d_offset(0)
+    , d_number_segments(0)
+    , d_enter(r0)
     , d_exit(r1)
   {
     double d = distance(r0, r1);
@@ -81,37 +102,64 @@ public:
 
   int number_segments() const
   {
-    return d_segments.size();
+    return d_number_segments;
   }
 
   void add_segment(Segment s)
   {
+    Require(!d_store);
     d_segments.push_back(s);
+    ++d_number_segments;
   }
 
-  /// Mutable reference to segment
-  Segment& segment(size_t i)
+  /// Copy of a segment
+  Segment segment(size_t i) const
   {
-    Require(i < d_segments.size());
+    Require(i < d_number_segments);
+    if (d_store)
+    {
+      return Segment(d_store->regions[d_offset + i],
+                     d_store->lengths[d_offset + i]);
+    }
     return d_segments[i];
   }
 
-  /// Const reference to segment
-  const Segment& segment(size_t i) const
+  /// Scale a segment.
+  void scale_segment(size_t i, double v)
   {
-    Require(i < d_segments.size());
-    return d_segments[i];
+    Require(i < d_number_segments);
+    if (d_store)
+      d_store->lengths[d_offset + i] *= v;
+    else
+      d_segments[i].scale(v);
+  }
+
+  /**
+   *  @brief Move the segments into a shared store.
+   *
+   *  The store must already hold the segments from the offset on.  The
+   *  track's own segments are released.
+   */
+  void set_store(SP_store store, size_t offset)
+  {
+    Require(store);
+    Require(offset + d_number_segments <= store->regions.size());
+    d_store  = store;
+    d_offset = offset;
+    vec_segment().swap(d_segments);
   }
 
-  /// Iterator to the beginning of the track
+  /// Iterator to the beginning of the track, before the segments are stored
   iterator begin()
   {
+    Require(!d_store);
     return d_segments.begin();
   }
 
-  /// Iterator to the end of the track
+  /// Iterator to the end of the track, before the segments are stored
   riterator rbegin()
   {
+    Require(!d_store);
     return d_segments.rbegin();
   }
 
@@ -133,9 +181,18 @@ private:
   // DATA
   //-------------------------------------------------------------------------//
 
-  /// Track segments
+  /// Track segments, until they are moved to a store
   vec_segment d_segments;
 
+  /// Shared store of the segments, if set
+  SP_store d_store;
+
+  /// Offset of the first segment in the store
+  size_t d_offset;
+
+  /// Number of segments
+  size_t d_number_segments;
+
   /// Track entrance point
   Point d_enter;
 
@@ -172,6 +229,7 @@ inline std::ostream& operator<< (std::ostream &out, Track &t)
   return out;
 }
 
+GEOMETRY_TEMPLATE_EXPORT(detran_utilities::SP<SegmentStore>)
 GEOMETRY_TEMPLATE_EXPORT(detran_utilities::SP<Track>)
 GEOMETRY_TEMPLATE_EXPORT(std::vector<detran_utilities::SP<Track> >)
 GEOMETRY_TEMPLATE_EXPORT(std::vector<std::vector<detran_utilities::SP<Track> > >)
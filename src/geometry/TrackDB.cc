@@ -43,11 +43,54 @@ void TrackDB::normalize(vec_dbl &volume)
       for (int s = 0; s < d_tracks[a][t]->number_segments(); s++)
       {
         int r = d_tracks[a][t]->segment(s).region();
-        d_tracks[a][t]->segment(s).scale(volume[r]/appx_volume[r]);
+        d_tracks[a][t]->scale_segment(s, volume[r]/appx_volume[r]);
       }
     }
   }
+}
+
+void TrackDB::finalize()
+{
+  if (finalized()) return;
+
+  // Track and segment offsets.
+  d_track_offsets.assign(d_tracks.size(), 0);
+  size_t number_tracks = 0;
+  for (size_t a = 0; a < d_tracks.size(); a++)
+  {
+    d_track_offsets[a] = number_tracks;
+    number_tracks += d_tracks[a].size();
+  }
+  d_segment_offsets.assign(number_tracks + 1, 0);
+  for (size_t a = 0; a < d_tracks.size(); a++)
+  {
+    for (size_t t = 0; t < d_tracks[a].size(); t++)
+    {
+      size_t i = d_track_offsets[a] + t;
+      d_segment_offsets[i + 1] =
+        d_segment_offsets[i] + d_tracks[a][t]->number_segments();
+    }
+  }
 
+  // Move the segments.
+  size_t number_segments = d_segment_offsets[number_tracks];
+  d_segments = new SegmentStore();
+  d_segments->regions.assign(number_segments, 0);
+  d_segments->lengths.assign(number_segments, 0.0);
+  for (size_t a = 0; a < d_tracks.size(); a++)
+  {
+    for (size_t t = 0; t < d_tracks[a].size(); t++)
+    {
+      size_t offset = d_segment_offsets[d_track_offsets[a] + t];
+      for (int s = 0; s < d_tracks[a][t]->number_segments(); s++)
+      {
+        Segment segment = d_tracks[a][t]->segment(s);
+        d_segments->regions[offset + s] = segment.region();
+        d_segments->lengths[offset + s] = segment.length();
+      }
+      d_tracks[a][t]->set_store(d_segments, offset);
+    }
+  }
 }
 
 void TrackDB::display() const
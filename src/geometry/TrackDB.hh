@@ -39,6 +39,13 @@ namespace detran_geometry
  *  The track index in the other two octancts keeps
  *  the index of their reflection.
  *
+ *  Once tracking is complete, finalize() moves the segments into
+ *  two contiguous arrays of regions and lengths, ordered by azimuth,
+ *  track, and segment, with the offset of each track's first segment.
+ *  Sweeps walk these arrays forward or backward rather than visiting
+ *  each track.  The tracks release their own segments and read them
+ *  through their offsets, so the segments are stored once.
+ *
  */
 /*!
  *  \example geometry/test/test_TrackDB.cc
@@ -112,6 +119,44 @@ public:
     Require(a < d_spacing.size());
     return d_spacing[a];
   }
+  /// Offset of a track's first segment in the contiguous segment arrays
+  size_t segment_offset(size_t a, size_t t) const
+  {
+    Require(a < d_track_offsets.size());
+    Require(t < d_tracks[a].size());
+    return d_segment_offsets[d_track_offsets[a] + t];
+  }
+  /// Number of segments on a track
+  size_t number_segments(size_t a, size_t t) const
+  {
+    Require(a < d_track_offsets.size());
+    Require(t < d_tracks[a].size());
+    size_t i = d_track_offsets[a] + t;
+    return d_segment_offsets[i + 1] - d_segment_offsets[i];
+  }
+  /// Total number of segments
+  size_t number_segments() const
+  {
+    Require(finalized());
+    return d_segments->regions.size();
+  }
+  /// Have the contiguous segment arrays been built?
+  bool finalized() const
+  {
+    return !d_segment_offsets.empty();
+  }
+  /// Contiguous segment regions
+  const int* segment_regions() const
+  {
+    Require(finalized() && !d_segments->regions.empty());
+    return &d_segments->regions[0];
+  }
+  /// Contiguous segment lengths
+  const double* segment_lengths() const
+  {
+    Require(finalized() && !d_segments->lengths.empty());
+    return &d_segments->lengths[0];
+  }
 
   /// \}
 
@@ -130,6 +175,8 @@ public:
     d_spacing[a] = space;
   }
 
+  /// Move the track segments into the contiguous segment arrays.
+  void finalize();
   /// Normalize the tracks given a vector of true volumes.
   void normalize(vec_dbl &volume);
 
@@ -156,6 +203,12 @@ private:
   vec_dbl d_sin_phi;
   /// Constant track spacing for each angle.
   vec_dbl d_spacing;
+  /// Index of each azimuth's first track
+  vec_int d_track_offsets;
+  /// Offset of each track's first segment, [track] (plus one past the end)
+  vec_int d_segment_offsets;
+  /// Segment regions and lengths, [track][segment]
+  SegmentStore::SP_store d_segments;
 
 };
 
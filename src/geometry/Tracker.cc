@@ -8,14 +8,20 @@
 
 #include "Tracker.hh"
 #include "utilities/SoftEquivalence.hh"
+#include "utilities/Warning.hh"
+#include <cstring>
+#include <fstream>
 #include <iostream>
 
 namespace detran_geometry
 {
 
-Tracker::Tracker(SP_mesh mesh, SP_quadrature quadrature)
+Tracker::Tracker(SP_mesh mesh, SP_quadrature quadrature,
+                 const std::string &track_file)
   : d_mesh(mesh)
   , d_quadrature(quadrature)
+  , d_track_file(track_file)
+  , d_tracks_read(false)
 {
   Require(d_mesh);
   Insist(d_mesh->dimension() == 2, "Only 2D MOC is currently supported.");
@@ -69,9 +75,13 @@ Tracker::Tracker(SP_mesh mesh, SP_quadrature quadrature)
   } // end angle
 
 
-  // Do the actual track generation.
-  generate_tracks();
-
+  // Read the tracks, or do the actual track generation.
+  d_tracks_read = read_tracks();
+  if (!d_tracks_read)
+  {
+    generate_tracks();
+    write_tracks();
+  }
 }
 
 void Tracker::normalize()
@@ -89,9 +99,6 @@ void Tracker::normalize()
 
 void Tracker::generate_tracks()
 {
-
-  using std::cout;
-  using std::endl;
   /*
    *  for all azimuth
    *    for all origins
@@ -100,8 +107,6 @@ void Tracker::generate_tracks()
    *        ray trace the grid
    */
 
-  bool db = false;
-
   // Create the mesh grid.
   d_x.resize(d_mesh->number_cells_x() + 1, 0.0);
   d_y.resize(d_mesh->number_cells_y() + 1, 0.0);
@@ -114,134 +119,133 @@ void Tracker::generate_tracks()
     d_y[i + 1] = d_y[i] + d_mesh->dy(i);
   }
 
-  // Loop through azimuths
+  // Gather all tracks so that they can be traced in parallel.  Each track
+  // gets only its own segments, so the result is independent of the order.
+  std::vector<SP_track> tracks;
   for (int a = 0; a < d_number_azimuths * 2; a++)
-  {
-    if (db) cout << "AZIMUTH = " << a << endl;
-    if (db) cout << "    number tracks = " << d_trackdb->number_tracks_angle(a) << endl;
-
-    // Loop through tracks
     for (int t = 0; t < d_trackdb->number_tracks_angle(a); t++)
-    {
-      if (db) cout << "    TRACK = " << t << endl;
+      tracks.push_back(d_trackdb->track(a, t));
 
+  const int number_tracks = tracks.size();
+  #pragma omp parallel for schedule(dynamic, 16)
+  for (int i = 0; i < number_tracks; i++)
+    trace_track(tracks[i]);
+}
 
-      // Get the track
-      SP_track track = d_trackdb->track(a, t);
+void Tracker::trace_track(SP_track track)
+{
+  using std::cout;
+  using std::endl;
 
-      // Compute the track length
-      Point enter = track->enter();
-      Point exit  = track->exit();
-      double track_length = distance(enter, exit);
+  bool db = false;
 
-      // Compute tangent of angle with respect to x
-      Point p = exit - enter;
-      double tan_phi = p.y() / p.x();
-      double sin_phi = (exit.y()-enter.y()) / track_length;
-      double cos_phi = (exit.x()-enter.x()) / track_length;
-      if (db) cout << "        tan_phi = " << tan_phi << endl;
-      if (db) cout << "        sin_phi = " << sin_phi << endl;
-      if (db) cout << "        cos_phi = " << cos_phi << endl;
-      if (db) cout << "         length = " << track_length << endl;
+  // Compute the track length
+  Point enter = track->enter();
+  Point exit  = track->exit();
+  double track_length = distance(enter, exit);
 
-      // Find the starting cell
-      int IJ[] = {0, 0};
-      find_starting_cell(enter, tan_phi, IJ);
-      int I = IJ[0];
-      int J = IJ[1];
+  // Compute tangent of angle with respect to x
+  Point p = exit - enter;
+  double tan_phi = p.y() / p.x();
+  double sin_phi = (exit.y()-enter.y()) / track_length;
+  double cos_phi = (exit.x()-enter.x()) / track_length;
+  if (db) cout << "        tan_phi = " << tan_phi << endl;
+  if (db) cout << "        sin_phi = " << sin_phi << endl;
+  if (db) cout << "        cos_phi = " << cos_phi << endl;
+  if (db) cout << "         length = " << track_length << endl;
 
-      // Get segments
-      double d_to_x = 0;
-      double d_to_y = 0;
-      p = enter;
+  // Find the starting cell
+  int IJ[] = {0, 0};
+  find_starting_cell(enter, tan_phi, IJ);
+  int I = IJ[0];
+  int J = IJ[1];
 
-      if (db) cout << "          ENTER = " << enter <<  endl;
-      if (db) cout << "           EXIT = " << exit << endl;
-      if (db) cout << "              I = " << I << endl;
-      if (db) cout << "              J = " << J << endl;
+  // Get segments
+  double d_to_x = 0;
+  double d_to_y = 0;
+  p = enter;
 
+  if (db) cout << "          ENTER = " << enter <<  endl;
+  if (db) cout << "           EXIT = " << exit << endl;
+  if (db) cout << "              I = " << I << endl;
+  if (db) cout << "              J = " << J << endl;
 
-      Assert(I <= d_mesh->number_cells_x());
-      Assert(J <= d_mesh->number_cells_y());
 
+  Assert(I <= d_mesh->number_cells_x());
+  Assert(J <= d_mesh->number_cells_y());
 
-      int count = 0;
-      while (1)
-      {
 
-        if (db) cout << "        SEGMENT = " << count << endl;
-        if (db) cout << "              I = " << I << endl;
-        if (db) cout << "              J = " << J << endl;
-
-        if (tan_phi > 0)
-          d_to_x = d_x[I + 1] - p.x();
-        else
-          d_to_x = p.x() - d_x[I];
-
-        d_to_y = d_y[J + 1] - p.y();
-
-        // Flat source region.
-        int region = d_mesh->index(I, J);
-        if (db) cout << "            reg = " << region << endl;
-        if (db) cout << "            d2x = " << d_to_x << endl;
-        if (db) cout << "            d2y = " << d_to_y << endl;
-
-        // Segment length
-        double length = 0.0;
-
-        double temp = std::abs(d_to_x * tan_phi) - d_to_y;
-
-        if (db) cout << "           temp = " << temp << endl;
-        if (std::abs(temp) > 1e-12 && temp > 0.0)
-        {
-          // I hit the top
-          p = Point(p.x() + d_to_y / tan_phi, d_y[++J]);
-          length = d_to_y / sin_phi;
-          if (db) cout << "                NEW POINT 1 = " << p << endl;
-        }
-        else if (std::abs(temp) > 1e-12 && temp < 0.0)
-        {
-          // I hit the side
-          if (tan_phi > 0.0)
-            p = Point(d_x[++I], d_to_x * std::abs(tan_phi) + p.y());
-          else
-            p = Point(d_x[I--], d_to_x * std::abs(tan_phi) + p.y());
-          length = d_to_x / std::abs(cos_phi);
-          if (db) cout << "                NEW POINT 2 = " << p << endl;
-        }
-        else
-        {
-          // I cross through a corner
-          if (tan_phi > 0.0)
-            p = Point(d_x[++I], d_y[++J]);
-          else
-            p = Point(d_x[I--], d_y[++J]);
-          length = d_to_y / sin_phi;
-          if (db) cout << "                NEW POINT 3 = " << p << endl;
-        }
-
-        if (db) cout << "            len = " << length << endl;
-        // Add a segment
-        track->add_segment(Segment(region, length));
-
-        // Check to see if we've left.
-        if (I == -1 || I == d_x.size()-1 || J == d_y.size()-1)
-        {
-          double temp = distance(enter, p);
-
-          if (db) cout << " lengths: " << temp <<  " " << track_length << " " << enter << " " << p << endl;
-          Ensure(detran_utilities::soft_equiv(temp, track_length));
-          break;
-        }
-        count++;
-
-      } // segment loop
-
-    } // track loop
-
-  } // azimuth loop
+  int count = 0;
+  while (1)
+  {
+
+    if (db) cout << "        SEGMENT = " << count << endl;
+    if (db) cout << "              I = " << I << endl;
+    if (db) cout << "              J = " << J << endl;
 
+    if (tan_phi > 0)
+      d_to_x = d_x[I + 1] - p.x();
+    else
+      d_to_x = p.x() - d_x[I];
 
+    d_to_y = d_y[J + 1] - p.y();
+
+    // Flat source region.
+    int region = d_mesh->index(I, J);
+    if (db) cout << "            reg = " << region << endl;
+    if (db) cout << "            d2x = " << d_to_x << endl;
+    if (db) cout << "            d2y = " << d_to_y << endl;
+
+    // Segment length
+    double length = 0.0;
+
+    double temp = std::abs(d_to_x * tan_phi) - d_to_y;
+
+    if (db) cout << "           temp = " << temp << endl;
+    if (std::abs(temp) > 1e-12 && temp > 0.0)
+    {
+      // I hit the top
+      p = Point(p.x() + d_to_y / tan_phi, d_y[++J]);
+      length = d_to_y / sin_phi;
+      if (db) cout << "                NEW POINT 1 = " << p << endl;
+    }
+    else if (std::abs(temp) > 1e-12 && temp < 0.0)
+    {
+      // I hit the side
+      if (tan_phi > 0.0)
+        p = Point(d_x[++I], d_to_x * std::abs(tan_phi) + p.y());
+      else
+        p = Point(d_x[I--], d_to_x * std::abs(tan_phi) + p.y());
+      length = d_to_x / std::abs(cos_phi);
+      if (db) cout << "                NEW POINT 2 = " << p << endl;
+    }
+    else
+    {
+      // I cross through a corner
+      if (tan_phi > 0.0)
+        p = Point(d_x[++I], d_y[++J]);
+      else
+        p = Point(d_x[I--], d_y[++J]);
+      length = d_to_y / sin_phi;
+      if (db) cout << "                NEW POINT 3 = " << p << endl;
+    }
+
+    if (db) cout << "            len = " << length << endl;
+    // Add a segment
+    track->add_segment(Segment(region, length));
+
+    // Check to see if we've left.
+    if (I == -1 || I == d_x.size()-1 || J == d_y.size()-1)
+    {
+      double temp = distance(enter, p);
+
+      if (db) cout << " lengths: " << temp <<  " " << track_length << " " << enter << " " << p << endl;
+      Ensure(detran_utilities::soft_equiv(temp, track_length));
+      break;
+    }
+    count++;
+
+  } // segment loop
 }
 
 // Find the indices of the cell we are to enter
@@ -290,6 +294,138 @@ void Tracker::find_starting_cell(Point enter, double tan_phi, int *IJ)
   IJ[1] = j;
 }
 
+//---------------------------------------------------------------------------//
+// TRACK FILE
+//---------------------------------------------------------------------------//
+
+/*
+ *  The key holds everything the segments depend on: the cell widths
+ *  and, for each azimuth, its angle, spacing, and track end points.
+ */
+Tracker::vec_dbl Tracker::track_file_key() const
+{
+  vec_dbl key;
+  key.push_back(d_mesh->number_cells_x());
+  key.push_back(d_mesh->number_cells_y());
+  for (size_t i = 0; i < d_mesh->number_cells_x(); i++)
+    key.push_back(d_mesh->dx(i));
+  for (size_t j = 0; j < d_mesh->number_cells_y(); j++)
+    key.push_back(d_mesh->dy(j));
+  key.push_back(d_trackdb->number_angles());
+  for (int a = 0; a < d_trackdb->number_angles(); a++)
+  {
+    key.push_back(d_quadrature->cos_phi(a));
+    key.push_back(d_quadrature->sin_phi(a));
+    key.push_back(d_trackdb->spacing(a));
+    key.push_back(d_trackdb->number_tracks_angle(a));
+    for (int t = 0; t < d_trackdb->number_tracks_angle(a); t++)
+    {
+      SP_track track = d_trackdb->track(a, t);
+      key.push_back(track->enter().x());
+      key.push_back(track->enter().y());
+      key.push_back(track->exit().x());
+      key.push_back(track->exit().y());
+    }
+  }
+  return key;
+}
+
+// Identifies a track file and its format.
+static const char track_file_magic[] = "DETRAN_TRACKS_1";
+
+bool Tracker::read_tracks()
+{
+  if (d_track_file.empty()) return false;
+  std::ifstream in(d_track_file.c_str(), std::ios::in | std::ios::binary);
+  if (!in) return false;
+
+  // Check the format and key.
+  char magic[sizeof(track_file_magic)];
+  in.read(magic, sizeof(magic));
+  if (!in || std::strncmp(magic, track_file_magic, sizeof(magic)))
+    return false;
+  vec_dbl key = track_file_key();
+  int key_size = 0;
+  in.read((char*) &key_size, sizeof(int));
+  if (!in || key_size != (int) key.size()) return false;
+  vec_dbl file_key(key_size, 0.0);
+  in.read((char*) &file_key[0], sizeof(double) * key_size);
+  if (!in || file_key != key) return false;
+
+  // Read all segments before adding any to the tracks.
+  std::vector<detran_utilities::vec_int> regions;
+  std::vector<vec_dbl> lengths;
+  for (int a = 0; a < d_trackdb->number_angles(); a++)
+  {
+    for (int t = 0; t < d_trackdb->number_tracks_angle(a); t++)
+    {
+      int number_segments = 0;
+      in.read((char*) &number_segments, sizeof(int));
+      if (!in || number_segments <= 0) return false;
+      regions.push_back(detran_utilities::vec_int(number_segments, 0));
+      lengths.push_back(vec_dbl(number_segments, 0.0));
+      in.read((char*) &regions.back()[0], sizeof(int) * number_segments);
+      in.read((char*) &lengths.back()[0], sizeof(double) * number_segments);
+      if (!in) return false;
+    }
+  }
+
+  int i = 0;
+  for (int a = 0; a < d_trackdb->number_angles(); a++)
+  {
+    for (int t = 0; t < d_trackdb->number_tracks_angle(a); t++, i++)
+    {
+      SP_track track = d_trackdb->track(a, t);
+      for (size_t s = 0; s < regions[i].size(); s++)
+      {
+        Insist(regions[i][s] >= 0 &&
+               regions[i][s] < (int) d_mesh->number_cells(),
+               "Track file region out of range.");
+        track->add_segment(Segment(regions[i][s], lengths[i][s]));
+      }
+    }
+  }
+  return true;
+}
+
+void Tracker::write_tracks() const
+{
+  if (d_track_file.empty()) return;
+  std::ofstream out(d_track_file.c_str(),
+                    std::ios::out | std::ios::binary | std::ios::trunc);
+  // Failing to write the file only costs retracing next time.
+  if (!out)
+  {
+    detran_utilities::warning(detran_utilities::USER_INPUT,
+      "Could not write track file " + d_track_file);
+    return;
+  }
+  out.write(track_file_magic, sizeof(track_file_magic));
+  vec_dbl key = track_file_key();
+  int key_size = key.size();
+  out.write((const char*) &key_size, sizeof(int));
+  out.write((const char*) &key[0], sizeof(double) * key_size);
+  for (int a = 0; a < d_trackdb->number_angles(); a++)
+  {
+    for (int t = 0; t < d_trackdb->number_tracks_angle(a); t++)
+    {
+      SP_track track = d_trackdb->track(a, t);
+      int number_segments = track->number_segments();
+      out.write((const char*) &number_segments, sizeof(int));
+      for (int s = 0; s < number_segments; s++)
+      {
+        int region = track->segment(s).region();
+        out.write((const char*) &region, sizeof(int));
+      }
+      for (int s = 0; s < number_segments; s++)
+      {
+        double length = track->segment(s).length();
+        out.write((const char*) &length, sizeof(double));
+      }
+    }
+  }
+}
+
 } // end namespace detran_geometry
 
 //---------------------------------------------------------------------------//
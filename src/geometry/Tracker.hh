@@ -16,6 +16,7 @@
 #include "angle/QuadratureMOC.hh"
 #include "utilities/DBC.hh"
 #include "utilities/SP.hh"
+#include <string>
 #include <vector>
 
 namespace detran_geometry
@@ -24,6 +25,16 @@ namespace detran_geometry
 /*!
  *  \class Tracker
  *  \brief Track a mesh.
+ *
+ *  Tracks are traced in parallel.  Each track's segments depend only
+ *  on the track, so the database is the same for any number of threads.
+ *
+ *  If a track file is given, the segments are read from it when it was
+ *  written for the same mesh grid and track layout, and tracing is
+ *  skipped.  Otherwise, the tracks are traced and the file is
+ *  (re)written.  The file holds the segments before normalization, and
+ *  is keyed by the cell widths and by the angles, spacings, and end
+ *  points of all tracks.
  */
 class GEOMETRY_EXPORT Tracker
 {
@@ -46,13 +57,21 @@ public:
   // PUBLIC INTERFACE
   //-------------------------------------------------------------------------//
 
-  Tracker(SP_mesh mesh, SP_quadrature quadrature);
+  /*!
+   *  \brief Constructor
+   *  \param mesh         Mesh to track
+   *  \param quadrature   MOC quadrature
+   *  \param track_file   Binary track file, if any
+   */
+  Tracker(SP_mesh mesh, SP_quadrature quadrature,
+          const std::string &track_file = "");
 
   static SP_tracker
   Create(SP_mesh       mesh,
-         SP_quadrature quadrature)
+         SP_quadrature quadrature,
+         const std::string &track_file = "")
   {
-    SP_tracker p(new Tracker(mesh, quadrature));
+    SP_tracker p(new Tracker(mesh, quadrature, track_file));
     return p;
   }
 
@@ -72,6 +91,12 @@ public:
   // Normalize the track segments based on actual volumes.
   void normalize();
 
+  // Were the tracks read from the track file?
+  bool tracks_read() const
+  {
+    return d_tracks_read;
+  }
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -85,13 +110,24 @@ private:
   int d_number_azimuths;
   vec_dbl d_x;
   vec_dbl d_y;
+  // Binary track file
+  std::string d_track_file;
+  // Were the tracks read from the track file?
+  bool d_tracks_read;
 
   //-------------------------------------------------------------------------//
   // IMPLEMENTATION
   //-------------------------------------------------------------------------//
 
   void generate_tracks();
+  void trace_track(SP_track track);
   void find_starting_cell(Point enter, double tan_phi, int *IJ);
+  // Mesh grid and track layout identifying a track file
+  vec_dbl track_file_key() const;
+  // Read the segments from the track file if it matches
+  bool read_tracks();
+  // Write the segments to the track file
+  void write_tracks() const;
 
 };
 
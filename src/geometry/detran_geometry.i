@@ -133,8 +133,8 @@ public:
   Point exit() const;
   int number_segments() const;
   void add_segment(Segment s);
-  Segment& segment(size_t i);
-  const Segment& segment(size_t i) const;
+  Segment segment(size_t i) const;
+  void scale_segment(size_t i, double v);
   iterator begin();
   riterator rbegin();
   double cos_phi() const;
@@ -56,6 +56,16 @@ int test_Mesh2D_basic(int argc, char *argv[])
   TEST(mat_map[0]               == 0);
   TEST(mat_map[10]              == 1);
 
+  // A handle reads the map in place and sees replacements.
+  MeshMap handle = mesh->material_map();
+  TEST(handle.valid());
+  TEST(handle.size()            == 400);
+  TEST(handle[0]                == 0);
+  TEST(handle[10]               == 1);
+  mesh->add_mesh_map("MATERIAL", vec_int(400, 7));
+  TEST(handle[0]                == 7);
+  TEST(handle.data()[10]        == 7);
+
   return 0;
 }
 
@@ -61,6 +61,21 @@ int test_Track(int argc, char *argv[])
   rit++;
   TEST((*rit).region() == 0);
 
+  // Test reading the segments through a store.
+  SegmentStore::SP_store store(new SegmentStore());
+  store->regions.resize(3, 0);
+  store->lengths.resize(3, 0.0);
+  store->regions[2] = 1;
+  store->lengths[1] = 1.0;
+  store->lengths[2] = 2.0;
+  track.set_store(store, 1);
+  track.scale_segment(1, 0.5);
+  TEST(track.number_segments()   == 2);
+  TEST(track.segment(1).region() == 1);
+  TEST(soft_equiv(track.segment(0).length(), 1.0));
+  TEST(soft_equiv(track.segment(1).length(), 1.0));
+  TEST(soft_equiv(store->lengths[2],         1.0));
+
   return 0;
 }
 
@@ -11,7 +11,8 @@
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST                     \
         FUNC(test_Tracker_2x2)        \
-        FUNC(test_Tracker_3x3)
+        FUNC(test_Tracker_3x3)        \
+        FUNC(test_Tracker_file)
 
 // Detran headers
 #include "TestDriver.hh"
@@ -19,6 +20,10 @@
 //
 #include "Mesh2D.hh"
 #include "Uniform.hh"
+#include <cstdio>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 // Setup
 /* ... */
@@ -56,6 +61,11 @@ int test_Tracker_2x2(int argc, char *argv[])
   Tracker tracker(mesh, quad);
   Tracker::SP_trackdb tracks = tracker.trackdb();
 
+  // The contiguous segments are built on request.
+  TEST(!tracks->finalized());
+  tracks->finalize();
+  TEST(tracks->finalized());
+
   // Verify tracker.
   double length = 0.559016994374947;
   // Number of segments for each track within angle
@@ -71,9 +81,13 @@ int test_Tracker_2x2(int argc, char *argv[])
     {
       Tracker::SP_track track = tracks->track(a, t);
       TEST(track->number_segments() == ns[t]);
-      for (int s = 0; s < ns[t]; s++)
+      TEST(tracks->number_segments(a, t) == ns[t]);
+      int i = tracks->segment_offset(a, t);
+      for (int s = 0; s < ns[t]; s++, i++)
       {
         TEST(soft_equiv(track->segment(s).length(), length));
+        TEST(soft_equiv(tracks->segment_lengths()[i], length));
+        TEST(tracks->segment_regions()[i] == region[r]);
         TEST(track->segment(s).region() == region[r++]);
       }
     }
@@ -132,6 +146,76 @@ int test_Tracker_3x3(int argc, char *argv[])
   tracker.normalize();
   tracks->display();
   TEST(soft_equiv(tracks->track(0, 0)->segment(0).length(), 0.662538659999938));
+  tracks->finalize();
+  TEST(soft_equiv(tracks->segment_lengths()[0], 0.662538659999938));
+  return 0;
+}
+
+// Do two track databases hold the same segments?
+bool same_tracks(Tracker::SP_trackdb a, Tracker::SP_trackdb b)
+{
+  a->finalize();
+  b->finalize();
+  if (a->number_segments() != b->number_segments()) return false;
+  for (int s = 0; s < a->number_segments(); s++)
+  {
+    if (a->segment_regions()[s] != b->segment_regions()[s]) return false;
+    if (a->segment_lengths()[s] != b->segment_lengths()[s]) return false;
+  }
+  return true;
+}
+
+int test_Tracker_file(int argc, char *argv[])
+{
+  vec_dbl cm(3, 0.0);
+  cm[1] = 0.4;
+  cm[2] = 1.0;
+  vec_int fm(2, 5);
+  vec_int mat(4, 0);
+  Mesh::SP_mesh mesh(new Mesh2D(fm, fm, cm, cm, mat));
+  QuadratureMOC::SP_quadrature quad(new Uniform(2, 4, 15, 1, "TY"));
+  std::string file = "test_Tracker_file.tracks";
+  std::remove(file.c_str());
+
+  // Tracing in parallel gives the same segments as tracing serially.
+#ifdef DETRAN_ENABLE_OPENMP
+  omp_set_num_threads(1);
+#endif
+  Tracker serial(mesh, quad);
+#ifdef DETRAN_ENABLE_OPENMP
+  omp_set_num_threads(3);
+#endif
+  Tracker tracker(mesh, quad, file);
+#ifdef DETRAN_ENABLE_OPENMP
+  omp_set_num_threads(1);
+#endif
+  TEST(!tracker.tracks_read());
+  TEST(same_tracks(serial.trackdb(), tracker.trackdb()));
+
+  // The tracks are read back for the same mesh and quadrature.
+  Tracker reader(mesh, quad, file);
+  TEST(reader.tracks_read());
+  TEST(same_tracks(serial.trackdb(), reader.trackdb()));
+  tracker.normalize();
+  reader.normalize();
+  TEST(same_tracks(tracker.trackdb(), reader.trackdb()));
+
+  // A different mesh is traced again, and its tracks replace the file.
+  cm[1] = 0.5;
+  Mesh::SP_mesh mesh2(new Mesh2D(fm, fm, cm, cm, mat));
+  Tracker other(mesh2, quad, file);
+  TEST(!other.tracks_read());
+  TEST(!same_tracks(serial.trackdb(), other.trackdb()));
+  Tracker other_reader(mesh2, quad, file);
+  TEST(other_reader.tracks_read());
+  TEST(same_tracks(other.trackdb(), other_reader.trackdb()));
+
+  // So is a different quadrature.
+  QuadratureMOC::SP_quadrature quad2(new Uniform(2, 4, 11, 1, "TY"));
+  Tracker other_quad(mesh2, quad2, file);
+  TEST(!other_quad.tracks_read());
+
+  std::remove(file.c_str());
   return 0;
 }
 
@@ -193,11 +193,13 @@ bool SiloOutput::write_angular_flux(SP_state state, SP_quadrature quad)
         char buffer[14];
         sprintf(buffer, "g%i_o%i_a%i", g, o, a);
 
-        // Get a pointer to the group flux
-        double *psi = &state->psi(g, o, a)[0];
+        // Copy the angular flux, which may be strided or single precision.
+        State::const_angular_flux_type view = state->psi(g, o, a);
+        detran_utilities::vec_dbl psi(view.size());
+        view.copy(&psi[0]);
 
         // Write to silo
-        DBPutQuadvar1(d_silofile, buffer, "mesh", psi,
+        DBPutQuadvar1(d_silofile, buffer, "mesh", &psi[0],
                       d_dims, d_dimension, NULL, 0, DB_DOUBLE,
                       DB_ZONECENT, NULL);
       }
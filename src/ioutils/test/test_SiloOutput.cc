@@ -60,12 +60,18 @@ int test_SiloOutput(int argc, char *argv[])
 
   // Make state and fill.
   State::SP_state state(new State(inp, mesh, quad));
+  State::vec_dbl buffer;
   for (int i = 0; i < mesh->number_cells(); i++)
-  {
     state->phi(0)[i] = (double) i;
-    for (int o = 0; o < 4; o++)
-      for (int a = 0; a < 2; a++)
-        state->psi(0, o, a)[i] =  1000.0 * o + 100.0 * a + 1.0 * i;
+  for (int o = 0; o < 4; o++)
+  {
+    for (int a = 0; a < 2; a++)
+    {
+      State::angular_flux_type psi = state->psi(0, o, a, buffer);
+      for (int i = 0; i < mesh->number_cells(); i++)
+        psi[i] =  1000.0 * o + 100.0 * a + 1.0 * i;
+      state->store_psi(0, o, a, psi);
+    }
   }
 
   // Create the SiloOutput.
@@ -69,7 +69,7 @@ inline void SyntheticDiscreteSource::build(const double dt,
   if (size_precursor) np = precursors[0]->number_precursor_groups();
 
   // Material map
-  const detran_utilities::vec_int &mt = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mt = d_mesh->material_map();
 
   // Leading coefficient
   double a_0 = bdf_coefs[order - 1][0];
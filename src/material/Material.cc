@@ -41,6 +41,8 @@ Material::Material(const size_t number_materials,
  , d_scatter_bounds(number_groups, vec_size_t(2, 0))
  , d_upscatter_cutoff(0)
  , d_finalized(false)
+ , d_packed_sigma_s_offset(number_groups + 1, 0)
+ , d_revision(0)
 {
   // Postconditions
   Ensure(d_sigma_t.size() == number_groups);
@@ -70,6 +72,7 @@ void Material::set_sigma_t(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_sigma_t[g][m] = v;
+  set_packed(PACKED_SIGMA_T, m, g, v);
 }
 
 //---------------------------------------------------------------------------//
@@ -79,6 +82,7 @@ void Material::set_sigma_a(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_sigma_a[g][m] = v;
+  set_packed(PACKED_SIGMA_A, m, g, v);
 }
 
 //---------------------------------------------------------------------------//
@@ -88,6 +92,7 @@ void Material::set_nu_sigma_f(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_nu_sigma_f[g][m] = v;
+  set_packed(PACKED_NU_SIGMA_F, m, g, v);
 }
 
 //---------------------------------------------------------------------------//
@@ -97,6 +102,7 @@ void Material::set_sigma_f(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_sigma_f[g][m] = v;
+  set_packed(PACKED_SIGMA_F, m, g, v);
 }
 
 //---------------------------------------------------------------------------//
@@ -106,6 +112,7 @@ void Material::set_nu(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_nu[g][m] = v;
+  set_packed(PACKED_NU, m, g, v);
 }
 
 //---------------------------------------------------------------------------//
@@ -115,6 +122,7 @@ void Material::set_chi(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_chi[g][m] = v;
+  set_packed(PACKED_CHI, m, g, v);
 }
 
 //---------------------------------------------------------------------------//
@@ -126,6 +134,19 @@ void Material::set_sigma_s(size_t m, size_t g, size_t gp, double v)
   Require(gp < d_number_groups);
   Require(v >= 0.0);
   d_sigma_s[g][gp][m] = v;
+  ++d_revision;
+  if (!d_finalized) return;
+  // A new coupling outside the band widens it.
+  if (gp >= d_scatter_bounds[g][0] && gp <= d_scatter_bounds[g][1])
+  {
+    d_packed_sigma_s[d_packed_sigma_s_offset[g] +
+                     (gp - d_scatter_bounds[g][0]) * d_number_materials + m] = v;
+  }
+  else if (v > 0.0)
+  {
+    widen_scatter_bounds(g, gp);
+    pack_sigma_s();
+  }
 }
 
 //---------------------------------------------------------------------------//
@@ -135,6 +156,7 @@ void Material::set_diff_coef(size_t m, size_t g, double v)
   Require(g < d_number_groups);
   Require(v >= 0.0);
   d_diff_coef[g][m] = v;
+  set_packed(PACKED_DIFF_COEF, m, g, v);
 }
 
 // Vectorized
@@ -145,7 +167,10 @@ void Material::set_sigma_t(size_t m, vec_dbl &v)
   Require(m < d_number_materials);
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
+  {
     d_sigma_t[g][m] = v[g];
+    set_packed(PACKED_SIGMA_T, m, g, v[g]);
+  }
 }
 
 //---------------------------------------------------------------------------//
@@ -154,7 +179,10 @@ void Material::set_sigma_a(size_t m, vec_dbl &v)
   Require(m < d_number_materials);
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
+  {
     d_sigma_a[g][m] = v[g];
+    set_packed(PACKED_SIGMA_A, m, g, v[g]);
+  }
 }
 
 //---------------------------------------------------------------------------//
@@ -163,7 +191,10 @@ void Material::set_nu_sigma_f(size_t m, vec_dbl &v)
   Require(m < d_number_materials);
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
+  {
     d_nu_sigma_f[g][m] = v[g];
+    set_packed(PACKED_NU_SIGMA_F, m, g, v[g]);
+  }
 }
 
 //---------------------------------------------------------------------------//
@@ -172,7 +203,10 @@ void Material::set_sigma_f(size_t m, vec_dbl &v)
   Require(m < d_number_materials);
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
+  {
     d_sigma_f[g][m] = v[g];
+    set_packed(PACKED_SIGMA_F, m, g, v[g]);
+  }
 }
 
 //---------------------------------------------------------------------------//
@@ -181,7 +215,10 @@ void Material::set_nu(size_t m, vec_dbl &v)
   Require(m < d_number_materials);
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
+  {
     d_nu[g][m] = v[g];
+    set_packed(PACKED_NU, m, g, v[g]);
+  }
 }
 
 //---------------------------------------------------------------------------//
@@ -190,7 +227,10 @@ void Material::set_chi(size_t m, vec_dbl &v)
   Require(m < d_number_materials);
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
+  {
     d_chi[g][m] = v[g];
+    set_packed(PACKED_CHI, m, g, v[g]);
+  }
 }
 
 //---------------------------------------------------------------------------//
@@ -202,6 +242,11 @@ void Material::set_sigma_s(size_t m, size_t g, vec_dbl &v)
   d_sigma_s[m][g] = v;
   for (size_t gp = 0; gp < d_number_groups; gp++)
     d_sigma_s[g][gp][m] = v[gp];
+  ++d_revision;
+  if (!d_finalized) return;
+  for (size_t gp = 0; gp < d_number_groups; gp++)
+    if (v[gp] > 0.0) widen_scatter_bounds(g, gp);
+  pack_sigma_s();
 }
 
 //---------------------------------------------------------------------------//
@@ -210,7 +255,10 @@ void Material::set_diff_coef(size_t m, vec_dbl &v)
   Require(m < d_number_materials);
   Require(v.size() == d_number_groups);
   for (size_t g = 0; g < d_number_groups; g++)
+  {
     d_diff_coef[g][m] = v[g];
+    set_packed(PACKED_DIFF_COEF, m, g, v[g]);
+  }
 }
 
 //----------------------------------------------------------------------------//
@@ -246,6 +294,8 @@ void Material::compute_sigma_a()
       d_sigma_a[g][m] = sa;
     }
   }
+  ++d_revision;
+  if (d_finalized) pack();
 }
 
 //----------------------------------------------------------------------------//
@@ -259,6 +309,8 @@ void Material::compute_diff_coef()
       d_diff_coef[g][m] =  coef / d_sigma_t[g][m];
     }
   }
+  ++d_revision;
+  if (d_finalized) pack();
 }
 
 //----------------------------------------------------------------------------//
@@ -329,9 +381,65 @@ void Material::finalize()
     d_downscatter = true;
   }
 
+  pack();
   d_finalized = true;
 }
 
+//----------------------------------------------------------------------------//
+void Material::pack()
+{
+  ++d_revision;
+  size_t nm = d_number_materials;
+
+  // Cross sections, with all data for a group adjacent.
+  d_packed_xs.assign(d_number_groups * END_PACKED_XS * nm, 0.0);
+  for (size_t g = 0; g < d_number_groups; g++)
+  {
+    for (size_t m = 0; m < nm; m++)
+    {
+      d_packed_xs[packed_index(PACKED_SIGMA_T,    m, g)] = d_sigma_t[g][m];
+      d_packed_xs[packed_index(PACKED_SIGMA_A,    m, g)] = d_sigma_a[g][m];
+      d_packed_xs[packed_index(PACKED_NU_SIGMA_F, m, g)] = d_nu_sigma_f[g][m];
+      d_packed_xs[packed_index(PACKED_SIGMA_F,    m, g)] = d_sigma_f[g][m];
+      d_packed_xs[packed_index(PACKED_NU,         m, g)] = d_nu[g][m];
+      d_packed_xs[packed_index(PACKED_CHI,        m, g)] = d_chi[g][m];
+      d_packed_xs[packed_index(PACKED_DIFF_COEF,  m, g)] = d_diff_coef[g][m];
+    }
+  }
+  pack_sigma_s();
+}
+
+//----------------------------------------------------------------------------//
+void Material::pack_sigma_s()
+{
+  size_t nm = d_number_materials;
+
+  // Scattering, keeping only the incident groups within the bounds.
+  d_packed_sigma_s_offset.assign(d_number_groups + 1, 0);
+  for (size_t g = 0; g < d_number_groups; g++)
+  {
+    size_t width = d_scatter_bounds[g][1] - d_scatter_bounds[g][0] + 1;
+    d_packed_sigma_s_offset[g + 1] = d_packed_sigma_s_offset[g] + width * nm;
+  }
+  d_packed_sigma_s.assign(d_packed_sigma_s_offset[d_number_groups], 0.0);
+  for (size_t g = 0; g < d_number_groups; g++)
+  {
+    size_t i = d_packed_sigma_s_offset[g];
+    for (size_t gp = d_scatter_bounds[g][0]; gp <= d_scatter_bounds[g][1]; gp++)
+      for (size_t m = 0; m < nm; m++, i++)
+        d_packed_sigma_s[i] = d_sigma_s[g][gp][m];
+  }
+}
+
+//----------------------------------------------------------------------------//
+void Material::widen_scatter_bounds(const size_t g, const size_t gp)
+{
+  d_scatter_bounds[g][0] = std::min(gp, d_scatter_bounds[g][0]);
+  d_scatter_bounds[g][1] = std::max(gp, d_scatter_bounds[g][1]);
+  // Upscatter into g moves the cutoff down to g.
+  if (gp > g && g < d_upscatter_cutoff) d_upscatter_cutoff = g;
+}
+
 void Material::display()
 {
   material_display();
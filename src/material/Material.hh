@@ -31,6 +31,15 @@ namespace detran_material
  *
  *  All data is stored with the material index changing fastest.  This
  *  appears to be the best storage scheme with respect to memory access.
+ *
+ *  Upon finalization, the data is also packed into a single group-major
+ *  contiguous store.  For each group, the cross sections occupy
+ *  consecutive rows indexed by material, and the scattering matrix is
+ *  kept only within the band \f$ [\mathrm{lower}(g), \mathrm{upper}(g)] \f$
+ *  of incident groups.  The getters read from the packed store once the
+ *  material is finalized, and the row accessors give the sources direct
+ *  access to a contiguous row of values for all materials.  Setters
+ *  called after finalization keep both representations in sync.
  */
 //---------------------------------------------------------------------------//
 class MATERIAL_EXPORT Material
@@ -161,6 +170,41 @@ public:
    */
   size_t upper(size_t g) const;
 
+  //@{
+  /**
+   *  @brief Contiguous row of a cross section for all materials.
+   *
+   *  The returned pointer is indexed by material and is valid until
+   *  the material is finalized again.  Requires finalization.
+   */
+  const double* sigma_t_row(size_t g) const;
+  const double* nu_sigma_f_row(size_t g) const;
+  const double* chi_row(size_t g) const;
+  //@}
+
+  /**
+   *  @brief Contiguous row of \f$ \Sigma_s(g \leftarrow g') \f$ for all
+   *         materials.
+   *
+   *  Only incident groups within the scatter band, i.e.
+   *  lower(g) <= gp <= upper(g), are stored.  The pointer is valid
+   *  until the band is widened by a new coupling or the material is
+   *  finalized again.  Requires finalization.
+   */
+  const double* sigma_s_row(size_t g, size_t gp) const;
+
+  /// Has the material been finalized?
+  bool finalized() const
+  {
+    return d_finalized;
+  }
+
+  /// Counter incremented whenever the cross sections change.
+  size_t revision() const
+  {
+    return d_revision;
+  }
+
   /// Do we do only downscatter?
   bool downscatter()
   {
@@ -233,17 +277,55 @@ protected:
   size_t d_upscatter_cutoff;
   /// Are we ready to be used?
   bool d_finalized;
+  /// Packed cross sections [group, xs, material]
+  vec_dbl d_packed_xs;
+  /// Packed, banded scatter [group, group' - lower(group), material]
+  vec_dbl d_packed_sigma_s;
+  /// Offset of each group's scatter band in the packed store [group + 1]
+  vec_size_t d_packed_sigma_s_offset;
+  /// Revision counter for caches of derived data
+  size_t d_revision;
 
   //-------------------------------------------------------------------------//
   // IMPLEMENTATION
   //-------------------------------------------------------------------------//
 
+  /// Cross sections held in the packed store
+  enum PACKED_XS
+  {
+    PACKED_SIGMA_T, PACKED_SIGMA_A, PACKED_NU_SIGMA_F, PACKED_SIGMA_F,
+    PACKED_NU, PACKED_CHI, PACKED_DIFF_COEF, END_PACKED_XS
+  };
+
   void material_display();
 
+  /// Build the packed store from the current data.
+  void pack();
+
+  /// Build the packed scattering band from the current data and bounds.
+  void pack_sigma_s();
+
+  /// Widen the scatter bounds of a group to include an incident group.
+  void widen_scatter_bounds(const size_t g, const size_t gp);
+
+  /// Index of a value in the packed cross section store
+  size_t packed_index(const size_t xs, const size_t m, const size_t g) const
+  {
+    return (g * END_PACKED_XS + xs) * d_number_materials + m;
+  }
+
+  /// Update a single packed value if the material is finalized.
+  void set_packed(const size_t xs, const size_t m, const size_t g,
+                  const double v)
+  {
+    ++d_revision;
+    if (d_finalized) d_packed_xs[packed_index(xs, m, g)] = v;
+  }
+
 #ifdef DETRAN_ENABLE_BOOST
 
   /// Default constructor needed for serialization
-  Material(){}
+  Material() : d_revision(0) {}
 
   friend class boost::serialization::access;
 
@@ -264,6 +346,9 @@ protected:
     ar & d_scatter_bounds;
     ar & d_upscatter_cutoff;
     ar & d_finalized;
+    ar & d_packed_xs;
+    ar & d_packed_sigma_s;
+    ar & d_packed_sigma_s_offset;
   }
 
 #endif
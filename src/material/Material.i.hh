@@ -19,6 +19,7 @@ inline double Material::sigma_t(size_t m, size_t g) const
 {
   Require(m < d_number_materials);
   Require(g < d_number_groups);
+  if (d_finalized) return d_packed_xs[packed_index(PACKED_SIGMA_T, m, g)];
   return d_sigma_t[g][m];
 }
 
@@ -27,6 +28,7 @@ inline double Material::sigma_a(size_t m, size_t g) const
 {
   Require(m < d_number_materials);
   Require(g < d_number_groups);
+  if (d_finalized) return d_packed_xs[packed_index(PACKED_SIGMA_A, m, g)];
   return d_sigma_a[g][m];
 }
 
@@ -35,6 +37,7 @@ inline double Material::nu_sigma_f(size_t m, size_t g) const
 {
   Require(m < d_number_materials);
   Require(g < d_number_groups);
+  if (d_finalized) return d_packed_xs[packed_index(PACKED_NU_SIGMA_F, m, g)];
   return d_nu_sigma_f[g][m];
 }
 
@@ -43,6 +46,7 @@ inline double Material::sigma_f(size_t m, size_t g) const
 {
   Require(m < d_number_materials);
   Require(g < d_number_groups);
+  if (d_finalized) return d_packed_xs[packed_index(PACKED_SIGMA_F, m, g)];
   return d_sigma_f[g][m];
 }
 
@@ -51,6 +55,7 @@ inline double Material::nu(size_t m, size_t g) const
 {
   Require(m < d_number_materials);
   Require(g < d_number_groups);
+  if (d_finalized) return d_packed_xs[packed_index(PACKED_NU, m, g)];
   return d_nu[g][m];
 }
 
@@ -59,6 +64,7 @@ inline double Material::chi(size_t m, size_t g) const
 {
   Require(m < d_number_materials);
   Require(g < d_number_groups);
+  if (d_finalized) return d_packed_xs[packed_index(PACKED_CHI, m, g)];
   return d_chi[g][m];
 }
 
@@ -68,14 +74,54 @@ inline double Material::sigma_s(size_t m, size_t g, size_t gp) const
   Require(m < d_number_materials);
   Require(g < d_number_groups);
   Require(gp < d_number_groups);
+  if (d_finalized &&
+      gp >= d_scatter_bounds[g][0] && gp <= d_scatter_bounds[g][1])
+  {
+    return sigma_s_row(g, gp)[m];
+  }
   return d_sigma_s[g][gp][m];
 }
 
+//---------------------------------------------------------------------------//
+inline const double* Material::sigma_t_row(size_t g) const
+{
+  Require(d_finalized);
+  Require(g < d_number_groups);
+  return &d_packed_xs[packed_index(PACKED_SIGMA_T, 0, g)];
+}
+
+//---------------------------------------------------------------------------//
+inline const double* Material::nu_sigma_f_row(size_t g) const
+{
+  Require(d_finalized);
+  Require(g < d_number_groups);
+  return &d_packed_xs[packed_index(PACKED_NU_SIGMA_F, 0, g)];
+}
+
+//---------------------------------------------------------------------------//
+inline const double* Material::chi_row(size_t g) const
+{
+  Require(d_finalized);
+  Require(g < d_number_groups);
+  return &d_packed_xs[packed_index(PACKED_CHI, 0, g)];
+}
+
+//---------------------------------------------------------------------------//
+inline const double* Material::sigma_s_row(size_t g, size_t gp) const
+{
+  Require(d_finalized);
+  Require(g < d_number_groups);
+  Require(gp >= d_scatter_bounds[g][0] && gp <= d_scatter_bounds[g][1]);
+  return &d_packed_sigma_s[d_packed_sigma_s_offset[g] +
+                           (gp - d_scatter_bounds[g][0]) * d_number_materials];
+}
+
 //---------------------------------------------------------------------------//
 inline double Material::diff_coef(size_t m, size_t g) const
 {
   Require(m < d_number_materials);
   Require(g < d_number_groups);
+  if (d_finalized) return d_packed_xs[packed_index(PACKED_DIFF_COEF, m, g)];
   return d_diff_coef[g][m];
 }
 
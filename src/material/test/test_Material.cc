@@ -11,7 +11,8 @@
 #define TEST_LIST                     \
         FUNC(test_Material_basic)     \
         FUNC(test_Material_bounds)    \
-        FUNC(test_Material_serialize)
+        FUNC(test_Material_serialize) \
+        FUNC(test_Material_packed)
 
 // Detran headers
 #include "TestDriver.hh"
@@ -153,6 +154,52 @@ int test_Material_serialize(int argc, char *argv[])
   return 0;
 }
 
+// Test of the packed store and its synchronization with the setters
+int test_Material_packed(int argc, char *argv[])
+{
+  // Get the 7g material.
+  SP_material mat = material_fixture_7g();
+
+  // Rows must match the element-wise getters.
+  for (int g = 0; g < 7; g++)
+  {
+    const double *sigma_t = mat->sigma_t_row(g);
+    const double *chi     = mat->chi_row(g);
+    for (int m = 0; m < mat->number_materials(); m++)
+    {
+      TEST(sigma_t[m] == mat->sigma_t(m, g));
+      TEST(chi[m]     == mat->chi(m, g));
+    }
+    for (int gp = mat->lower(g); gp <= mat->upper(g); gp++)
+    {
+      const double *sigma_s = mat->sigma_s_row(g, gp);
+      for (int m = 0; m < mat->number_materials(); m++)
+        TEST(sigma_s[m] == mat->sigma_s(m, g, gp));
+    }
+  }
+
+  // Setting values after finalization updates the packed store.
+  mat->set_sigma_t(1, 3, 2.0);
+  TEST(mat->sigma_t(1, 3)       == 2.0);
+  TEST(mat->sigma_t_row(3)[1]   == 2.0);
+  mat->set_sigma_s(1, 5, 2, 0.25);
+  TEST(mat->sigma_s(1, 5, 2)    == 0.25);
+  TEST(mat->sigma_s_row(5, 2)[1] == 0.25);
+
+  // A new coupling outside the band widens the bounds, keeping the
+  // other cross sections as set.
+  mat->set_nu_sigma_f(0, 0, 0.5);
+  TEST(mat->upper(0) == 0);
+  mat->set_sigma_s(0, 0, 3, 0.01);
+  TEST(mat->upper(0) == 3);
+  TEST(mat->upscatter_cutoff()  == 0);
+  TEST(mat->sigma_s(0, 0, 3)    == 0.01);
+  TEST(mat->sigma_s_row(0, 3)[0] == 0.01);
+  TEST(mat->sigma_s_row(5, 2)[1] == 0.25);
+  TEST(mat->nu_sigma_f(0, 0)    == 0.5);
+
+  return 0;
+}
 
 //---------------------------------------------------------------------------//
 //              end of test_Material.cc
@@ -10,6 +10,9 @@
 #include "DCT.hh"
 #include "utilities/Constants.hh"
 #include <cmath>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 namespace detran_orthog
 {
@@ -17,6 +20,7 @@ namespace detran_orthog
 //---------------------------------------------------------------------------//
 DCT::DCT(const size_t order, const size_t size)
   : OrthogonalBasis(order, size)
+  , d_fft(size)
 {
   using detran_utilities::pi;
 
@@ -28,8 +32,169 @@ DCT::DCT(const size_t order, const size_t size)
       (*d_basis)(i, j) = std::cos((pi/d_size) * (j + 0.5) * i);
   compute_a();
 
+  d_shift.resize(d_size);
+  for (size_t k = 0; k < d_size; ++k)
+    d_shift[k] = std::polar(1.0, -0.5 * pi * k / d_size);
+
+  // One workspace for each thread that may share a batch.
+  int number_threads = 1;
+#ifdef DETRAN_ENABLE_OPENMP
+  number_threads = omp_get_max_threads();
+#endif
+  reserve_work(number_threads);
+}
+
+//---------------------------------------------------------------------------//
+void DCT::transform(const size_t  number,
+                    const double *f,
+                    const size_t  f_stride,
+                    const size_t  f_distance,
+                    double       *ftilde,
+                    const size_t  ft_stride,
+                    const size_t  ft_distance)
+{
+  const int n = number;
+#ifdef DETRAN_ENABLE_OPENMP
+  if (n > 1 && !omp_in_parallel())
+  {
+    #pragma omp parallel default(shared)
+    {
+      #pragma omp single
+      reserve_work(omp_get_num_threads());
+      FFT::complex_t *work = &d_work[omp_get_thread_num()][0];
+      #pragma omp for
+      for (int v = 0; v < n; ++v)
+      {
+        transform_one(f + v * f_distance, f_stride,
+                      ftilde + v * ft_distance, ft_stride, work);
+      }
+    }
+    return;
+  }
+#endif
+  FFT::vec_complex local;
+  FFT::complex_t *work = thread_work(local);
+  for (int v = 0; v < n; ++v)
+  {
+    transform_one(f + v * f_distance, f_stride,
+                  ftilde + v * ft_distance, ft_stride, work);
+  }
+}
+
+//---------------------------------------------------------------------------//
+void DCT::inverse(const size_t  number,
+                  const double *ftilde,
+                  const size_t  ft_stride,
+                  const size_t  ft_distance,
+                  double       *f,
+                  const size_t  f_stride,
+                  const size_t  f_distance)
+{
+  const int n = number;
+#ifdef DETRAN_ENABLE_OPENMP
+  if (n > 1 && !omp_in_parallel())
+  {
+    #pragma omp parallel default(shared)
+    {
+      #pragma omp single
+      reserve_work(omp_get_num_threads());
+      FFT::complex_t *work = &d_work[omp_get_thread_num()][0];
+      #pragma omp for
+      for (int v = 0; v < n; ++v)
+      {
+        inverse_one(ftilde + v * ft_distance, ft_stride,
+                    f + v * f_distance, f_stride, work);
+      }
+    }
+    return;
+  }
+#endif
+  FFT::vec_complex local;
+  FFT::complex_t *work = thread_work(local);
+  for (int v = 0; v < n; ++v)
+  {
+    inverse_one(ftilde + v * ft_distance, ft_stride,
+                f + v * f_distance, f_stride, work);
+  }
+}
+
+//---------------------------------------------------------------------------//
+void DCT::reserve_work(const size_t number_threads)
+{
+  if (d_work.size() < number_threads)
+    d_work.resize(number_threads,
+                  FFT::vec_complex(d_size + d_fft.workspace_size()));
 }
 
+//---------------------------------------------------------------------------//
+FFT::complex_t* DCT::thread_work(FFT::vec_complex &local)
+{
+  size_t t = 0;
+#ifdef DETRAN_ENABLE_OPENMP
+  // Threads of nested regions share numbers, and a region may have
+  // more threads than there were when the workspaces were reserved.
+  if (omp_in_parallel())
+  {
+    t = omp_get_thread_num();
+    if (omp_get_level() > 1 || t >= d_work.size())
+    {
+      local.resize(d_size + d_fft.workspace_size());
+      return &local[0];
+    }
+  }
+#endif
+  return &d_work[t][0];
+}
+
+//---------------------------------------------------------------------------//
+void DCT::transform_one(const double   *f,
+                        const size_t    f_stride,
+                        double         *ftilde,
+                        const size_t    ft_stride,
+                        FFT::complex_t *work) const
+{
+  const size_t N = d_size;
+  FFT::complex_t *x = work;
+
+  // Even elements in order followed by odd elements in reverse.
+  for (size_t i = 0; 2 * i < N; ++i)
+    x[i] = f[2 * i * f_stride];
+  for (size_t i = 0; 2 * i + 1 < N; ++i)
+    x[N - 1 - i] = f[(2 * i + 1) * f_stride];
+  d_fft.forward(x, work + N);
+  for (size_t l = 0; l <= d_order; ++l)
+    ftilde[l * ft_stride] = std::real(d_shift[l] * x[l]);
+}
+
+//---------------------------------------------------------------------------//
+void DCT::inverse_one(const double   *ftilde,
+                      const size_t    ft_stride,
+                      double         *f,
+                      const size_t    f_stride,
+                      FFT::complex_t *work) const
+{
+  const size_t N = d_size;
+  FFT::complex_t *x = work;
+
+  // Scale the coefficients to those of an unnormalized DCT-II, i.e.
+  // X_0 = N a_0 c_0 and X_k = N a_k c_k / 2, padded with zeros, and
+  // rebuild the transform of the reordered vector.
+  for (size_t k = 0; k < N; ++k)
+  {
+    double X_k = 0.0, X_Nk = 0.0;
+    if (k <= d_order)
+      X_k = (*d_a)[k] * ftilde[k * ft_stride] * (k ? 0.5 * N : N);
+    if (k && N - k <= d_order)
+      X_Nk = (*d_a)[N - k] * ftilde[(N - k) * ft_stride] * 0.5 * N;
+    x[k] = std::conj(d_shift[k]) * FFT::complex_t(X_k, -X_Nk);
+  }
+  d_fft.backward(x, work + N);
+  const double scale = 1.0 / N;
+  for (size_t i = 0; 2 * i < N; ++i)
+    f[2 * i * f_stride] = scale * std::real(x[i]);
+  for (size_t i = 0; 2 * i + 1 < N; ++i)
+    f[(2 * i + 1) * f_stride] = scale * std::real(x[N - 1 - i]);
+}
 
 } // end namespace detran_orthog
 
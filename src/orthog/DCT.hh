@@ -11,6 +11,7 @@
 #define detran_orthog_DCT_HH_
 
 #include "OrthogonalBasis.hh"
+#include "FFT.hh"
 
 namespace detran_orthog
 {
@@ -18,6 +19,18 @@ namespace detran_orthog
 /**
  *  @class DCT
  *  @brief Discrete cosine transform
+ *
+ *  The basis is @f$ P_{ij} = \cos(\pi (j + 1/2) i / N) @f$, so the
+ *  transform is the DCT-II and the inverse is the DCT-III.  Both are
+ *  evaluated in @f$ O(N \log N) @f$ by a single complex FFT of length
+ *  N following Makhoul, rather than by the dense basis, which is kept
+ *  for folding and element access.  The FFT is set up at construction
+ *  and shared by all threads, each of which transforms in its own
+ *  workspace.  The workspaces are kept between calls, so a batch is
+ *  threaded over the vectors without allocating.  A batch of one
+ *  vector, or a call from within a parallel region, is done by the
+ *  calling thread alone in its workspace, or in a temporary one if the
+ *  region is nested or has more threads than any earlier batch.
  */
 class ORTHOG_EXPORT DCT: public OrthogonalBasis
 {
@@ -38,6 +51,75 @@ public:
   /// Virtual destructor
   virtual ~DCT(){}
 
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  using OrthogonalBasis::transform;
+  using OrthogonalBasis::inverse;
+
+  /// Batched DCT-II
+  void transform(const size_t  number,
+                 const double *f,
+                 const size_t  f_stride,
+                 const size_t  f_distance,
+                 double       *ftilde,
+                 const size_t  ft_stride,
+                 const size_t  ft_distance);
+
+  /// Batched DCT-III
+  void inverse(const size_t  number,
+               const double *ftilde,
+               const size_t  ft_stride,
+               const size_t  ft_distance,
+               double       *f,
+               const size_t  f_stride,
+               const size_t  f_distance);
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // DATA
+  //-------------------------------------------------------------------------//
+
+  /// FFT of length N, shared by all threads
+  const FFT d_fft;
+  /// Shift factors exp(-i pi k / 2N)
+  FFT::vec_complex d_shift;
+  /// Workspace of each thread, the reordered vector followed by that
+  /// of the FFT
+  std::vector<FFT::vec_complex> d_work;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Ensure there is a workspace for each of a number of threads
+  void reserve_work(const size_t number_threads);
+
+  /**
+   *  @brief Workspace of the calling thread outside a batch region
+   *
+   *  This is the thread's own workspace if it belongs to the only
+   *  enclosing parallel region and one was reserved for it, and is
+   *  otherwise the given local workspace sized to fit.
+   */
+  FFT::complex_t* thread_work(FFT::vec_complex &local);
+
+  /// DCT-II of one vector using the given workspace
+  void transform_one(const double   *f,
+                     const size_t    f_stride,
+                     double         *ftilde,
+                     const size_t    ft_stride,
+                     FFT::complex_t *work) const;
+
+  /// DCT-III of one vector using the given workspace
+  void inverse_one(const double   *ftilde,
+                   const size_t    ft_stride,
+                   double         *f,
+                   const size_t    f_stride,
+                   FFT::complex_t *work) const;
+
 };
 
 } // end namespace detran_orthog
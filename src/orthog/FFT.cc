@@ -0,0 +1,137 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   FFT.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  FFT member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#include "FFT.hh"
+#include "utilities/Constants.hh"
+#include "utilities/DBC.hh"
+#include <cmath>
+
+namespace detran_orthog
+{
+
+//---------------------------------------------------------------------------//
+FFT::FFT(const size_t n)
+  : d_n(n)
+  , d_m(1)
+{
+  using detran_utilities::pi;
+  Require(d_n > 0);
+
+  // The radix-2 length is n itself if a power of two and otherwise
+  // large enough for the Bluestein convolution.
+  bool power_of_two = !(d_n & (d_n - 1));
+  size_t m_min = power_of_two ? d_n : 2 * d_n - 1;
+  while (d_m < m_min) d_m *= 2;
+
+  // Radix-2 twiddles and bit reversal.
+  d_twiddle.resize(d_m / 2);
+  for (size_t k = 0; k < d_m / 2; ++k)
+    d_twiddle[k] = std::polar(1.0, -2.0 * pi * k / d_m);
+  d_reverse.assign(d_m, 0);
+  size_t bits = 0;
+  while ((size_t(1) << bits) < d_m) ++bits;
+  for (size_t i = 0; i < d_m; ++i)
+  {
+    size_t r = 0;
+    for (size_t b = 0; b < bits; ++b)
+      if (i & (size_t(1) << b)) r |= size_t(1) << (bits - 1 - b);
+    d_reverse[i] = r;
+  }
+  if (power_of_two) return;
+
+  // Bluestein chirp.  The square is reduced modulo 2n to keep the
+  // angle small.
+  d_chirp.resize(d_n);
+  for (size_t j = 0; j < d_n; ++j)
+  {
+    size_t jj = (j * j) % (2 * d_n);
+    d_chirp[j] = std::polar(1.0, -pi * jj / d_n);
+  }
+
+  // Transform of the convolution kernel, with the 1/m of the
+  // backward transform folded in.
+  d_kernel.assign(d_m, complex_t(0.0, 0.0));
+  d_kernel[0] = std::conj(d_chirp[0]);
+  for (size_t j = 1; j < d_n; ++j)
+  {
+    d_kernel[j]       = std::conj(d_chirp[j]);
+    d_kernel[d_m - j] = std::conj(d_chirp[j]);
+  }
+  radix2(&d_kernel[0], false);
+  for (size_t j = 0; j < d_m; ++j)
+    d_kernel[j] /= double(d_m);
+}
+
+//---------------------------------------------------------------------------//
+void FFT::forward(complex_t *x, complex_t *work) const
+{
+  Require(x);
+  if (d_chirp.empty())
+  {
+    radix2(x, false);
+    return;
+  }
+
+  // Bluestein: X_k = w_k sum_n (x_n w_n) conj(w_{k-n}).
+  Require(work);
+  for (size_t j = 0; j < d_n; ++j)
+    work[j] = x[j] * d_chirp[j];
+  for (size_t j = d_n; j < d_m; ++j)
+    work[j] = 0.0;
+  radix2(work, false);
+  for (size_t j = 0; j < d_m; ++j)
+    work[j] *= d_kernel[j];
+  radix2(work, true);
+  for (size_t k = 0; k < d_n; ++k)
+    x[k] = work[k] * d_chirp[k];
+}
+
+//---------------------------------------------------------------------------//
+void FFT::backward(complex_t *x, complex_t *work) const
+{
+  Require(x);
+  if (d_chirp.empty())
+  {
+    radix2(x, true);
+    return;
+  }
+  for (size_t j = 0; j < d_n; ++j)
+    x[j] = std::conj(x[j]);
+  forward(x, work);
+  for (size_t j = 0; j < d_n; ++j)
+    x[j] = std::conj(x[j]);
+}
+
+//---------------------------------------------------------------------------//
+void FFT::radix2(complex_t *x, const bool backward) const
+{
+  for (size_t i = 0; i < d_m; ++i)
+    if (i < d_reverse[i]) std::swap(x[i], x[d_reverse[i]]);
+  for (size_t half = 1; half < d_m; half *= 2)
+  {
+    const size_t step = d_m / (2 * half);
+    for (size_t start = 0; start < d_m; start += 2 * half)
+    {
+      for (size_t j = 0; j < half; ++j)
+      {
+        complex_t w = d_twiddle[j * step];
+        if (backward) w = std::conj(w);
+        complex_t t = w * x[start + j + half];
+        x[start + j + half] = x[start + j] - t;
+        x[start + j]       += t;
+      }
+    }
+  }
+}
+
+} // end namespace detran_orthog
+
+//---------------------------------------------------------------------------//
+//              end of file FFT.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,123 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   FFT.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  FFT class definition.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_orthog_FFT_HH_
+#define detran_orthog_FFT_HH_
+
+#include "orthog/orthog_export.hh"
+#include "utilities/Definitions.hh"
+#include <complex>
+#include <vector>
+
+namespace detran_orthog
+{
+
+/**
+ *  @class FFT
+ *  @brief Complex discrete Fourier transform of a fixed length
+ *
+ *  The forward transform is
+ *  @f[
+ *      X_k = \sum^{N-1}_{n=0} x_n e^{-2\pi i k n / N} \, ,
+ *  @f]
+ *  and the backward transform has the opposite sign in the exponent
+ *  and no scaling, so that backward(forward(x)) = N x.
+ *
+ *  Power of two lengths use an iterative radix-2 transform.  Any other
+ *  length uses Bluestein's algorithm, which writes the transform as a
+ *  convolution that is evaluated by radix-2 transforms of a padded
+ *  length.  Either way, the cost is @f$ O(N \log N) @f$.  Twiddle
+ *  factors and the Bluestein chirp and kernel are set up at
+ *  construction and never change, while the padded convolution is
+ *  formed in a workspace owned by the caller.  Hence, a transform does
+ *  not allocate, and one object may be shared by any number of threads
+ *  so long as each passes its own workspace.
+ */
+class ORTHOG_EXPORT FFT
+{
+
+public:
+
+  //-------------------------------------------------------------------------//
+  // TYPEDEFS
+  //-------------------------------------------------------------------------//
+
+  typedef std::complex<double>          complex_t;
+  typedef std::vector<complex_t>        vec_complex;
+  typedef detran_utilities::size_t      size_t;
+
+  //-------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *  @param n  Length of the transform
+   */
+  explicit FFT(const size_t n = 1);
+
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief In place forward transform of n values
+   *  @param x      Values to transform
+   *  @param work   Workspace of workspace_size() values
+   */
+  void forward(complex_t *x, complex_t *work) const;
+
+  /**
+   *  @brief In place unscaled backward transform of n values
+   *  @param x      Values to transform
+   *  @param work   Workspace of workspace_size() values
+   */
+  void backward(complex_t *x, complex_t *work) const;
+
+  /// Length of the transform
+  size_t size() const { return d_n; }
+
+  /// Length of the workspace, which is zero for a power of two length
+  size_t workspace_size() const { return d_chirp.empty() ? 0 : d_m; }
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // DATA
+  //-------------------------------------------------------------------------//
+
+  /// Length of the transform
+  size_t d_n;
+  /// Length of the radix-2 transforms
+  size_t d_m;
+  /// Twiddle factors of the radix-2 transforms
+  vec_complex d_twiddle;
+  /// Bit reversed index of the radix-2 transforms
+  std::vector<size_t> d_reverse;
+  /// Bluestein chirp, exp(-i pi n^2 / N)
+  vec_complex d_chirp;
+  /// Radix-2 transform of the Bluestein convolution kernel
+  vec_complex d_kernel;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// In place radix-2 transform of length d_m
+  void radix2(complex_t *x, const bool backward) const;
+
+};
+
+} // end namespace detran_orthog
+
+#endif // detran_orthog_FFT_HH_
+
+//---------------------------------------------------------------------------//
+//              end of file FFT.hh
+//---------------------------------------------------------------------------//
@@ -55,12 +55,79 @@ void OrthogonalBasis::compute_a()
     }
     else
     {
-      (*d_a)[i] = val;
+      (*d_a)[i] = val * val;
     }
   }
 
 }
 
+//---------------------------------------------------------------------------//
+void OrthogonalBasis::transform(const size_t  number,
+                                const double *f,
+                                const size_t  f_stride,
+                                const size_t  f_distance,
+                                double       *ftilde,
+                                const size_t  ft_stride,
+                                const size_t  ft_distance)
+{
+  Require(d_basis);
+  const double *P = &(*d_basis)(0, 0);
+  const double *w = d_w ? &(*d_w)[0] : 0;
+  const int n = number;
+  #pragma omp parallel for default(shared)
+  for (int v = 0; v < n; ++v)
+  {
+    const double *f_v  = f + v * f_distance;
+    double       *ft_v = ftilde + v * ft_distance;
+    for (size_t l = 0; l <= d_order; ++l)
+    {
+      const double *P_l = P + l * d_size;
+      double value = 0.0;
+      if (w)
+      {
+        for (size_t i = 0; i < d_size; ++i)
+          value += P_l[i] * w[i] * f_v[i * f_stride];
+      }
+      else
+      {
+        for (size_t i = 0; i < d_size; ++i)
+          value += P_l[i] * f_v[i * f_stride];
+      }
+      ft_v[l * ft_stride] = value;
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+void OrthogonalBasis::inverse(const size_t  number,
+                              const double *ftilde,
+                              const size_t  ft_stride,
+                              const size_t  ft_distance,
+                              double       *f,
+                              const size_t  f_stride,
+                              const size_t  f_distance)
+{
+  Require(d_basis);
+  const double *P = &(*d_basis)(0, 0);
+  const double *a = d_a ? &(*d_a)[0] : 0;
+  const int n = number;
+  #pragma omp parallel for default(shared)
+  for (int v = 0; v < n; ++v)
+  {
+    const double *ft_v = ftilde + v * ft_distance;
+    double       *f_v  = f + v * f_distance;
+    for (size_t i = 0; i < d_size; ++i)
+      f_v[i * f_stride] = 0.0;
+    for (size_t l = 0; l <= d_order; ++l)
+    {
+      const double *P_l = P + l * d_size;
+      const double  c_l = a ? a[l] * ft_v[l * ft_stride] : ft_v[l * ft_stride];
+      for (size_t i = 0; i < d_size; ++i)
+        f_v[i * f_stride] += c_l * P_l[i];
+    }
+  }
+}
+
 } // end namespace detran_orthog
 
 //---------------------------------------------------------------------------//
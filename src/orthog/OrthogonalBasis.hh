@@ -171,6 +171,54 @@ public:
   /// Interface for std vector
   void inverse(const vec_dbl &f, vec_dbl &ftilde);
 
+  /**
+   *  @brief Transform a batch of vectors
+   *
+   *  Element @f$ i @f$ of vector @f$ v @f$ of the batch is
+   *  f[v * f_distance + i * f_stride], and coefficient @f$ l @f$ of its
+   *  transform is ftilde[v * ft_distance + l * ft_stride].  Hence, the
+   *  group spectra of all cells of a flux stored group-major, for
+   *  example, are transformed with a stride of the number of cells and
+   *  a distance of one.  The batch is threaded over the vectors and
+   *  does not allocate.
+   *
+   *  @param  number        Number of vectors
+   *  @param  f             First element of the vectors to transform
+   *  @param  f_stride      Stride between elements of a vector
+   *  @param  f_distance    Distance between consecutive vectors
+   *  @param  ftilde        First element of the transformed vectors
+   *  @param  ft_stride     Stride between coefficients of a vector
+   *  @param  ft_distance   Distance between consecutive transforms
+   */
+  virtual void transform(const size_t  number,
+                         const double *f,
+                         const size_t  f_stride,
+                         const size_t  f_distance,
+                         double       *ftilde,
+                         const size_t  ft_stride,
+                         const size_t  ft_distance);
+
+  /**
+   *  @brief Inverse transform a batch of vectors
+   *
+   *  The layout is as for the batched transform.
+   *
+   *  @param  number        Number of vectors
+   *  @param  ftilde        First element of the vectors to inverse transform
+   *  @param  ft_stride     Stride between coefficients of a vector
+   *  @param  ft_distance   Distance between consecutive vectors
+   *  @param  f             First element of the inverse transforms
+   *  @param  f_stride      Stride between elements of a vector
+   *  @param  f_distance    Distance between consecutive inverse transforms
+   */
+  virtual void inverse(const size_t  number,
+                       const double *ftilde,
+                       const size_t  ft_stride,
+                       const size_t  ft_distance,
+                       double       *f,
+                       const size_t  f_stride,
+                       const size_t  f_distance);
+
   /// Access to transform operator PW
   virtual double operator()(const size_t i, const size_t j) const;
 
@@ -186,6 +234,9 @@ public:
   /// Return the basis order.
   size_t order() const {return d_order;}
 
+  /// Return the size of the basis vectors.
+  size_t size() const {return d_size;}
+
 protected:
 
   //-------------------------------------------------------------------------//
@@ -52,7 +52,7 @@ inline double OrthogonalBasis::unfold(const size_t column, const Vector &V)
   // Extract the basis column and return the dot product
   Vector P_l(d_basis->number_rows(), 0.0);
   for (size_t i = 0; i < P_l.size(); ++i)
-    P_l = (*d_basis)(i, column);
+    P_l[i] = (*d_basis)(i, column);
   return P_l.dot(Y);
 }
 //---------------------------------------------------------------------------//
@@ -70,10 +70,9 @@ inline double OrthogonalBasis::unfold(const size_t column, const vec_dbl &V)
 //---------------------------------------------------------------------------//
 inline void OrthogonalBasis::transform(const Vector &f, Vector &ftilde)
 {
-  // Copy and vector and multiply point-wise by the weights
-  Vector wf(f);
-  if (d_w) wf.multiply(d_w);
-  d_basis->multiply(wf, ftilde);
+  Require(f.size() == d_size);
+  Require(ftilde.size() == d_order + 1);
+  transform(1, &f[0], 1, 0, &ftilde[0], 1, 0);
 }
 //---------------------------------------------------------------------------//
 inline void OrthogonalBasis::transform(SP_vector f, SP_vector ftilde)
@@ -83,33 +82,29 @@ inline void OrthogonalBasis::transform(SP_vector f, SP_vector ftilde)
 //---------------------------------------------------------------------------//
 inline void OrthogonalBasis::transform(const vec_dbl &f, vec_dbl &ftilde)
 {
-  Vector F(f);
-  Vector Ftilde(ftilde);
-  transform(F, Ftilde);
+  Require(f.size() == d_size);
+  Require(ftilde.size() == d_order + 1);
+  transform(1, &f[0], 1, 0, &ftilde[0], 1, 0);
 }
 
 //---------------------------------------------------------------------------//
 inline void OrthogonalBasis::inverse(const Vector &ftilde, Vector &f)
 {
-  // Copy and vector and multiply point-wise by the weights
-  Vector aft(ftilde);
-  if (d_a) aft.multiply(d_a);
-  double v = 0;
-  for (int i = 0; i < d_a->size(); ++i)
-    v += (*d_a)[i];
-  d_basis->multiply_transpose(aft, f);
+  Require(ftilde.size() == d_order + 1);
+  Require(f.size() == d_size);
+  inverse(1, &ftilde[0], 1, 0, &f[0], 1, 0);
 }
 //---------------------------------------------------------------------------//
 inline void OrthogonalBasis::inverse(SP_vector ftilde, SP_vector f)
 {
-  inverse(*f, *ftilde);
+  inverse(*ftilde, *f);
 }
 //---------------------------------------------------------------------------//
 inline void OrthogonalBasis::inverse(const vec_dbl &ftilde, vec_dbl &f)
 {
-  Vector F(f);
-  Vector Ftilde(ftilde);
-  inverse(Ftilde, F);
+  Require(ftilde.size() == d_order + 1);
+  Require(f.size() == d_size);
+  inverse(1, &ftilde[0], 1, 0, &f[0], 1, 0);
 }
 
 //---------------------------------------------------------------------------//
@@ -9,13 +9,19 @@
 
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST                   \
-        FUNC(test_DCT)
+        FUNC(test_DCT)              \
+        FUNC(test_DCT_dense)        \
+        FUNC(test_DCT_batch)        \
+        FUNC(test_DCT_threads)
 
 #include "utilities/TestDriver.hh"
 #include "utilities/Definitions.hh"
 #include "orthog/DCT.hh"
 #include "callow/utils/Initialization.hh"
 #include <cmath>
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 using namespace detran_orthog;
 using namespace detran_utilities;
@@ -55,16 +61,154 @@ int test_DCT(int argc, char *argv[])
   P.transform(f, ft);
   P.inverse(ft, f2);
 
-  f.display();
-  ft.display();
-  f2.display();
-  f2.subtract(f);
-  f2.display();
+  // A full order transform is inverted exactly.
+  for (int i = 0; i < N; ++i)
+    TEST(soft_equiv(f2[i], f[i]));
 
+  // The same holds through the SP interface and by unfolding.
+  callow::Vector::SP_vector ft_sp(new callow::Vector(ft));
+  callow::Vector::SP_vector f3(new callow::Vector(N, 0.0));
+  P.inverse(ft_sp, f3);
+  for (int i = 0; i < N; ++i)
+  {
+    TEST(soft_equiv((*f3)[i], f[i]));
+    TEST(soft_equiv(P.unfold(i, ft), f[i]));
+  }
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+int test_DCT_dense(int argc, char *argv[])
+{
+  // The FFT path matches the dense basis, including odd and non power
+  // of two sizes that use Bluestein's algorithm.
+  int sizes[] = {1, 2, 5, 8, 12, 17, 64};
+  for (int s = 0; s < 7; ++s)
+  {
+    int N = sizes[s];
+    int M = N > 3 ? N / 2 : N - 1;
+    DCT P(M, N);
+    callow::MatrixDense &B = *P.basis();
+    const callow::Vector &a = *P.coefficients();
+    vec_dbl f(N, 0.0);
+    double norm = 0.0;
+    for (int i = 0; i < N; ++i)
+    {
+      f[i] = 1.0 + std::sin(1.0 + 0.3 * i * i);
+      norm += std::abs(f[i]);
+    }
+
+    vec_dbl ft(M + 1, 0.0);
+    P.transform(f, ft);
+    for (int l = 0; l <= M; ++l)
+    {
+      double ref = 0.0;
+      for (int i = 0; i < N; ++i)
+        ref += B(l, i) * f[i];
+      TEST(std::abs(ft[l] - ref) < 1e-12 * N * norm);
+    }
+
+    vec_dbl f2(N, 0.0);
+    P.inverse(ft, f2);
+    for (int i = 0; i < N; ++i)
+    {
+      double ref = 0.0;
+      for (int l = 0; l <= M; ++l)
+        ref += B(l, i) * a[l] * ft[l];
+      TEST(std::abs(f2[i] - ref) < 1e-12 * N * norm);
+    }
+  }
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+int test_DCT_batch(int argc, char *argv[])
+{
+  // Spectra of 7 groups for each of 10 cells, stored group-major, are
+  // transformed in one call and compared to one transform per cell.
+  int N = 7;
+  int M = 3;
+  int number_cells = 10;
+  DCT P(M, N);
+  vec_dbl phi(N * number_cells, 0.0);
+  for (int g = 0; g < N; ++g)
+    for (int c = 0; c < number_cells; ++c)
+      phi[c + g * number_cells] = 1.0 + 0.1 * c + std::cos(0.7 * g * (c + 1));
+
+  // Moments stored cell-major
+  vec_dbl phit((M + 1) * number_cells, 0.0);
+  P.transform(number_cells, &phi[0], number_cells, 1, &phit[0], 1, M + 1);
+  vec_dbl phi2(N * number_cells, 0.0);
+  P.inverse(number_cells, &phit[0], 1, M + 1, &phi2[0], number_cells, 1);
+
+  for (int c = 0; c < number_cells; ++c)
+  {
+    vec_dbl f(N, 0.0), ft(M + 1, 0.0), f2(N, 0.0);
+    for (int g = 0; g < N; ++g)
+      f[g] = phi[c + g * number_cells];
+    P.transform(f, ft);
+    P.inverse(ft, f2);
+    for (int l = 0; l <= M; ++l)
+      TEST(soft_equiv(phit[l + c * (M + 1)], ft[l]));
+    for (int g = 0; g < N; ++g)
+      TEST(soft_equiv(phi2[c + g * number_cells], f2[g]));
+  }
+
+  // The dense base implementation gives the same batch.
+  OrthogonalBasis &B = P;
+  vec_dbl phit_dense((M + 1) * number_cells, 0.0);
+  B.OrthogonalBasis::transform(number_cells, &phi[0], number_cells, 1,
+                               &phit_dense[0], 1, M + 1);
+  for (int i = 0; i < (M + 1) * number_cells; ++i)
+    TEST(std::abs(phit_dense[i] - phit[i]) < 1e-10);
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+int test_DCT_threads(int argc, char *argv[])
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  // A basis built with one thread is used with more threads, both
+  // directly and from the threads of an enclosing parallel region.
+  int number_threads = omp_get_max_threads();
+  omp_set_num_threads(1);
+  int N = 12;
+  int M = 5;
+  int number_cells = 16;
+  DCT P(M, N);
+  vec_dbl phi(N * number_cells, 0.0);
+  for (int i = 0; i < N * number_cells; ++i)
+    phi[i] = 1.0 + std::cos(0.3 * i);
+  vec_dbl phit_ref((M + 1) * number_cells, 0.0);
+  P.transform(number_cells, &phi[0], 1, N, &phit_ref[0], 1, M + 1);
+
+  omp_set_num_threads(4);
+  vec_dbl phit((M + 1) * number_cells, 0.0);
+  P.transform(number_cells, &phi[0], 1, N, &phit[0], 1, M + 1);
+  for (int i = 0; i < (M + 1) * number_cells; ++i)
+    TEST(phit[i] == phit_ref[i]);
+
+  phit.assign((M + 1) * number_cells, 0.0);
+  vec_dbl phi2(N * number_cells, 0.0);
+  #pragma omp parallel for
+  for (int c = 0; c < number_cells; ++c)
+  {
+    P.transform(1, &phi[c * N], 1, N, &phit[c * (M + 1)], 1, M + 1);
+    P.inverse(1, &phit[c * (M + 1)], 1, M + 1, &phi2[c * N], 1, N);
+  }
+  for (int i = 0; i < (M + 1) * number_cells; ++i)
+    TEST(phit[i] == phit_ref[i]);
+  vec_dbl phi2_ref(N * number_cells, 0.0);
+  P.inverse(number_cells, &phit_ref[0], 1, M + 1, &phi2_ref[0], 1, N);
+  for (int i = 0; i < N * number_cells; ++i)
+    TEST(phi2[i] == phi2_ref[i]);
+  omp_set_num_threads(number_threads);
+#endif
   return 0;
 }
 
 
 //---------------------------------------------------------------------------//
-//              end of test_MomentIndexer.cc
+//              end of test_DCT.cc
 //---------------------------------------------------------------------------//
@@ -36,7 +36,7 @@ ReactionRates::region_power(std::string key, double scale)
       "The mesh map " + key + " does not exist.");
 
   // Compute the fission rate.
-  vec_int mat_map = b_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = b_mesh->material_map();
   detran::State::moments_type fission_rate(b_mesh->number_cells(), 0.0);
   for(size_t g = 0; g < b_material->number_groups(); g++)
   {
@@ -49,7 +49,7 @@ ReactionRates::region_power(std::string key, double scale)
   }
 
   // Get the region map of interest.
-  vec_int map = b_mesh->mesh_map(key);
+  const vec_int &map = b_mesh->mesh_map(key);
 
   // Get the maximum index, which we take to the be one less
   // then the number of unique regions.  If there is non-sequential
@@ -101,7 +101,7 @@ ReactionRates::edit(std::string key,
       "The mesh map " + key + " does not exist.");
 
   // Get the region map of interest.
-  vec_int map = b_mesh->mesh_map(key);
+  const vec_int &map = b_mesh->mesh_map(key);
 
   // Number of unique regions.  This *assumes* sequential numbering,
   int number = 1 + *std::max_element(map.begin(), map.end());
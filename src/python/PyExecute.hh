@@ -238,8 +238,11 @@ void PyExecute<D>::setup()
   //-------------------------------------------------------------------------//
   if (d_moc)
   {
-    // Track the mesh
-    detran_geometry::Tracker tracker(d_mesh, d_quadrature);
+    // Track the mesh, or read the tracks from a file.
+    std::string track_file = "";
+    if (d_input->check("moc_track_file"))
+      track_file = d_input->get<std::string>("moc_track_file");
+    detran_geometry::Tracker tracker(d_mesh, d_quadrature, track_file);
 
     // Normalize segments to conserve volume.
     tracker.normalize();
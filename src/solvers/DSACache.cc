@@ -0,0 +1,342 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   DSACache.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  DSACache member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#include "DSACache.hh"
+#include <algorithm>
+#include <cmath>
+#include <map>
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+// STORAGE
+//---------------------------------------------------------------------------//
+
+/// Identity of a cached operator
+struct dsa_cache_key
+{
+  const void *input;
+  const void *material;
+  const void *mesh;
+  DSACache::size_t first_group;
+  DSACache::size_t last_group;
+  bool include_fission;
+  bool operator<(const dsa_cache_key &k) const
+  {
+    if (input != k.input) return input < k.input;
+    if (material != k.material) return material < k.material;
+    if (mesh != k.mesh) return mesh < k.mesh;
+    if (first_group != k.first_group) return first_group < k.first_group;
+    if (last_group != k.last_group) return last_group < k.last_group;
+    return include_fission < k.include_fission;
+  }
+};
+
+/// Entries of a linear solver database
+struct dsa_cache_db
+{
+  std::map<std::string, int>                       ints;
+  std::map<std::string, double>                    dbls;
+  std::map<std::string, std::string>               strs;
+  std::map<std::string, detran_utilities::vec_int> vec_ints;
+  std::map<std::string, detran_utilities::vec_dbl> vec_dbls;
+  bool operator==(const dsa_cache_db &d) const
+  {
+    return ints == d.ints && dbls == d.dbls && strs == d.strs &&
+           vec_ints == d.vec_ints && vec_dbls == d.vec_dbls;
+  }
+};
+
+/// Cached operator, its solver, and the data from which it was built
+struct dsa_cache_entry
+{
+  DSACache::SP_input      input;
+  DSACache::SP_material   material;
+  DSACache::SP_mesh       mesh;
+  DSACache::SP_operator   op;
+  DSACache::SP_solver     solver;
+  detran_utilities::vec_dbl data;
+  detran_utilities::vec_int map;
+  dsa_cache_db            db;
+  DSACache::size_t        last_use;
+};
+
+typedef std::map<dsa_cache_key, dsa_cache_entry> dsa_cache_type;
+
+/// All cache state
+struct dsa_cache_storage
+{
+  dsa_cache_storage() : clock(0), hits(0), builds(0) {}
+  dsa_cache_type entries;
+  DSACache::size_t clock;
+  DSACache::size_t hits;
+  DSACache::size_t builds;
+};
+
+//---------------------------------------------------------------------------//
+static dsa_cache_storage& dsa_cache()
+{
+  static dsa_cache_storage storage;
+  return storage;
+}
+
+//---------------------------------------------------------------------------//
+static dsa_cache_key dsa_cache_make_key(DSACache::SP_input     input,
+                                        DSACache::SP_material  material,
+                                        DSACache::SP_mesh      mesh,
+                                        const DSACache::size_t first_group,
+                                        const DSACache::size_t last_group,
+                                        const bool             include_fission)
+{
+  dsa_cache_key key;
+  key.input           = input.bp();
+  key.material        = material.bp();
+  key.mesh            = mesh.bp();
+  key.first_group     = first_group;
+  key.last_group      = last_group;
+  key.include_fission = include_fission;
+  return key;
+}
+
+//---------------------------------------------------------------------------//
+static void dsa_cache_snapshot(DSACache::SP_material      material,
+                               const DSACache::size_t     first_group,
+                               const DSACache::size_t     last_group,
+                               const bool                 include_fission,
+                               detran_utilities::vec_dbl &data)
+{
+  data.clear();
+  for (DSACache::size_t m = 0; m < material->number_materials(); ++m)
+  {
+    for (DSACache::size_t g = first_group; g <= last_group; ++g)
+    {
+      data.push_back(material->diff_coef(m, g));
+      data.push_back(material->sigma_t(m, g));
+      for (DSACache::size_t gp = first_group; gp <= last_group; ++gp)
+        data.push_back(material->sigma_s(m, g, gp));
+      if (include_fission)
+      {
+        data.push_back(material->nu_sigma_f(m, g));
+        data.push_back(material->chi(m, g));
+      }
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+static void dsa_cache_snapshot_db(DSACache::SP_input db, dsa_cache_db &data)
+{
+  data = dsa_cache_db();
+  if (!db) return;
+  data.ints     = db->get_map<int>();
+  data.dbls     = db->get_map<double>();
+  data.strs     = db->get_map<std::string>();
+  data.vec_ints = db->get_map<detran_utilities::vec_int>();
+  data.vec_dbls = db->get_map<detran_utilities::vec_dbl>();
+}
+
+//---------------------------------------------------------------------------//
+static bool dsa_cache_find(DSACache::SP_input      input,
+                           DSACache::SP_material   material,
+                           DSACache::SP_mesh       mesh,
+                           const DSACache::size_t  first_group,
+                           const DSACache::size_t  last_group,
+                           const bool              include_fission,
+                           DSACache::SP_input      db,
+                           DSACache::SP_operator  &op,
+                           DSACache::SP_solver    &solver)
+{
+  typedef DSACache::size_t size_t;
+  dsa_cache_storage &cache = dsa_cache();
+  dsa_cache_type::iterator it = cache.entries.find(
+    dsa_cache_make_key(input, material, mesh,
+                       first_group, last_group, include_fission));
+  if (it == cache.entries.end()) return false;
+  dsa_cache_entry &entry = it->second;
+
+  // The solver database and material map must be unchanged.
+  dsa_cache_db db_data;
+  dsa_cache_snapshot_db(db, db_data);
+  if (!(db_data == entry.db)) return false;
+  if (mesh->material_map().values() != entry.map) return false;
+
+  // Every datum must be within the tolerance of its snapshot.
+  double tolerance = 0.01;
+  if (input->check("dsa_cache_tolerance"))
+    tolerance = input->get<double>("dsa_cache_tolerance");
+  detran_utilities::vec_dbl data;
+  dsa_cache_snapshot(material, first_group, last_group, include_fission, data);
+  Assert(data.size() == entry.data.size());
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    double scale = std::max(std::abs(data[i]), std::abs(entry.data[i]));
+    if (std::abs(data[i] - entry.data[i]) > tolerance * scale) return false;
+  }
+
+  op     = entry.op;
+  solver = entry.solver;
+  entry.last_use = ++cache.clock;
+  ++cache.hits;
+  return true;
+}
+
+//---------------------------------------------------------------------------//
+static void dsa_cache_insert(DSACache::SP_input     input,
+                             DSACache::SP_material  material,
+                             DSACache::SP_mesh      mesh,
+                             const DSACache::size_t first_group,
+                             const DSACache::size_t last_group,
+                             const bool             include_fission,
+                             DSACache::SP_input     db,
+                             DSACache::SP_operator  op,
+                             DSACache::SP_solver    solver)
+{
+  typedef DSACache::size_t size_t;
+  dsa_cache_storage &cache = dsa_cache();
+  dsa_cache_key key = dsa_cache_make_key(input, material, mesh,
+                                         first_group, last_group,
+                                         include_fission);
+
+  // Make room by dropping the least recently used entries.
+  size_t max_size = 256;
+  if (input->check("dsa_cache_size"))
+    max_size = input->get<int>("dsa_cache_size");
+  if (cache.entries.find(key) == cache.entries.end())
+  {
+    while (cache.entries.size() && cache.entries.size() >= max_size)
+    {
+      dsa_cache_type::iterator oldest = cache.entries.begin();
+      dsa_cache_type::iterator it = cache.entries.begin();
+      for (; it != cache.entries.end(); ++it)
+        if (it->second.last_use < oldest->second.last_use) oldest = it;
+      cache.entries.erase(oldest);
+    }
+  }
+  if (!max_size) return;
+
+  dsa_cache_entry &entry = cache.entries[key];
+  entry.input    = input;
+  entry.material = material;
+  entry.mesh     = mesh;
+  entry.op       = op;
+  entry.solver   = solver;
+  entry.map      = mesh->material_map().values();
+  entry.last_use = ++cache.clock;
+  dsa_cache_snapshot_db(db, entry.db);
+  dsa_cache_snapshot(material, first_group, last_group, include_fission,
+                     entry.data);
+  ++cache.builds;
+}
+
+//---------------------------------------------------------------------------//
+// PUBLIC FUNCTIONS
+//---------------------------------------------------------------------------//
+
+bool DSACache::find(SP_input     input,
+                    SP_material  material,
+                    SP_mesh      mesh,
+                    const size_t first_group,
+                    const size_t last_group,
+                    const bool   include_fission,
+                    SP_input     db,
+                    SP_operator &op,
+                    SP_solver   &solver)
+{
+  Require(input);
+  Require(material);
+  Require(mesh);
+  Require(first_group <= last_group);
+  Require(last_group < material->number_groups());
+
+  bool found;
+  #pragma omp critical(dsa_cache)
+  found = dsa_cache_find(input, material, mesh, first_group, last_group,
+                         include_fission, db, op, solver);
+  return found;
+}
+
+//---------------------------------------------------------------------------//
+void DSACache::insert(SP_input     input,
+                      SP_material  material,
+                      SP_mesh      mesh,
+                      const size_t first_group,
+                      const size_t last_group,
+                      const bool   include_fission,
+                      SP_input     db,
+                      SP_operator  op,
+                      SP_solver    solver)
+{
+  Require(input);
+  Require(material);
+  Require(mesh);
+  Require(op);
+  Require(solver);
+  Require(first_group <= last_group);
+  Require(last_group < material->number_groups());
+
+  #pragma omp critical(dsa_cache)
+  dsa_cache_insert(input, material, mesh, first_group, last_group,
+                   include_fission, db, op, solver);
+}
+
+//---------------------------------------------------------------------------//
+bool DSACache::enabled(SP_input input)
+{
+  Require(input);
+  if (input->check("dsa_cache"))
+    return input->get<int>("dsa_cache");
+  return false;
+}
+
+//---------------------------------------------------------------------------//
+void DSACache::clear()
+{
+  #pragma omp critical(dsa_cache)
+  {
+    dsa_cache_storage &cache = dsa_cache();
+    cache.entries.clear();
+    cache.clock  = 0;
+    cache.hits   = 0;
+    cache.builds = 0;
+  }
+}
+
+//---------------------------------------------------------------------------//
+DSACache::size_t DSACache::size()
+{
+  size_t value;
+  #pragma omp critical(dsa_cache)
+  value = dsa_cache().entries.size();
+  return value;
+}
+
+//---------------------------------------------------------------------------//
+DSACache::size_t DSACache::number_hits()
+{
+  size_t value;
+  #pragma omp critical(dsa_cache)
+  value = dsa_cache().hits;
+  return value;
+}
+
+//---------------------------------------------------------------------------//
+DSACache::size_t DSACache::number_builds()
+{
+  size_t value;
+  #pragma omp critical(dsa_cache)
+  value = dsa_cache().builds;
+  return value;
+}
+
+} // end namespace detran
+
+//---------------------------------------------------------------------------//
+//              end of file DSACache.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,140 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   DSACache.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  DSACache class definition.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_DSACACHE_HH_
+#define detran_DSACACHE_HH_
+
+#include "material/Material.hh"
+#include "geometry/Mesh.hh"
+#include "utilities/InputDB.hh"
+#include "callow/matrix/MatrixBase.hh"
+#include "callow/solver/LinearSolver.hh"
+
+namespace detran
+{
+
+/**
+ *  @class DSACache
+ *  @brief Keeps diffusion operators and their solvers across preconditioners
+ *
+ *  Each construction of a diffusion preconditioner (PC_DSA or MGDSA)
+ *  assembles the diffusion loss operator and sets up its linear solver,
+ *  which includes factoring the preconditioner of the diffusion solve
+ *  (e.g. ILU(0) or an AMG hierarchy).  Preconditioners are rebuilt
+ *  often for the same problem, e.g. for every solve of a sequence of
+ *  fixed source problems or every step of a transient, so this cache
+ *  keeps the operator and solver for each combination of input,
+ *  material, mesh, group range, and fission treatment.  The cache is
+ *  off unless the input sets dsa_cache to 1.
+ *
+ *  A cached entry also keeps a snapshot of the data its operator and
+ *  solver were built from: the entries of the linear solver database
+ *  (e.g. pc_type), the material map of the mesh, and, for each material
+ *  and group in the range, the diffusion coefficient, total cross
+ *  section, in-range scattering, and, if fission is included, the
+ *  fission cross section and spectrum.  The entry is reused while the
+ *  database and material map are unchanged and every cross section
+ *  differs from its snapshot by at most the relative tolerance.
+ *  Otherwise, the client rebuilds the operator and solver and inserts
+ *  them in place of the stale entry.  Because the diffusion solve only
+ *  preconditions the transport solve, a slightly stale operator costs a
+ *  few iterations but never the accuracy of the transport solution.
+ *
+ *  The cache holds references to the input, material, and mesh of each
+ *  entry so that their addresses cannot be reused by other objects.
+ *  These, and the cached operators and solvers, stay alive until the
+ *  entry is dropped, either because it is the least recently used of a
+ *  full cache or by clear().  Access to the cache is serialized, so
+ *  preconditioners may be built from several threads.
+ *
+ *  Relevant input database entries:
+ *    - dsa_cache (0)               -- reuse operators and solvers if 1
+ *    - dsa_cache_tolerance (0.01)  -- largest relative change in the
+ *                                     data for which entries are reused
+ *    - dsa_cache_size (256)        -- maximum number of entries
+ */
+
+class DSACache
+{
+
+public:
+
+  //-------------------------------------------------------------------------//
+  // TYPEDEFS
+  //-------------------------------------------------------------------------//
+
+  typedef detran_utilities::InputDB::SP_input       SP_input;
+  typedef detran_material::Material::SP_material    SP_material;
+  typedef detran_geometry::Mesh::SP_mesh            SP_mesh;
+  typedef callow::MatrixBase::SP_matrix             SP_operator;
+  typedef callow::LinearSolver::SP_solver           SP_solver;
+  typedef detran_utilities::size_t                  size_t;
+
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Find a current operator and solver
+   *  @param input            input database
+   *  @param material         material database
+   *  @param mesh             mesh
+   *  @param first_group      first group of the operator
+   *  @param last_group       last group of the operator
+   *  @param include_fission  whether the operator includes fission
+   *  @param db               linear solver database, which may be null
+   *  @param op               on success, the cached operator
+   *  @param solver           on success, the cached solver
+   *  @return true if a cached entry exists and is within the tolerance
+   */
+  static bool find(SP_input     input,
+                   SP_material  material,
+                   SP_mesh      mesh,
+                   const size_t first_group,
+                   const size_t last_group,
+                   const bool   include_fission,
+                   SP_input     db,
+                   SP_operator &op,
+                   SP_solver   &solver);
+
+  /// Insert an operator and solver, replacing any previous entry
+  static void insert(SP_input     input,
+                     SP_material  material,
+                     SP_mesh      mesh,
+                     const size_t first_group,
+                     const size_t last_group,
+                     const bool   include_fission,
+                     SP_input     db,
+                     SP_operator  op,
+                     SP_solver    solver);
+
+  /// Whether the cache is enabled by the input
+  static bool enabled(SP_input input);
+
+  /// Remove all entries
+  static void clear();
+
+  /// Number of entries
+  static size_t size();
+
+  /// Number of successful finds since the last clear
+  static size_t number_hits();
+
+  /// Number of insertions since the last clear
+  static size_t number_builds();
+
+};
+
+} // end namespace detran
+
+#endif /* detran_DSACACHE_HH_ */
+
+//---------------------------------------------------------------------------//
+//              end of file DSACache.hh
+//---------------------------------------------------------------------------//
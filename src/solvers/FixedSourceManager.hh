@@ -29,6 +29,11 @@ namespace detran
  *  scatter, or it can be added via iteration outside the normal
  *  multigroup solver.  The latter is useful when we want to
  *  expand solutions in fission generation series.
+ *
+ *  Relevant input database entries:
+ *    - moc_track_file [string], binary file from which MOC tracks are
+ *      read if it matches the mesh and quadrature, and to which they
+ *      are written otherwise (none by default)
  */
 template <class D>
 class FixedSourceManager: TransportManager
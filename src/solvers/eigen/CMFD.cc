@@ -0,0 +1,267 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   CMFD.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  CMFD member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#include "CMFD.hh"
+#include "MGTransportSolver.hh"
+#include "transport/Homogenize.hh"
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+template <class D>
+CMFD<D>::CMFD(SP_mg_solver mg_solver)
+  : d_number_iterations(0)
+{
+  Require(mg_solver);
+  d_input    = mg_solver->input();
+  d_state    = mg_solver->state();
+  d_mesh     = mg_solver->mesh();
+  d_material = mg_solver->material();
+  d_number_groups = d_material->number_groups();
+
+  // Only the SN sweepers tally currents.
+  Insist(mg_solver->discretization() == Fixed_T::SN,
+         "CMFD requires an SN discretization");
+  MGTransportSolver<D>* mg =
+    dynamic_cast<MGTransportSolver<D>*>(mg_solver->solver().bp());
+  Insist(mg, "CMFD requires a multigroup transport solver");
+
+  // Krylov solvers keep the currents of their final source only when
+  // they sweep it to pick up the boundary fluxes.
+  std::string inner_solver = "SI";
+  if (d_input->check("inner_solver"))
+    inner_solver = d_input->template get<std::string>("inner_solver");
+  std::string outer_solver = "GS";
+  if (d_input->check("outer_solver"))
+    outer_solver = d_input->template get<std::string>("outer_solver");
+  bool boundary_flux = false;
+  if (d_input->check("compute_boundary_flux"))
+    boundary_flux = d_input->template get<int>("compute_boundary_flux");
+  Insist((inner_solver == "SI" && outer_solver == "GS") || boundary_flux,
+         "CMFD with Krylov solvers requires compute_boundary_flux");
+
+  // Coarse mesh and the tally of its currents
+  int level = 2;
+  if (d_input->check("eigen_cmfd_level"))
+    level = d_input->template get<int>("eigen_cmfd_level");
+  Insist(level >= 1, "eigen_cmfd_level must be positive");
+  d_coarsemesh = new CoarseMesh(d_mesh, level);
+  d_tally = new Tally_T(d_coarsemesh, d_state->get_quadrature(),
+                        d_number_groups);
+  mg->wg_solver()->get_sweeper()->set_tally(d_tally);
+  d_phi.resize(d_number_groups,
+               vec_dbl(d_coarsemesh->get_coarse_mesh()->number_cells(), 0.0));
+
+  // The coarse problem is converged well below the outer tolerance.
+  double tolerance = 1e-6;
+  if (d_input->check("eigen_tolerance"))
+    tolerance = d_input->template get<double>("eigen_tolerance");
+  if (d_input->check("eigen_cmfd_db"))
+    d_db = d_input->template get<SP_input>("eigen_cmfd_db");
+  else
+    d_db = new detran_utilities::InputDB("eigen_cmfd_db");
+  if (!d_db->check("eigen_solver_tol"))
+    d_db->template put<double>("eigen_solver_tol", 0.01 * tolerance);
+  if (!d_db->check("eigen_solver_maxit"))
+    d_db->template put<int>("eigen_solver_maxit", 10000);
+  if (!d_db->check("linear_solver_atol"))
+    d_db->template put<double>("linear_solver_atol", 1e-4 * tolerance);
+  if (!d_db->check("linear_solver_rtol"))
+    d_db->template put<double>("linear_solver_rtol", 1e-4 * tolerance);
+  if (!d_db->check("linear_solver_monitor_level"))
+    d_db->template put<int>("linear_solver_monitor_level", 0);
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+double CMFD<D>::update()
+{
+  SP_mesh cmesh = d_coarsemesh->get_coarse_mesh();
+  const size_t nc = cmesh->number_cells();
+  const size_t n  = nc * d_number_groups;
+  const detran_utilities::vec_int &map = d_mesh->mesh_map("COARSEMESH");
+
+  // Coarse cross sections and fluxes of the transport solution
+  Homogenize homogenize(d_material);
+  SP_material cmat = homogenize.homogenize(d_state, d_mesh, "COARSEMESH",
+                                           Homogenize::PHI_SIGMA_TR,
+                                           Homogenize::FISSION_CHI);
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    const State::moments_type &phi = d_state->phi(g);
+    d_phi[g].assign(nc, 0.0);
+    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
+      d_phi[g][map[cell]] += phi[cell] * d_mesh->volume(cell);
+    for (size_t c = 0; c < nc; ++c)
+    {
+      d_phi[g][c] /= cmesh->volume(c);
+      Insist(d_phi[g][c] > 0.0, "CMFD needs a positive coarse flux.");
+    }
+  }
+
+  // Coarse loss and gain operators
+  SP_matrix M(new callow::Matrix(n, n));
+  SP_matrix F(new callow::Matrix(n, n));
+  build(cmat, M, F);
+
+  // Solve the coarse eigenproblem starting from the transport solution.
+  callow::Vector x(n, 0.0);
+  callow::Vector x0(n, 0.0);
+  for (size_t g = 0; g < d_number_groups; ++g)
+    for (size_t c = 0; c < nc; ++c)
+      x0[c + g * nc] = d_phi[g][c];
+  SP_eigensolver solver = callow::EigenSolverCreator::Create(d_db);
+  solver->set_operators(F, M, d_db);
+  solver->solve(x, x0);
+  d_number_iterations = solver->number_iterations() + 1;
+
+  // The coarse solution is scaled to the fission rate of the transport
+  // solution, and the fine flux of each coarse cell takes its shape.
+  // The scale has the sign of the coarse eigenvector, so either sign
+  // yields a positive flux.
+  double rate_old = 0.0;
+  double rate_new = 0.0;
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    for (size_t c = 0; c < nc; ++c)
+    {
+      double nu_sigma_f = cmat->nu_sigma_f(c, g) * cmesh->volume(c);
+      rate_old += nu_sigma_f * d_phi[g][c];
+      rate_new += nu_sigma_f * x[c + g * nc];
+    }
+  }
+  Insist(rate_new != 0.0, "The coarse CMFD solution has no fission.");
+  const double scale = rate_old / rate_new;
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    State::moments_type &phi = d_state->phi(g);
+    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
+    {
+      const size_t c = map[cell];
+      phi[cell] *= scale * x[c + g * nc] / d_phi[g][c];
+    }
+  }
+
+  return solver->eigenvalue();
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void CMFD<D>::build(SP_material cmat, SP_matrix M, SP_matrix F)
+{
+  SP_mesh cmesh = d_coarsemesh->get_coarse_mesh();
+  const int nc  = cmesh->number_cells();
+  const int ng  = d_number_groups;
+  const int dim = D::dimension;
+
+  // Diagonal, neighbors, and in-scatter for the loss operator, and
+  // fission from all groups for the gain operator
+  M->preallocate(1 + 2 * dim + ng);
+  F->preallocate(ng);
+
+  bool flag;
+  for (int g = 0; g < ng; ++g)
+  {
+    for (int c = 0; c < nc; ++c)
+    {
+      const int row = c + g * nc;
+      const double volume = cmesh->volume(c);
+      const double phi_c  = d_phi[g][c];
+      const size_t ijk[3] = {cmesh->cell_to_i(c),
+                             cmesh->cell_to_j(c),
+                             cmesh->cell_to_k(c)};
+
+      // Removal
+      double diagonal = (cmat->sigma_t(c, g) - cmat->sigma_s(c, g, g)) *
+                        volume;
+
+      // Leakage through each face, where the net current J in the
+      // positive direction is taken from the tally.
+      for (int d = 0; d < dim; ++d)
+      {
+        double area = 1.0;
+        for (int dd = 0; dd < dim; ++dd)
+          if (dd != d) area *= cmesh->width(dd, ijk[dd]);
+
+        for (int s = 0; s < 2; ++s)
+        {
+          size_t edge[3] = {ijk[0], ijk[1], ijk[2]};
+          edge[d] += s;
+          double J =
+            d_tally->partial_current(edge[0], edge[1], edge[2], g, d,
+                                     Tally_T::POSITIVE) -
+            d_tally->partial_current(edge[0], edge[1], edge[2], g, d,
+                                     Tally_T::NEGATIVE);
+
+          // On the boundary, the outgoing current is dhat * phi.
+          if ((s == 0 && ijk[d] == 0) ||
+              (s == 1 && ijk[d] == cmesh->number_cells(d) - 1))
+          {
+            diagonal += (s ? J : -J) / phi_c;
+            continue;
+          }
+
+          // Otherwise, J = -dtilde (phi_u - phi_l) - dhat (phi_u + phi_l)
+          // for the lower and upper cells of the face.
+          size_t ijk_n[3] = {ijk[0], ijk[1], ijk[2]};
+          ijk_n[d] = s ? ijk[d] + 1 : ijk[d] - 1;
+          const int n = cmesh->index(ijk_n[0], ijk_n[1], ijk_n[2]);
+          const double phi_n = d_phi[g][n];
+          const double D_c = cmat->diff_coef(c, g);
+          const double D_n = cmat->diff_coef(n, g);
+          const double dtilde = area * 2.0 * D_c * D_n /
+            (D_c * cmesh->width(d, ijk_n[d]) + D_n * cmesh->width(d, ijk[d]));
+          const double phi_l = s ? phi_c : phi_n;
+          const double phi_u = s ? phi_n : phi_c;
+          const double dhat = -(J + dtilde * (phi_u - phi_l)) / (phi_u + phi_l);
+
+          // The outgoing current is +J through the upper face and -J
+          // through the lower one.
+          const double sign = s ? -1.0 : 1.0;
+          diagonal += dtilde + sign * dhat;
+          flag = M->insert(row, n + g * nc, -dtilde + sign * dhat);
+          Assert(flag);
+        }
+      }
+      flag = M->insert(row, row, diagonal);
+      Assert(flag);
+
+      // In-scatter and fission
+      for (int gp = 0; gp < ng; ++gp)
+      {
+        const int col = c + gp * nc;
+        if (gp != g)
+        {
+          flag = M->insert(row, col, -cmat->sigma_s(c, g, gp) * volume);
+          Assert(flag);
+        }
+        flag = F->insert(row, col, cmat->chi(c, g) *
+                                   cmat->nu_sigma_f(c, gp) * volume);
+        Assert(flag);
+      }
+    }
+  }
+  M->assemble();
+  F->assemble();
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATIONS
+//---------------------------------------------------------------------------//
+
+template class CMFD<_1D>;
+template class CMFD<_2D>;
+template class CMFD<_3D>;
+
+} // end namespace detran
+
+//---------------------------------------------------------------------------//
+//              end of file CMFD.cc
+//---------------------------------------------------------------------------//
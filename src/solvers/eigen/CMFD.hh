@@ -0,0 +1,174 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   CMFD.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  CMFD class definition.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_CMFD_HH_
+#define detran_CMFD_HH_
+
+#include "solvers/FixedSourceManager.hh"
+#include "transport/CoarseMesh.hh"
+#include "transport/CurrentTally.hh"
+#include "callow/matrix/Matrix.hh"
+#include "callow/solver/EigenSolverCreator.hh"
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class CMFD
+ *  @brief Coarse mesh finite difference acceleration of outer iterations
+ *
+ *  After each multigroup transport solve, the flux is homogenized on a
+ *  coarse mesh, and the net currents through coarse cell faces are taken
+ *  from a CurrentTally kept by the sweeper.  For the face between coarse
+ *  cells @f$ L @f$ and @f$ R @f$, the current is written as
+ *  @f[
+ *      J = -\tilde{D} (\Phi_R - \Phi_L) - \hat{D} (\Phi_R + \Phi_L) \, ,
+ *  @f]
+ *  where @f$ \tilde{D} @f$ is the usual finite difference coupling and
+ *  the nonlinear correction @f$ \hat{D} @f$ is chosen so that the
+ *  transport current is reproduced.  On the boundary, the outgoing
+ *  current is @f$ \hat{D} \Phi @f$ alone.  The coarse multigroup
+ *  eigenproblem
+ *  @f[
+ *      \mathbf{M} \Phi = \frac{1}{k} \mathbf{F} \Phi
+ *  @f]
+ *  then preserves the transport balance of each coarse cell.  It is
+ *  solved by a callow eigensolver, and the fine flux of each coarse
+ *  cell and group is scaled by the ratio of the new and old coarse
+ *  fluxes.  At convergence, the coarse and transport solutions agree,
+ *  but far fewer outers are needed, since the slowly converging
+ *  global modes are resolved by the coarse problem.
+ *
+ *  The currents are those of the last sweep of each group, which, for
+ *  source iteration, produced the group flux.  Krylov solvers must set
+ *  compute_boundary_flux, with which each group ends by sweeps of the
+ *  final source.  Only SN sweeps tally currents.
+ *
+ *  Like any unrelaxed CMFD, the iteration becomes unstable for coarse
+ *  cells several mean free paths thick, in which case a lower level
+ *  should be used.
+ *
+ *  Relevant input database entries:
+ *    - eigen_cmfd_level (int) -- fine cells per coarse cell along each
+ *                                axis (default 2)
+ *    - eigen_cmfd_db (InputDB) -- parameters of the callow eigensolver
+ *                                 and its linear solver, with defaults
+ *                                 set from eigen_tolerance
+ */
+//---------------------------------------------------------------------------//
+
+template <class D>
+class CMFD
+{
+
+public:
+
+  //-------------------------------------------------------------------------//
+  // TYPEDEFS
+  //-------------------------------------------------------------------------//
+
+  typedef detran_utilities::SP<CMFD>                SP_cmfd;
+  typedef FixedSourceManager<D>                     Fixed_T;
+  typedef typename Fixed_T::SP_manager              SP_mg_solver;
+  typedef detran_utilities::InputDB::SP_input       SP_input;
+  typedef State::SP_state                           SP_state;
+  typedef detran_geometry::Mesh::SP_mesh            SP_mesh;
+  typedef detran_material::Material::SP_material    SP_material;
+  typedef CoarseMesh::SP_coarsemesh                 SP_coarsemesh;
+  typedef CurrentTally<D>                           Tally_T;
+  typedef typename Tally_T::SP_currenttally         SP_tally;
+  typedef callow::Matrix::SP_matrix                 SP_matrix;
+  typedef callow::Vector::SP_vector                 SP_vector;
+  typedef callow::EigenSolverCreator::SP_solver     SP_eigensolver;
+  typedef detran_utilities::vec_dbl                 vec_dbl;
+  typedef detran_utilities::vec2_dbl                vec2_dbl;
+  typedef detran_utilities::size_t                  size_t;
+
+  //-------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *
+   *  The coarse mesh is built and a current tally is set on the
+   *  sweeper of the multigroup solver.
+   *
+   *  @param mg_solver         Multigroup solver
+   */
+  CMFD(SP_mg_solver mg_solver);
+
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Update the flux with the coarse mesh solution
+   *
+   *  The state flux must be that of the last multigroup solve.  On
+   *  return, it has the shape of the coarse solution, keeping the
+   *  fission rate.
+   *
+   *  @return           Eigenvalue of the coarse problem
+   */
+  double update();
+
+  /// Coarse mesh
+  SP_coarsemesh coarsemesh() const { return d_coarsemesh; }
+
+  /// Current tally
+  SP_tally tally() const { return d_tally; }
+
+  /// Number of coarse eigensolver iterations of the last update
+  int number_iterations() const { return d_number_iterations; }
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // DATA
+  //-------------------------------------------------------------------------//
+
+  /// Input
+  SP_input d_input;
+  /// State
+  SP_state d_state;
+  /// Fine mesh
+  SP_mesh d_mesh;
+  /// Fine material
+  SP_material d_material;
+  /// Coarse mesh
+  SP_coarsemesh d_coarsemesh;
+  /// Current tally
+  SP_tally d_tally;
+  /// Parameters of the coarse eigensolver
+  SP_input d_db;
+  /// Number of groups
+  size_t d_number_groups;
+  /// Coarse flux [group][coarse cell] of the transport solution
+  vec2_dbl d_phi;
+  /// Coarse eigensolver iterations of the last update
+  int d_number_iterations;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Build the coarse loss and gain operators
+  void build(SP_material cmat, SP_matrix M, SP_matrix F);
+
+};
+
+} // end namespace detran
+
+#endif // detran_CMFD_HH_
+
+//---------------------------------------------------------------------------//
+//              end of file CMFD.hh
+//---------------------------------------------------------------------------//
@@ -8,6 +8,8 @@
 //---------------------------------------------------------------------------//
 
 #include "EigenPI.hh"
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 
 namespace detran
@@ -19,6 +21,22 @@ EigenPI<D>::EigenPI(SP_mg_solver mg_solver)
   : Base(mg_solver)
   , d_aitken(false)
   , d_omega(1.0)
+  , d_acceleration(NONE)
+  , d_number_iterations(0)
+  , d_chebyshev_free(5)
+  , d_chebyshev_degree(8)
+  , d_chebyshev_step(0)
+  , d_chebyshev_count(0)
+  , d_chebyshev_sigma_input(0.0)
+  , d_chebyshev_sigma(0.0)
+  , d_chebyshev_omega(1.0)
+  , d_chebyshev_error(0.0)
+  , d_chebyshev_error_0(0.0)
+  , d_anderson_depth(3)
+  , d_anderson_beta(1.0)
+  , d_anderson_started(false)
+  , d_anderson_count(0)
+  , d_anderson_next(0)
 {
 
   if (d_input->check("eigen_pi_aitken"))
@@ -27,6 +45,298 @@ EigenPI<D>::EigenPI(SP_mg_solver mg_solver)
   if (d_input->check("eigen_pi_omega"))
     d_omega = d_input->template get<double>("eigen_pi_omega");
 
+  std::string acceleration = "none";
+  if (d_input->check("eigen_pi_acceleration"))
+    acceleration = d_input->template get<std::string>("eigen_pi_acceleration");
+  if (acceleration == "chebyshev")
+    d_acceleration = CHEBYSHEV;
+  else if (acceleration == "anderson")
+    d_acceleration = ANDERSON;
+  else if (acceleration == "cmfd")
+    d_acceleration = COARSE_MESH;
+  else if (acceleration != "none")
+    THROW("Unsupported eigen_pi_acceleration: " + acceleration);
+
+  if (d_input->check("eigen_pi_chebyshev_free"))
+    d_chebyshev_free = d_input->template get<int>("eigen_pi_chebyshev_free");
+  if (d_input->check("eigen_pi_chebyshev_degree"))
+    d_chebyshev_degree = d_input->template get<int>("eigen_pi_chebyshev_degree");
+  if (d_input->check("eigen_pi_chebyshev_sigma"))
+    d_chebyshev_sigma_input =
+      d_input->template get<double>("eigen_pi_chebyshev_sigma");
+  Insist(d_chebyshev_free >= 2,
+         "eigen_pi_chebyshev_free must be at least 2");
+  Insist(d_chebyshev_degree >= 1,
+         "eigen_pi_chebyshev_degree must be positive");
+  Insist(d_chebyshev_sigma_input >= 0.0 && d_chebyshev_sigma_input < 1.0,
+         "eigen_pi_chebyshev_sigma must be in [0, 1)");
+
+  if (d_input->check("eigen_pi_anderson_depth"))
+    d_anderson_depth = d_input->template get<int>("eigen_pi_anderson_depth");
+  if (d_input->check("eigen_pi_anderson_beta"))
+    d_anderson_beta = d_input->template get<double>("eigen_pi_anderson_beta");
+  Insist(d_anderson_depth >= 1, "eigen_pi_anderson_depth must be positive");
+  Insist(d_anderson_beta > 0.0, "eigen_pi_anderson_beta must be positive");
+
+  // Workspace for the selected scheme
+  const size_t n = d_mesh->number_cells();
+  if (d_acceleration == CHEBYSHEV)
+  {
+    d_chebyshev_density.resize(n, 0.0);
+  }
+  else if (d_acceleration == ANDERSON)
+  {
+    d_anderson_dr.resize(d_anderson_depth, moments_type(n, 0.0));
+    d_anderson_dg.resize(d_anderson_depth, moments_type(n, 0.0));
+    d_anderson_r.resize(n, 0.0);
+    d_anderson_g.resize(n, 0.0);
+    d_anderson_A.resize(d_anderson_depth * d_anderson_depth, 0.0);
+    d_anderson_b.resize(d_anderson_depth, 0.0);
+  }
+  else if (d_acceleration == COARSE_MESH)
+  {
+    d_cmfd = new CMFD<D>(mg_solver);
+  }
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void EigenPI<D>::reset_acceleration()
+{
+  d_chebyshev_step    = 0;
+  d_chebyshev_count   = 0;
+  d_chebyshev_sigma   = 0.0;
+  d_chebyshev_error   = 0.0;
+  d_chebyshev_error_0 = 0.0;
+  d_anderson_started  = false;
+  d_anderson_count    = 0;
+  d_anderson_next     = 0;
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+typename EigenPI<D>::outer_timing EigenPI<D>::total_timing() const
+{
+  outer_timing total;
+  for (size_t i = 0; i < d_timing.size(); ++i)
+  {
+    total.mg_solve         += d_timing[i].mg_solve;
+    total.fission          += d_timing[i].fission;
+    total.norms            += d_timing[i].norms;
+    total.acceleration     += d_timing[i].acceleration;
+    total.number_mg_solves += d_timing[i].number_mg_solves;
+  }
+  return total;
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void EigenPI<D>::chebyshev(moments_type &fd_old,
+                           moments_type &fd,
+                           const double  error,
+                           const double  norm_old)
+{
+  // Largest dominance ratio used, to keep the coefficients bounded
+  const double sigma_max = 0.9999;
+
+  // Free iterations, after which the dominance ratio is estimated
+  // from the last two residuals.
+  if (d_chebyshev_step == 0)
+  {
+    ++d_chebyshev_count;
+    if (d_chebyshev_count >= d_chebyshev_free && d_chebyshev_error > 0.0)
+    {
+      double sigma = error / d_chebyshev_error;
+      if (d_chebyshev_sigma_input > 0.0) sigma = d_chebyshev_sigma_input;
+      if (sigma < 1.0)
+      {
+        d_chebyshev_sigma   = std::min(std::max(sigma, d_chebyshev_sigma),
+                                       sigma_max);
+        d_chebyshev_step    = 1;
+        d_chebyshev_error_0 = error;
+      }
+    }
+    d_chebyshev_error = error;
+    if (d_chebyshev_step == 0) return;
+  }
+
+  // At the end of a cycle, compare the residual reduction to that of
+  // the Chebyshev polynomial, 1/T_p(1/mu), and raise the estimate if
+  // the reduction was smaller.  If the residual grew, start over.
+  else if (d_chebyshev_step > d_chebyshev_degree)
+  {
+    double ratio = error / d_chebyshev_error_0;
+    if (ratio >= 1.0)
+    {
+      d_chebyshev_step  = 0;
+      d_chebyshev_count = 0;
+      d_chebyshev_error = error;
+      return;
+    }
+    double mu_p  = 1.0 / std::cosh(std::acosh(1.0 / ratio) /
+                                   d_chebyshev_degree);
+    double sigma = 2.0 * mu_p / (1.0 + mu_p);
+    d_chebyshev_sigma   = std::min(std::max(sigma, d_chebyshev_sigma),
+                                   sigma_max);
+    d_chebyshev_step    = 1;
+    d_chebyshev_error_0 = error;
+  }
+
+  // The power iteration's spectrum [0, sigma] is mapped by the shift
+  // gamma to [-mu, mu], on which the Chebyshev recurrence is applied.
+  const double sigma = d_chebyshev_sigma;
+  const double gamma = 2.0 / (2.0 - sigma);
+  const double mu    = sigma / (2.0 - sigma);
+  double omega = 1.0;
+  if (d_chebyshev_step == 2)
+    omega = 1.0 / (1.0 - 0.5 * mu * mu);
+  else if (d_chebyshev_step > 2)
+    omega = 1.0 / (1.0 - 0.25 * mu * mu * d_chebyshev_omega);
+  const double alpha = omega * gamma;
+  const double beta  = omega - 1.0;
+
+  const int n = fd.size();
+  double norm_fd = 0.0;
+  for (int i = 0; i < n; ++i)
+  {
+    double d = fd_old[i] + alpha * (fd[i] - fd_old[i]) +
+               beta * (fd_old[i] - d_chebyshev_density[i]);
+    fd[i] = d;
+    norm_fd += std::abs(d);
+  }
+  const double scale = norm_old / norm_fd;
+  for (int i = 0; i < n; ++i)
+    fd[i] *= scale;
+
+  // The current density becomes the one from two iterations ago.
+  d_chebyshev_density.swap(fd_old);
+  d_chebyshev_omega = omega;
+  ++d_chebyshev_step;
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void EigenPI<D>::anderson(const moments_type &fd_old,
+                          moments_type       &fd,
+                          const double        norm_old)
+{
+  const int n = fd.size();
+  const int m = d_anderson_depth;
+
+  // Store the differences with the previous iterate along with the
+  // residual and map of this one.
+  if (d_anderson_started)
+  {
+    moments_type &dr = d_anderson_dr[d_anderson_next];
+    moments_type &dg = d_anderson_dg[d_anderson_next];
+    for (int i = 0; i < n; ++i)
+    {
+      double r = fd[i] - fd_old[i];
+      dr[i] = r - d_anderson_r[i];
+      dg[i] = fd[i] - d_anderson_g[i];
+      d_anderson_r[i] = r;
+      d_anderson_g[i] = fd[i];
+    }
+    d_anderson_next  = (d_anderson_next + 1) % m;
+    d_anderson_count = std::min(d_anderson_count + 1, m);
+  }
+  else
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      d_anderson_r[i] = fd[i] - fd_old[i];
+      d_anderson_g[i] = fd[i];
+    }
+  }
+  d_anderson_started = true;
+  const int k = d_anderson_count;
+
+  // Least squares fit of the residual by its differences through the
+  // normal equations, which are small.
+  double trace = 0.0;
+  for (int p = 0; p < k; ++p)
+  {
+    for (int q = 0; q <= p; ++q)
+    {
+      double v = 0.0;
+      for (int i = 0; i < n; ++i)
+        v += d_anderson_dr[p][i] * d_anderson_dr[q][i];
+      d_anderson_A[p + q * m] = d_anderson_A[q + p * m] = v;
+    }
+    double v = 0.0;
+    for (int i = 0; i < n; ++i)
+      v += d_anderson_dr[p][i] * d_anderson_r[i];
+    d_anderson_b[p] = v;
+    trace += d_anderson_A[p + p * m];
+  }
+  for (int p = 0; p < k; ++p)
+    d_anderson_A[p + p * m] += 1.0e-12 * trace;
+
+  // Gaussian elimination with partial pivoting
+  bool singular = false;
+  for (int c = 0; c < k && !singular; ++c)
+  {
+    int pivot = c;
+    for (int r = c + 1; r < k; ++r)
+    {
+      if (std::abs(d_anderson_A[r + c * m]) >
+          std::abs(d_anderson_A[pivot + c * m]))
+      {
+        pivot = r;
+      }
+    }
+    if (d_anderson_A[pivot + c * m] == 0.0)
+    {
+      singular = true;
+      break;
+    }
+    if (pivot != c)
+    {
+      for (int q = 0; q < k; ++q)
+        std::swap(d_anderson_A[c + q * m], d_anderson_A[pivot + q * m]);
+      std::swap(d_anderson_b[c], d_anderson_b[pivot]);
+    }
+    for (int r = c + 1; r < k; ++r)
+    {
+      double f = d_anderson_A[r + c * m] / d_anderson_A[c + c * m];
+      for (int q = c; q < k; ++q)
+        d_anderson_A[r + q * m] -= f * d_anderson_A[c + q * m];
+      d_anderson_b[r] -= f * d_anderson_b[c];
+    }
+  }
+  if (singular)
+  {
+    // Drop the history and take a plain step.
+    d_anderson_count = 0;
+    d_anderson_next  = 0;
+  }
+  for (int c = k - 1; c >= 0 && !singular; --c)
+  {
+    double v = d_anderson_b[c];
+    for (int q = c + 1; q < k; ++q)
+      v -= d_anderson_A[c + q * m] * d_anderson_b[q];
+    d_anderson_b[c] = v / d_anderson_A[c + c * m];
+  }
+
+  // Mixed iterate, x + beta r - sum_j gamma_j (dx_j + beta dr_j), where
+  // dx_j = dg_j - dr_j.
+  const double beta = d_anderson_beta;
+  const int k_used = singular ? 0 : k;
+  double norm_fd = 0.0;
+  for (int i = 0; i < n; ++i)
+  {
+    double d = fd_old[i] + beta * d_anderson_r[i];
+    for (int j = 0; j < k_used; ++j)
+    {
+      d -= d_anderson_b[j] * (d_anderson_dg[j][i] +
+                              (beta - 1.0) * d_anderson_dr[j][i]);
+    }
+    fd[i] = d;
+    norm_fd += std::abs(d);
+  }
+  const double scale = norm_old / norm_fd;
+  for (int i = 0; i < n; ++i)
+    fd[i] *= scale;
 }
 
 //---------------------------------------------------------------------------//
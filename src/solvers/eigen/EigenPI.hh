@@ -11,6 +11,7 @@
 #define detran_EIGENPI_HH_
 
 #include "Eigensolver.hh"
+#include "CMFD.hh"
 
 namespace detran
 {
@@ -46,6 +47,52 @@ namespace detran
  *  Note, this is a hand-coded power iteration implementation that
  *  can be used with nonlinear acceleration.
  *
+ *  @section piacceleration Outer Acceleration
+ *
+ *  For dominance ratios near one, plain power iteration needs hundreds
+ *  of outers.  Three accelerations of the outer iteration are offered.
+ *  Chebyshev and Anderson operate on the fission density alone, with
+ *  each power iterate rescaled to the norm of the density it came from.
+ *
+ *  \e Chebyshev extrapolation follows a number of free power
+ *  iterations, from which the dominance ratio @f$ \sigma @f$ is
+ *  estimated as the ratio of successive residual norms.  Cycles of
+ *  a fixed degree then apply
+ *  @f[
+ *      d^{p} = d^{p-1} + \alpha_p (\mathbf{A} d^{p-1}/k - d^{p-1})
+ *            + \beta_p (d^{p-1} - d^{p-2}) \, ,
+ *  @f]
+ *  with the coefficients of the Chebyshev polynomials on
+ *  @f$ [0, \sigma] @f$.  At the end of each cycle, the observed
+ *  residual reduction is compared to that predicted, and @f$ \sigma @f$
+ *  is raised if it was underestimated.  A growing residual falls back
+ *  to free iterations and a new estimate.
+ *
+ *  \e Anderson mixing treats the power iteration as a fixed point
+ *  map @f$ G @f$ of the density and sets the next density to the
+ *  combination of the last few iterates whose residuals
+ *  @f$ G(d) - d @f$ have the least L2 norm.
+ *
+ *  \e CMFD solves, after each multigroup solve, a coarse mesh
+ *  diffusion eigenproblem whose currents are corrected to match those
+ *  of the transport sweep.  Its eigenvalue replaces the power estimate,
+ *  and the fine flux, and hence the density, take the shape of its
+ *  solution.  See \ref CMFD for details.
+ *
+ *  Relevant input database entries:
+ *    - eigen_pi_acceleration (str) -- none (default), chebyshev,
+ *                                     anderson, or cmfd
+ *    - eigen_pi_omega (dbl) -- over-relaxation of the unaccelerated
+ *                              iteration (default 1)
+ *    - eigen_pi_aitken (int) -- display Aitken extrapolated keff
+ *    - eigen_pi_chebyshev_free (int) -- free iterations before the
+ *                                       first cycle (default 5)
+ *    - eigen_pi_chebyshev_degree (int) -- cycle length (default 8)
+ *    - eigen_pi_chebyshev_sigma (dbl) -- initial dominance ratio
+ *                                        (default: estimated)
+ *    - eigen_pi_anderson_depth (int) -- iterates mixed (default 3)
+ *    - eigen_pi_anderson_beta (dbl) -- mixing parameter (default 1)
+ *    - eigen_cmfd_level, eigen_cmfd_db -- see \ref CMFD
  */
 //---------------------------------------------------------------------------//
 
@@ -68,6 +115,36 @@ public:
   typedef typename Base::SP_material                SP_material;
   typedef typename Base::SP_boundary                SP_boundary;
   typedef typename Base::SP_fissionsource           SP_fissionsource;
+  typedef State::moments_type                       moments_type;
+  typedef State::vec_moments_type                   vec_moments_type;
+  typedef detran_utilities::vec_dbl                 vec_dbl;
+  typedef typename CMFD<D>::SP_cmfd                 SP_cmfd;
+
+  /// Time and work of one outer iteration, in seconds of wall time
+  struct outer_timing
+  {
+    outer_timing()
+      : mg_solve(0.0), fission(0.0), norms(0.0), acceleration(0.0)
+      , number_mg_solves(0)
+    {}
+    /// Multigroup solves
+    double mg_solve;
+    /// Setup of the fission sources and update of the density
+    double fission;
+    /// Fused relaxation, norm, and residual evaluation
+    double norms;
+    /// Chebyshev or Anderson extrapolation, or the CMFD update
+    double acceleration;
+    /// Number of multigroup solves
+    int number_mg_solves;
+  };
+  typedef std::vector<outer_timing>                 vec_timing;
+
+  /// Outer iteration acceleration schemes
+  enum acceleration_types
+  {
+    NONE, CHEBYSHEV, ANDERSON, COARSE_MESH, END_ACCELERATION_TYPES
+  };
 
   //-------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -86,6 +163,25 @@ public:
   /// Solve the eigenvalue problem.
   void solve();
 
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /// Number of outer iterations of the last solve
+  int number_iterations() const { return d_number_iterations; }
+
+  /// Current dominance ratio estimate of Chebyshev acceleration
+  double dominance_ratio() const { return d_chebyshev_sigma; }
+
+  /// Time and work of each outer iteration of the last solve
+  const vec_timing& timing() const { return d_timing; }
+
+  /// Sum of the time and work over the outer iterations of the last solve
+  outer_timing total_timing() const;
+
+  /// CMFD accelerator, if selected
+  SP_cmfd cmfd() const { return d_cmfd; }
+
 protected:
 
   //-------------------------------------------------------------------------//
@@ -112,6 +208,108 @@ protected:
   /// Over-relaxation parameter
   double d_omega;
 
+  /// Acceleration scheme
+  int d_acceleration;
+
+  /// Outer iterations of the last solve
+  int d_number_iterations;
+
+  /// Previous density and workspace for the next one.  These and the
+  /// density of the fission source are rotated by swaps, not copied.
+  moments_type d_fd_old;
+  moments_type d_fd;
+
+  /// Timing of each outer of the last solve
+  vec_timing d_timing;
+
+  /// Chebyshev free iterations, cycle degree, and step within a cycle
+  int d_chebyshev_free;
+  int d_chebyshev_degree;
+  int d_chebyshev_step;
+  /// Free iterations performed since the last (re)start
+  int d_chebyshev_count;
+  /// User-defined and current dominance ratio estimates
+  double d_chebyshev_sigma_input;
+  double d_chebyshev_sigma;
+  /// Previous Chebyshev omega
+  double d_chebyshev_omega;
+  /// Last residual norm and the one at the start of the cycle
+  double d_chebyshev_error;
+  double d_chebyshev_error_0;
+  /// Density from two iterations ago
+  moments_type d_chebyshev_density;
+
+  /// Anderson depth and mixing parameter
+  int d_anderson_depth;
+  double d_anderson_beta;
+  /// Whether a previous iterate is stored
+  bool d_anderson_started;
+  /// Number of stored differences and next slot to overwrite
+  int d_anderson_count;
+  int d_anderson_next;
+  /// Differences of residuals and of iterates of the map
+  vec_moments_type d_anderson_dr;
+  vec_moments_type d_anderson_dg;
+  /// Residual and map of the previous iterate
+  moments_type d_anderson_r;
+  moments_type d_anderson_g;
+  /// Normal equations
+  vec_dbl d_anderson_A;
+  vec_dbl d_anderson_b;
+
+  /// Coarse mesh finite difference accelerator
+  SP_cmfd d_cmfd;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Reset the acceleration history
+  void reset_acceleration();
+
+  /**
+   *  @brief Relax the density and evaluate norms in one pass
+   *
+   *  @param  fd_old    Current density
+   *  @param  fd        Power iterate; relaxed on output if omega != 1
+   *  @param  norm_fd   L1 norm of the (relaxed) power iterate
+   *  @return           L1 norm of the difference of the densities
+   */
+  double relax(const moments_type &fd_old, moments_type &fd, double &norm_fd);
+
+  /**
+   *  @brief Rescale the power iterate and evaluate its residual in one pass
+   *
+   *  @param  fd_old    Current density
+   *  @param  fd        Power iterate, rescaled on output
+   *  @param  scale     Scaling factor
+   *  @return           L1 norm of the difference of the densities
+   */
+  double rescale(const moments_type &fd_old, moments_type &fd,
+                 const double scale);
+
+  /**
+   *  @brief Apply a Chebyshev step to a power iterate
+   *  @param  fd_old    Current density, exchanged with older workspace
+   *  @param  fd        Power iterate on input; extrapolated on output
+   *  @param  error     Residual norm of the power iterate
+   *  @param  norm_old  L1 norm of the current density, kept by the output
+   */
+  void chebyshev(moments_type &fd_old,
+                 moments_type &fd,
+                 const double  error,
+                 const double  norm_old);
+
+  /**
+   *  @brief Apply Anderson mixing to a power iterate
+   *  @param  fd_old    Current density
+   *  @param  fd        Power iterate on input; mixed density on output
+   *  @param  norm_old  L1 norm of the current density, kept by the output
+   */
+  void anderson(const moments_type &fd_old,
+                moments_type       &fd,
+                const double        norm_old);
+
 };
 
 } // namespace detran
@@ -11,8 +11,10 @@
 #define detran_EIGENPI_I_HH_
 
 #include "utilities/MathUtilities.hh"
+#include "utilities/Timer.hh"
 #include "utilities/Warning.hh"
 #include <algorithm>
+#include <cmath>
 #include <cstdio>
 
 namespace detran
@@ -21,7 +23,6 @@ namespace detran
 template <class D>
 void EigenPI<D>::solve()
 {
-  using detran_utilities::norm_residual;
   using detran_utilities::norm;
 
   std::cout << "Starting PI." << std::endl;
@@ -35,12 +36,16 @@ void EigenPI<D>::solve()
 
   // Initialize the fission density
   d_fissionsource->initialize();
-//
-//  d_state->clear();
-//  for (int g = 0; g < d_number_groups; ++g)
-//    for (int i = 0; i < d_state->get_mesh()->number_cells(); ++i)
-//      d_state->phi(g)[i] = 1.0;
-//  d_fissionsource->update();
+  reset_acceleration();
+  const size_t n = d_fissionsource->density().size();
+  d_fd_old.resize(n, 0.0);
+  d_fd.resize(n, 0.0);
+  d_timing.clear();
+  d_timing.reserve(d_maximum_iterations);
+  detran_utilities::Timer timer;
+
+  // L1 norm of the current density, which initialize normalizes
+  double norm_old = 1.0;
 
   // Power iterations.
   int iteration;
@@ -50,35 +55,76 @@ void EigenPI<D>::solve()
   {
     // Reset the error.
     error = 0.0;
+    d_timing.push_back(outer_timing());
+    outer_timing &t = d_timing.back();
 
-    // Save current density.
-    State::moments_type fd_old(d_fissionsource->density());
+    keff_2 = keff_1;
+    keff_1 = keff;
 
     // Setup outer iteration.  This precomputes the group sources.
-    d_fissionsource->setup_outer(1/keff);
+    timer.tic();
+    d_fissionsource->setup_outer(1/keff_1);
+    t.fission += timer.toc();
 
     // Solve the multigroup equations.
+    timer.tic();
     d_mg_solver->solve();
+    t.mg_solve += timer.toc();
+    ++t.number_mg_solves;
 
-    // Update density.
+    // Keep the current density and update to the next.
+    timer.tic();
+    d_fissionsource->swap_density(d_fd_old);
     d_fissionsource->update();
+    t.fission += timer.toc();
+
+    if (d_acceleration == COARSE_MESH)
+    {
+      // The coarse problem yields the eigenvalue and reshapes the flux,
+      // from which the density is updated again.
+      timer.tic();
+      keff = d_cmfd->update();
+      t.acceleration += timer.toc();
+      timer.tic();
+      d_fissionsource->update();
+      t.fission += timer.toc();
+    }
 
-    // Compute keff.  Here, using L1.  Could implement
-    // volume-integrated fission rate if desired.
-    State::moments_type fd(d_fissionsource->density());
+    // The power iterate is moved out of the fission source, processed,
+    // and moved back.
+    d_fissionsource->swap_density(d_fd);
 
-    // Overrelaxation
-    if (d_omega != 1.0)
+    double norm_fd = 0.0;
+    if (d_acceleration == NONE)
     {
-      for (int i = 0; i < fd.size(); ++i)
-        fd[i] = d_omega * fd[i] + (1.0 - d_omega) * fd_old[i];
+      // Overrelaxation, norm, and residual in one pass.  The keff
+      // uses the L1 norm.  Could implement volume-integrated fission
+      // rate if desired.
+      timer.tic();
+      error = relax(d_fd_old, d_fd, norm_fd);
+      keff = keff_1 * norm_fd / norm_old;
+      norm_old = norm_fd;
+      t.norms += timer.toc();
     }
-    keff_2 = keff_1;
-    keff_1 = keff;
-    keff   = keff_1 * norm(fd, "L1") / norm(fd_old, "L1");
+    else
+    {
+      // Power iterate on the scale of the current density, its
+      // residual, and the accelerated density.
+      timer.tic();
+      norm_fd = norm(d_fd, "L1");
+      if (d_acceleration == CHEBYSHEV || d_acceleration == ANDERSON)
+        keff = keff_1 * norm_fd / norm_old;
+      error = rescale(d_fd_old, d_fd, norm_old / norm_fd);
+      t.norms += timer.toc();
+      timer.tic();
+      if (d_acceleration == CHEBYSHEV)
+        chebyshev(d_fd_old, d_fd, error, norm_old);
+      else if (d_acceleration == ANDERSON)
+        anderson(d_fd_old, d_fd, norm_old);
+      t.acceleration += timer.toc();
+    }
+    d_fissionsource->swap_density(d_fd);
 
-    // Compute error in fission density.
-    error = norm_residual(fd, fd_old, "L1");
     if (d_print_level > 1 && iteration % d_print_interval == 0)
     {
       if (d_aitken)
@@ -98,12 +144,18 @@ void EigenPI<D>::solve()
     if (error < d_tolerance) break;
 
   } // eigensolver loop
+  d_number_iterations = std::min(iteration, (int)d_maximum_iterations);
 
   if (d_print_level > 0)
   {
+    outer_timing total = total_timing();
     printf("*********************************************************************\n");
     printf(" PI Final: Number Iters: %3i  Error: %12.9f keff: %12.9f \n",
            iteration, error, keff);
+    printf(" PI Time:  MG: %10.3e (%i solves) Fission: %10.3e "
+           "Norms: %10.3e Accel: %10.3e \n",
+           total.mg_solve, total.number_mg_solves, total.fission,
+           total.norms, total.acceleration);
     printf("*********************************************************************\n");
   }
 
@@ -116,6 +168,52 @@ void EigenPI<D>::solve()
   std::cout << "PI done." << std::endl;
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+inline double EigenPI<D>::relax(const moments_type &fd_old,
+                                moments_type       &fd,
+                                double             &norm_fd)
+{
+  const int n = fd.size();
+  double error = 0.0;
+  norm_fd = 0.0;
+  if (d_omega != 1.0)
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      double f = d_omega * fd[i] + (1.0 - d_omega) * fd_old[i];
+      fd[i] = f;
+      norm_fd += std::abs(f);
+      error   += std::abs(f - fd_old[i]);
+    }
+  }
+  else
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      norm_fd += std::abs(fd[i]);
+      error   += std::abs(fd[i] - fd_old[i]);
+    }
+  }
+  return error;
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+inline double EigenPI<D>::rescale(const moments_type &fd_old,
+                                  moments_type       &fd,
+                                  const double        scale)
+{
+  const int n = fd.size();
+  double error = 0.0;
+  for (int i = 0; i < n; ++i)
+  {
+    fd[i] *= scale;
+    error += std::abs(fd[i] - fd_old[i]);
+  }
+  return error;
+}
+
 } // end namespace detran
 
 #endif /* detran_EIGENPI_I_HH_ */
@@ -59,7 +59,7 @@ void DiffusionGainOperator::build()
   using std::endl;
 
   // Get the material map.
-  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = d_mesh->material_map();
 
   for (int g = 0; g < d_number_groups; g++)
   {
@@ -96,6 +96,15 @@ DiffusionLossOperator::DiffusionLossOperator(SP_input       input,
     }
   }
 
+  // Optionally keep a sliced ELLPACK copy for the products.
+  int sell_chunk = 0;
+  if (d_input->check("diffusion_sell_chunk"))
+    sell_chunk = d_input->get<int>("diffusion_sell_chunk");
+  int sell_sigma = sell_chunk;
+  if (d_input->check("diffusion_sell_sigma"))
+    sell_sigma = d_input->get<int>("diffusion_sell_sigma");
+  if (sell_chunk > 0) set_sliced_ellpack(sell_chunk, sell_sigma);
+
   // Build the matrix with the initial keff guess.
   build();
 
@@ -122,7 +131,7 @@ void DiffusionLossOperator::build()
   using std::endl;
 
   // Get the material map.
-  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = d_mesh->material_map();
 
   //d_material->display();
 
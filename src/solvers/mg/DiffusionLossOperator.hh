@@ -37,6 +37,13 @@ namespace detran
  *  where performing fission iteration is warranted, in which case
  *  not including the fission source is required.
  *
+ *  Relevant input database entries:
+ *    - diffusion_sell_chunk [int], 0=use CSR storage for products
+ *      (default), C>0=also keep a sliced ELLPACK copy with C rows per
+ *      slice, which vectorizes the product over rows
+ *    - diffusion_sell_sigma [int], number of rows sorted by length
+ *      before slicing (default C)
+ *
  */
 class DiffusionLossOperator: public callow::Matrix
 {
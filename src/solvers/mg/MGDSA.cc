@@ -8,6 +8,7 @@
 //---------------------------------------------------------------------------//
 
 #include "MGDSA.hh"
+#include "DSACache.hh"
 #include "callow/solver/LinearSolverCreator.hh"
 #include "ioutils/StdOutUtils.hh"
 
@@ -36,6 +37,16 @@ MGDSA::MGDSA(SP_input input,
   if (d_input->check("outer_pc_db"))
     db = d_input->get<SP_input>("outer_pc_db");
 
+  // Reuse the operator and solver of an earlier build if still current.
+  bool use_cache = DSACache::enabled(d_input);
+  if (use_cache &&
+      DSACache::find(d_input, d_material, d_mesh, d_group_cutoff,
+                     d_number_groups - 1, include_fission, db,
+                     d_operator, d_solver))
+  {
+    return;
+  }
+
   // Create the loss operator for this group
   d_operator = new Operator_T(d_input,
                               d_material,
@@ -53,6 +64,13 @@ MGDSA::MGDSA(SP_input input,
   // to set the preconditioner parameters for the diffusion solves.
   d_solver->set_operators(d_operator, db);
 
+  if (use_cache)
+  {
+    DSACache::insert(d_input, d_material, d_mesh, d_group_cutoff,
+                     d_number_groups - 1, include_fission, db,
+                     d_operator, d_solver);
+  }
+
   // DEBUG -- inherit from MatrixShell
   // set_size(d_operator->number_columns());
   // d_operator->compute_explicit("mgdiff.out");
@@ -78,15 +96,16 @@ void MGDSA::apply(Vector &V_in, Vector &V_out)
     for (int i = 0; i < size_moments; ++i)
       phi[g][i] = V_in[(g - d_group_cutoff) * size_moments + i];
 
-  // Create the total group source, and copy into temporary Z
+  // Create the total group sources, and copy into temporary Z
+  State::vec_moments_type
+    source(d_number_groups, State::moments_type(size_moments, 0.0));
+  d_scattersource->build_total_group_sources(d_group_cutoff, phi, source);
   Vector Z(size_moments * d_number_active_groups, 0.0);
   for (int g = d_group_cutoff; g < d_number_groups; g++)
   {
-    State::moments_type source(size_moments, 0.0);
-    d_scattersource->build_total_group_source(g, d_group_cutoff, phi, source);
-    //detran_ioutils::print_vec(source);
+    //detran_ioutils::print_vec(source[g]);
     for (int i = 0; i < size_moments; i++)
-      Z[(g - d_group_cutoff) * size_moments + i] = source[i];
+      Z[(g - d_group_cutoff) * size_moments + i] = source[g][i];
   }
 //  Z.print_matlab("Z.out");
   //-------------------------------------------------------------------------//
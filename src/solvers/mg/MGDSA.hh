@@ -40,6 +40,10 @@ namespace detran
  *  this implementation will serve as the upper bound for the
  *  efficacy of diffusion-based multigroup preconditioning.
  *
+ *  As for PC_DSA, if dsa_cache is set, the operator and its solver are
+ *  kept in the DSACache and reused by later preconditioners for the
+ *  same problem.
+ *
  *  @note This inherits from the shell matrix (for now) so that the
  *        action can be used to construct an explicit operator for
  *        detailed numerical studies
@@ -179,7 +179,7 @@ void MGDiffusionSolver<D>::build_boundary_source()
   int &k = ijk[2];
 
   // Get the material map.
-  detran_utilities::vec_int mat_map = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = d_mesh->material_map();
 
   // Loop over all dimensions
   for (int dim0 = 0; dim0 < D::dimension; ++dim0)
@@ -273,7 +273,7 @@ void MGDiffusionSolver<D>::fill_current()
   int &j = ijk[1];
   int &k = ijk[2];
 
-  const vec_int &mat_map = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = d_mesh->material_map();
 
   for (size_t g = 0; g < d_material->number_groups(); ++g)
   {
@@ -394,7 +394,7 @@ void MGDiffusionSolver<D>::fill_boundary()
   int &k = ijk[2];
 
   // Get the material map.
-  detran_utilities::vec_int mat_map = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = d_mesh->material_map();
 
   // Loop over all dimensions
   for (int dim0 = 0; dim0 < D::dimension; ++dim0)
@@ -76,6 +76,11 @@ namespace detran
  * downscatter, it is used for the downscatter-only block.  The user can
  * switch this using "outer_upscatter_cutoff".
  *
+ * The groups of the Krylov block are independent within one application
+ * of the operator, so the sweeper may sweep several of them in a single
+ * traversal of the mesh and quadrature.  The number of groups swept
+ * together is set by "sweeper_group_block" (see \ref Sweeper).
+ *
  * Reference:
  *   Evans, T., Davidson, G. and Mosher, S. "Parallel Algorithms for
  *   Fixed-Source and Eigenvalue Problems", NSTD Seminar (ORNL), May 27, 2010.
@@ -8,6 +8,7 @@
 //---------------------------------------------------------------------------//
 
 #include "MGTransportOperator.hh"
+#include <algorithm>
 
 namespace detran
 {
@@ -92,59 +93,73 @@ void MGTransportOperator<D>::multiply(const Vector &x,  Vector &y)
       phi[g + d_krylov_group_cutoff][i] = x[i + offset];
   }
 
-  // sweep each applicable group
-  for (int g = d_krylov_group_cutoff; g < d_number_groups; g++)
+  // build the scattering sources of all applicable groups in one pass
+  d_sweepsource->build_total_scatter(d_krylov_group_cutoff, phi);
+
+  // sweep the applicable groups in blocks, which the sweeper may
+  // traverse together
+  int block = d_sweeper->group_block();
+  for (int g_block = d_krylov_group_cutoff; g_block < d_number_groups;
+       g_block += block)
   {
-    // group index in applicable set
-    int g_index  = g - d_krylov_group_cutoff;
-    // moment offset, the starting moment index within the Krylov vector
-    int m_offset = g_index * d_moments_size;
-    // boundary offset, the starting boundary index within the Krylov vector
-    int b_offset = d_number_active_groups * d_moments_size +
-                   g_index * d_boundary_size;
-
-    // reset the source and place the original outgoing boundary flux.
-    d_boundary->clear(g);
-
-    if (d_boundary->has_reflective())
+    int number_block = std::min(block, int(d_number_groups) - g_block);
+
+    for (int g = g_block; g < g_block + number_block; g++)
     {
-      // set the incident boundary flux.
-      d_boundary->psi(g, const_cast<double*>(&x[0]) + b_offset,
-                      BoundaryBase<D>::IN, BoundaryBase<D>::SET, true);
+      // boundary offset, the starting boundary index within the Krylov vector
+      int b_offset = d_number_active_groups * d_moments_size +
+                     (g - d_krylov_group_cutoff) * d_boundary_size;
+
+      // reset the source and place the original outgoing boundary flux.
+      d_boundary->clear(g);
+
+      if (d_boundary->has_reflective())
+      {
+        // set the incident boundary flux.
+        d_boundary->psi(g, const_cast<double*>(&x[0]) + b_offset,
+                        BoundaryBase<D>::IN, BoundaryBase<D>::SET, true);
+      }
     }
 
-    // reset the source to zero.
-    d_sweepsource->reset();
-    d_sweepsource->build_total_scatter(g, d_krylov_group_cutoff, phi);
+    // copy group fluxes for sweep
+    State::vec_moments_type phi_g(phi.begin() + g_block,
+                                  phi.begin() + g_block + number_block);
 
-    // copy group flux for sweep
-    typename State::moments_type phi_g(phi[g]);
+    // sweep the block
+    d_sweeper->sweep_groups(g_block, phi_g);
 
-    // set the sweeper and sweep.
-    d_sweeper->setup_group(g);
-    d_sweeper->sweep(phi_g);
-
-    // assign the moment values.
-    for (int i = 0; i < d_moments_size; i++)
-      y[i + m_offset] = x[i + m_offset] - phi_g[i];
-
-    // assign boundary fluxes, if applicable
-    if (d_boundary->has_reflective())
+    for (int g = g_block; g < g_block + number_block; g++)
     {
-      // update the boundary (redirect outgoing as incident)
-      d_boundary->update(g);
-
-      // extract the incident boundary
-      State::angular_flux_type psi_update(d_boundary_size, 0.0);
-      d_boundary->psi(g, &psi_update[0],
-                      BoundaryBase<D>::IN, BoundaryBase<D>::GET, true);
-
-      // add the boundary values.
-      for (int a = 0; a < d_boundary_size; a++)
-        y[a + b_offset] = x[a + b_offset] - psi_update[a];
+      // group index in applicable set
+      int g_index  = g - d_krylov_group_cutoff;
+      // moment offset, the starting moment index within the Krylov vector
+      int m_offset = g_index * d_moments_size;
+      // boundary offset, the starting boundary index within the Krylov vector
+      int b_offset = d_number_active_groups * d_moments_size +
+                     g_index * d_boundary_size;
+
+      // assign the moment values.
+      for (int i = 0; i < d_moments_size; i++)
+        y[i + m_offset] = x[i + m_offset] - phi_g[g - g_block][i];
+
+      // assign boundary fluxes, if applicable
+      if (d_boundary->has_reflective())
+      {
+        // update the boundary (redirect outgoing as incident)
+        d_boundary->update(g);
+
+        // extract the incident boundary
+        detran_utilities::vec_dbl psi_update(d_boundary_size, 0.0);
+        d_boundary->psi(g, &psi_update[0],
+                        BoundaryBase<D>::IN, BoundaryBase<D>::GET, true);
+
+        // add the boundary values.
+        for (int a = 0; a < d_boundary_size; a++)
+          y[a + b_offset] = x[a + b_offset] - psi_update[a];
+      }
     }
 
-  } // end groups
+  } // end group blocks
 
 }
 
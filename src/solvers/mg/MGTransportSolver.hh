@@ -80,6 +80,13 @@ public:
   /// Solve the multigroup equations.
   virtual void solve(const double keff = 1.0) = 0;
 
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /// Within-group solver, whose sweeper is shared by all groups
+  SP_wg_solver wg_solver() const { return d_wg_solver; }
+
 protected:
 
   //-------------------------------------------------------------------------//
@@ -33,9 +33,9 @@ inline PetscErrorCode PreconditionerMG::apply(Vec x, Vec y)
   ierr = VecGetArray(y, &y_a);
   ierr = VecGetArray(z, &z_a);
 
-  // build_total_group_source(int g, int g_cutoff,
+  // build_total_group_sources(int g_cutoff,
   // const State::vec_moments_type &phi,
-  // moments_type &source)
+  // State::vec_moments_type &source)
 
   int ng = d_material->number_groups();
 
@@ -50,14 +50,15 @@ inline PetscErrorCode PreconditionerMG::apply(Vec x, Vec y)
     }
   }
 
-  // Create the total group source, and copy into x_a.
-  State::moments_type source(d_moments_size_group, 0.0);
+  // Create the total group sources, and copy into x_a.
+  State::vec_moments_type
+    source(ng, State::moments_type(d_moments_size_group, 0.0));
+  d_scattersource->build_total_group_sources(d_upscatter_cutoff, phi, source);
   for (int g = d_upscatter_cutoff; g < ng; g++)
   {
-    d_scattersource->build_total_group_source(g, d_upscatter_cutoff, phi, source);
     for (int i = 0; i < d_moments_size_group; i++)
     {
-      z_a[(g - d_upscatter_cutoff) * d_moments_size_group + i] = source[i];
+      z_a[(g - d_upscatter_cutoff) * d_moments_size_group + i] = source[g][i];
     }
   }
   // x_a now has S_times_x
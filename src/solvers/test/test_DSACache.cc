@@ -0,0 +1,213 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   test_DSACache.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  Test of DSACache
+ */
+//---------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                     \
+        FUNC(test_DSACache_WG)        \
+        FUNC(test_DSACache_MG)        \
+        FUNC(test_DSACache_disabled)  \
+        FUNC(test_DSACache_db)
+
+#include "TestDriver.hh"
+#include "DSACache.hh"
+#include "wg/PC_DSA.hh"
+#include "mg/MGDSA.hh"
+#include "callow/utils/Initialization.hh"
+#include "geometry/test/mesh_fixture.hh"
+#include "material/test/material_fixture.hh"
+
+using namespace detran_test;
+using namespace detran;
+using namespace detran_utilities;
+using namespace std;
+using std::cout;
+using std::endl;
+
+int main(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  RUN(argc, argv);
+  callow_finalize();
+}
+
+//----------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------//
+
+InputDB::SP_input test_DSACache_input()
+{
+  InputDB::SP_input inp(new InputDB());
+  inp->put<int>("number_groups", 2);
+  inp->put<int>("dsa_cache",     1);
+  inp->put<string>("bc_west",    "reflect");
+  inp->put<string>("bc_east",    "vacuum");
+  InputDB::SP_input db(new InputDB("pc_db"));
+  db->put<string>("linear_solver_type",  "gmres");
+  db->put<double>("linear_solver_atol",  1e-12);
+  db->put<double>("linear_solver_rtol",  1e-12);
+  db->put<string>("pc_type",             "ilu0");
+  db->put<int>("linear_solver_monitor_level", 0);
+  inp->put<InputDB::SP_input>("inner_pc_db", db);
+  inp->put<InputDB::SP_input>("outer_pc_db", db);
+  return inp;
+}
+
+//----------------------------------------------------------------------------//
+int test_DSACache_WG(int argc, char *argv[])
+{
+  DSACache::clear();
+  InputDB::SP_input inp = test_DSACache_input();
+  SP_material mat = material_fixture_2g();
+  SP_mesh mesh = mesh_1d_fixture();
+  State::SP_state state(new State(inp, mesh));
+  ScatterSource::SP_scattersource q(new ScatterSource(mesh, mat, state));
+
+  // The first build creates one entry per group.
+  PC_DSA::SP_pc pc1(new PC_DSA(inp, mat, mesh, q));
+  TEST(DSACache::size()          == 2);
+  TEST(DSACache::number_builds() == 2);
+  TEST(DSACache::number_hits()   == 0);
+
+  // A second build reuses both.
+  PC_DSA::SP_pc pc2(new PC_DSA(inp, mat, mesh, q));
+  TEST(DSACache::number_builds() == 2);
+  TEST(DSACache::number_hits()   == 2);
+
+  // Both preconditioners give the same action.
+  callow::Vector x(mesh->number_cells(), 1.0);
+  callow::Vector y1(mesh->number_cells(), 0.0);
+  callow::Vector y2(mesh->number_cells(), 0.0);
+  pc1->set_group(1);
+  pc2->set_group(1);
+  pc1->apply(x, y1);
+  pc2->apply(x, y2);
+  for (int i = 0; i < x.size(); ++i)
+    TEST(soft_equiv(y1[i], y2[i]));
+
+  // A change within the tolerance keeps the entries.
+  mat->set_sigma_t(0, 0, mat->sigma_t(0, 0) * 1.001);
+  PC_DSA::SP_pc pc3(new PC_DSA(inp, mat, mesh, q));
+  TEST(DSACache::number_builds() == 2);
+  TEST(DSACache::number_hits()   == 4);
+
+  // A change beyond the tolerance refreshes only the affected group.
+  mat->set_sigma_t(0, 0, mat->sigma_t(0, 0) * 1.1);
+  PC_DSA::SP_pc pc4(new PC_DSA(inp, mat, mesh, q));
+  TEST(DSACache::size()          == 2);
+  TEST(DSACache::number_builds() == 3);
+  TEST(DSACache::number_hits()   == 5);
+
+  // A different mesh is a different entry.
+  SP_mesh mesh2 = mesh_1d_fixture();
+  PC_DSA::SP_pc pc5(new PC_DSA(inp, mat, mesh2, q));
+  TEST(DSACache::size()          == 4);
+  TEST(DSACache::number_builds() == 5);
+
+  DSACache::clear();
+  TEST(DSACache::size() == 0);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_DSACache_MG(int argc, char *argv[])
+{
+  DSACache::clear();
+  InputDB::SP_input inp = test_DSACache_input();
+  SP_material mat = material_fixture_2g();
+  SP_mesh mesh = mesh_1d_fixture();
+  State::SP_state state(new State(inp, mesh));
+  ScatterSource::SP_scattersource q(new ScatterSource(mesh, mat, state));
+
+  MGDSA::SP_pc pc1(new MGDSA(inp, mat, mesh, q, 0, true));
+  MGDSA::SP_pc pc2(new MGDSA(inp, mat, mesh, q, 0, true));
+  TEST(DSACache::number_builds() == 1);
+  TEST(DSACache::number_hits()   == 1);
+
+  // Treating fission differently is a different entry.
+  MGDSA::SP_pc pc3(new MGDSA(inp, mat, mesh, q, 0, false));
+  TEST(DSACache::number_builds() == 2);
+
+  // Fission data are part of the snapshot.
+  mat->set_nu_sigma_f(1, 1, mat->nu_sigma_f(1, 1) * 1.5);
+  MGDSA::SP_pc pc4(new MGDSA(inp, mat, mesh, q, 0, true));
+  MGDSA::SP_pc pc5(new MGDSA(inp, mat, mesh, q, 0, false));
+  TEST(DSACache::number_builds() == 3);
+  TEST(DSACache::number_hits()   == 2);
+
+  DSACache::clear();
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_DSACache_disabled(int argc, char *argv[])
+{
+  DSACache::clear();
+  InputDB::SP_input inp = test_DSACache_input();
+  SP_material mat = material_fixture_2g();
+  SP_mesh mesh = mesh_1d_fixture();
+  State::SP_state state(new State(inp, mesh));
+  ScatterSource::SP_scattersource q(new ScatterSource(mesh, mat, state));
+
+  // The cache is off by default.
+  InputDB::SP_input inp_default(new InputDB());
+  TEST(!DSACache::enabled(inp_default));
+
+  inp->put<int>("dsa_cache", 0);
+  PC_DSA::SP_pc pc1(new PC_DSA(inp, mat, mesh, q));
+  PC_DSA::SP_pc pc2(new PC_DSA(inp, mat, mesh, q));
+  TEST(DSACache::size() == 0);
+
+  // A cache of one entry keeps only the last group.
+  inp->put<int>("dsa_cache", 1);
+  inp->put<int>("dsa_cache_size", 1);
+  PC_DSA::SP_pc pc3(new PC_DSA(inp, mat, mesh, q));
+  TEST(DSACache::size()          == 1);
+  TEST(DSACache::number_builds() == 2);
+
+  DSACache::clear();
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_DSACache_db(int argc, char *argv[])
+{
+  DSACache::clear();
+  InputDB::SP_input inp = test_DSACache_input();
+  SP_material mat = material_fixture_2g();
+  SP_mesh mesh = mesh_1d_fixture();
+  State::SP_state state(new State(inp, mesh));
+  ScatterSource::SP_scattersource q(new ScatterSource(mesh, mat, state));
+
+  PC_DSA::SP_pc pc1(new PC_DSA(inp, mat, mesh, q));
+  TEST(DSACache::number_builds() == 2);
+
+  // A change to the solver database rebuilds the entries in place.
+  InputDB::SP_input db = inp->get<InputDB::SP_input>("inner_pc_db");
+  db->put<string>("pc_type", "jacobi");
+  PC_DSA::SP_pc pc2(new PC_DSA(inp, mat, mesh, q));
+  TEST(DSACache::size()          == 2);
+  TEST(DSACache::number_builds() == 4);
+  TEST(DSACache::number_hits()   == 0);
+  PC_DSA::SP_pc pc3(new PC_DSA(inp, mat, mesh, q));
+  TEST(DSACache::number_builds() == 4);
+  TEST(DSACache::number_hits()   == 2);
+
+  // The same holds for the multigroup operator.
+  MGDSA::SP_pc pc4(new MGDSA(inp, mat, mesh, q, 0, true));
+  db->put<string>("pc_type", "ilu0");
+  MGDSA::SP_pc pc5(new MGDSA(inp, mat, mesh, q, 0, true));
+  TEST(DSACache::number_builds() == 6);
+
+  DSACache::clear();
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+//              end of test_DSACache.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,215 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   test_EigenPI.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  Test of EigenPI and its outer accelerations
+ */
+//---------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                       \
+        FUNC(test_EigenPI_chebyshev)    \
+        FUNC(test_EigenPI_anderson)     \
+        FUNC(test_EigenPI_timing)       \
+        FUNC(test_EigenPI_cmfd)         \
+        FUNC(test_EigenPI_cmfd_2D)
+
+#include "TestDriver.hh"
+#include "eigen/EigenPI.hh"
+#include "Mesh1D.hh"
+#include "Mesh2D.hh"
+#include "callow/utils/Initialization.hh"
+
+using namespace detran_test;
+using namespace detran;
+using namespace detran_material;
+using namespace detran_geometry;
+using namespace detran_utilities;
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  callow_initialize(argc, argv);
+  RUN(argc, argv);
+  callow_finalize();
+}
+
+//----------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------//
+
+typedef FixedSourceManager<_1D> Manager_T;
+
+// A thick one group slab, whose dominance ratio is near one
+Manager_T::SP_manager test_EigenPI_manager(const std::string acceleration)
+{
+  InputDB::SP_input inp(new InputDB());
+  inp->put<int>("number_groups",            1);
+  inp->put<int>("dimension",                1);
+  inp->put<string>("problem_type",          "eigenvalue");
+  inp->put<string>("equation",              "dd");
+  inp->put<string>("bc_west",               "reflect");
+  inp->put<string>("bc_east",               "vacuum");
+  inp->put<string>("inner_solver",          "SI");
+  inp->put<double>("inner_tolerance",       1e-10);
+  inp->put<int>("inner_max_iters",          10000);
+  inp->put<int>("inner_print_level",        0);
+  inp->put<int>("outer_max_iters",          0);
+  inp->put<int>("outer_print_level",        0);
+  inp->put<int>("eigen_max_iters",          1000);
+  inp->put<double>("eigen_tolerance",       1e-8);
+  inp->put<int>("eigen_print_level",        1);
+  inp->put<string>("eigen_pi_acceleration", acceleration);
+
+  Material::SP_material mat = Material::Create(1, 1, "slab");
+  mat->set_sigma_t(0, 0, 1.0);
+  mat->set_sigma_s(0, 0, 0, 0.5);
+  mat->set_sigma_f(0, 0, 0.5);
+  mat->set_chi(0, 0, 1.0);
+  mat->finalize();
+
+  vec_dbl cm(2, 0.0); cm[1] = 20.0;
+  vec_int fm(1, 40);
+  vec_int mt(1, 0);
+  Mesh::SP_mesh mesh(new Mesh1D(fm, cm, mt));
+
+  Manager_T::SP_manager manager(new Manager_T(inp, mat, mesh, false, true));
+  manager->setup();
+  manager->set_solver();
+  return manager;
+}
+
+// Solve the slab and return the number of outers.
+int test_EigenPI_solve(const std::string acceleration, double &keff)
+{
+  Manager_T::SP_manager manager = test_EigenPI_manager(acceleration);
+  EigenPI<_1D> solver(manager);
+  solver.solve();
+  keff = manager->state()->eigenvalue();
+  return solver.number_iterations();
+}
+
+//----------------------------------------------------------------------------//
+int test_EigenPI_chebyshev(int argc, char *argv[])
+{
+  double keff_ref = 0.0, keff = 0.0;
+  int n_ref = test_EigenPI_solve("none", keff_ref);
+  int n     = test_EigenPI_solve("chebyshev", keff);
+  TEST(soft_equiv(keff, keff_ref, 1e-6));
+  TEST(n < n_ref / 2);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_EigenPI_anderson(int argc, char *argv[])
+{
+  double keff_ref = 0.0, keff = 0.0;
+  int n_ref = test_EigenPI_solve("none", keff_ref);
+  int n     = test_EigenPI_solve("anderson", keff);
+  TEST(soft_equiv(keff, keff_ref, 1e-6));
+  TEST(n < n_ref / 2);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_EigenPI_timing(int argc, char *argv[])
+{
+  // One multigroup solve per outer.
+  EigenPI<_1D> solver(test_EigenPI_manager("anderson"));
+  solver.solve();
+  TEST(solver.timing().size() == solver.number_iterations());
+  for (int i = 0; i < solver.number_iterations(); ++i)
+  {
+    TEST(solver.timing()[i].number_mg_solves == 1);
+    TEST(solver.timing()[i].mg_solve >= 0.0);
+  }
+  EigenPI<_1D>::outer_timing total = solver.total_timing();
+  TEST(total.number_mg_solves == solver.number_iterations());
+  TEST(total.fission >= 0.0);
+  TEST(total.norms >= 0.0);
+  TEST(total.acceleration >= 0.0);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_EigenPI_cmfd(int argc, char *argv[])
+{
+  double keff_ref = 0.0, keff = 0.0;
+  int n_ref = test_EigenPI_solve("none", keff_ref);
+  int n     = test_EigenPI_solve("cmfd", keff);
+  TEST(soft_equiv(keff, keff_ref, 1e-6));
+  TEST(n < n_ref / 5);
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+// A two group core and reflector in a quarter of a square
+int test_EigenPI_solve_2D(const std::string acceleration, double &keff)
+{
+  typedef FixedSourceManager<_2D> Manager2D_T;
+  InputDB::SP_input inp(new InputDB());
+  inp->put<int>("number_groups",            2);
+  inp->put<int>("dimension",                2);
+  inp->put<string>("problem_type",          "eigenvalue");
+  inp->put<string>("equation",              "dd");
+  inp->put<string>("bc_west",               "reflect");
+  inp->put<string>("bc_south",              "reflect");
+  inp->put<string>("bc_east",               "vacuum");
+  inp->put<string>("bc_north",              "vacuum");
+  inp->put<string>("inner_solver",          "SI");
+  inp->put<double>("inner_tolerance",       1e-10);
+  inp->put<int>("inner_max_iters",          10000);
+  inp->put<int>("inner_print_level",        0);
+  inp->put<double>("outer_tolerance",       1e-10);
+  inp->put<int>("outer_max_iters",          1000);
+  inp->put<int>("outer_print_level",        0);
+  inp->put<int>("eigen_max_iters",          1000);
+  inp->put<double>("eigen_tolerance",       1e-8);
+  inp->put<int>("eigen_print_level",        1);
+  inp->put<string>("eigen_pi_acceleration", acceleration);
+
+  Material::SP_material mat = Material::Create(2, 2, "core");
+  mat->set_sigma_t(0, 0, 0.20);
+  mat->set_sigma_t(0, 1, 0.60);
+  mat->set_sigma_s(0, 0, 0, 0.17);
+  mat->set_sigma_s(0, 1, 0, 0.02);
+  mat->set_sigma_s(0, 1, 1, 0.50);
+  mat->set_sigma_f(0, 0, 0.005);
+  mat->set_sigma_f(0, 1, 0.10);
+  mat->set_chi(0, 0, 1.0);
+  mat->set_sigma_t(1, 0, 0.20);
+  mat->set_sigma_t(1, 1, 0.80);
+  mat->set_sigma_s(1, 0, 0, 0.16);
+  mat->set_sigma_s(1, 1, 0, 0.04);
+  mat->set_sigma_s(1, 1, 1, 0.79);
+  mat->finalize();
+
+  vec_dbl cm(3, 0.0); cm[1] = 100.0; cm[2] = 120.0;
+  vec_int fm(2, 0); fm[0] = 20; fm[1] = 4;
+  vec_int mt(4, 1); mt[0] = 0;
+  Mesh::SP_mesh mesh(new Mesh2D(fm, fm, cm, cm, mt));
+
+  Manager2D_T::SP_manager manager(new Manager2D_T(inp, mat, mesh, false, true));
+  manager->setup();
+  manager->set_solver();
+  EigenPI<_2D> solver(manager);
+  solver.solve();
+  keff = manager->state()->eigenvalue();
+  return solver.number_iterations();
+}
+
+//----------------------------------------------------------------------------//
+int test_EigenPI_cmfd_2D(int argc, char *argv[])
+{
+  double keff_ref = 0.0, keff = 0.0;
+  int n_ref = test_EigenPI_solve_2D("none", keff_ref);
+  int n     = test_EigenPI_solve_2D("cmfd", keff);
+  TEST(soft_equiv(keff, keff_ref, 1e-6));
+  TEST(n < n_ref / 5);
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+//              end of test_EigenPI.cc
+//---------------------------------------------------------------------------//
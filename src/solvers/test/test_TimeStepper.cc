@@ -297,10 +297,17 @@ int test_BDF_Steps(int argc, char *argv[])
 
     // Initial condition (constant psi = 1/2)
     TS_1D::SP_state ic = stepper.state();
+    State::vec_dbl buffer;
     for (int o = 0; o < stepper.quadrature()->number_octants(); ++o)
+    {
       for (int a = 0; a < stepper.quadrature()->number_angles_octant(); ++a)
+      {
+        State::angular_flux_type psi = ic->psi(0, o, a, buffer);
         for (int i = 0; i < mesh->number_cells(); ++i)
-          ic->psi(0, o, a)[i] = 0.5;
+          psi[i] = 0.5;
+        ic->store_psi(0, o, a, psi);
+      }
+    }
 
     stepper.solve(ic);
 
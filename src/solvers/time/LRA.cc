@@ -32,7 +32,7 @@ LRA::LRA(SP_mesh mesh, bool doingtransport, bool steady)
 
   d_unique_mesh_map = d_mesh->mesh_map("COARSEMESH");
   d_assembly_map    = d_mesh->mesh_map("ASSEMBLY");
-  vec_int mat_map   = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = d_mesh->material_map();
   for (int i = 0; i < d_mesh->number_cells(); ++i)
   {
     // Requiring unique fine mesh materials.
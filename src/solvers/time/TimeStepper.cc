@@ -330,7 +330,7 @@ void TimeStepper<D>::initialize_precursors()
 
   d_fissionsource->update();
   const State::moments_type &fd = d_fissionsource->density();
-  const vec_int &mt = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mt = d_mesh->material_map();
 
   for (int i = 0; i < d_material->number_precursor_groups(); ++i)
   {
@@ -364,7 +364,7 @@ void TimeStepper<D>::update_precursors(const double t,
   // Update the fission density.
   d_fissionsource->update();
   const State::moments_type &fd = d_fissionsource->density();
-  const vec_int &mt = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mt = d_mesh->material_map();
 
   /*
    *  The precursors are defined via
@@ -508,6 +508,8 @@ void TimeStepper<D>::extrapolate()
   // Extrapolate psi(n+1) = 2*psi(n+1/2) - psi(n)
   if (d_discrete)
   {
+    // Staging buffer for an angular flux stored in single precision.
+    State::vec_dbl psi_buffer;
     for (size_t g = 0; g < d_number_groups; ++g)
     {
       // Clear the scalar flux.  We'll rebuild it with the extrapolated
@@ -519,14 +521,15 @@ void TimeStepper<D>::extrapolate()
         for (size_t a = 0; a < d_quadrature->number_angles_octant(); ++a)
         {
           int angle = d_quadrature->index(o, a);
-          State::angular_flux_type &psi  = d_state->psi(g, o, a);
-          const State::angular_flux_type &psi0 = d_states[0]->psi(g, o, a);
+          State::angular_flux_type psi = d_state->psi(g, o, a, psi_buffer);
+          State::const_angular_flux_type psi0 = d_states[0]->psi(g, o, a);
           for (size_t i = 0; i < d_mesh->number_cells(); ++i)
           {
             psi[i] = 2.0 * psi[i] - psi0[i];
             if (d_fixup && psi[i] < 0.0) psi[i] = 0.0;
             d_state->phi(g)[i] += d_quadrature->weight(a) * psi[i];
           } // end cell
+          d_state->store_psi(g, o, a, psi);
         } // end angle
       } // end octant
     } // end group
@@ -8,6 +8,7 @@
 //---------------------------------------------------------------------------//
 
 #include "PC_DSA.hh"
+#include "DSACache.hh"
 #include "callow/solver/LinearSolverCreator.hh"
 
 namespace detran
@@ -35,9 +36,17 @@ PC_DSA::PC_DSA(SP_input input,
 
   // Create the group-wise diffusion operators and the
   // associated linear systems for applying the inverse.
+  bool use_cache = DSACache::enabled(d_input);
   for (int g = 0; g < d_number_groups; g++)
   {
 
+    // Reuse the operator and solver of an earlier build if still current.
+    if (use_cache && DSACache::find(d_input, d_material, d_mesh, g, g, false,
+                                    db, d_operator[g], d_solver[g]))
+    {
+      continue;
+    }
+
     // Create the loss operator for this group
     d_operator[g] = new Operator_T(d_input, d_material, d_mesh, g);
 
@@ -47,6 +56,12 @@ PC_DSA::PC_DSA(SP_input input,
     // Set the operators for this group.  The database is used
     // to set the preconditioner parameters for the diffusion solves.
     d_solver[g]->set_operators(d_operator[g], db);
+
+    if (use_cache)
+    {
+      DSACache::insert(d_input, d_material, d_mesh, g, g, false, db,
+                       d_operator[g], d_solver[g]);
+    }
   }
 
 }
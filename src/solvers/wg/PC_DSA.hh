@@ -30,6 +30,10 @@ namespace detran
  *  @f]
  *  where \f$ \mathbf{C} \f$ is the one group diffusion operator.
  *
+ *  If dsa_cache is set, the operators and their solvers are kept in
+ *  the DSACache, so preconditioners built later for the same problem
+ *  reuse them unless inner_pc_db or the cross sections have changed.
+ *
  *  @todo Include fission if treated like scatter
  */
 
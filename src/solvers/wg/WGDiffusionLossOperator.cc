@@ -85,7 +85,7 @@ void WGDiffusionLossOperator::build()
   size_t size = d_mesh->number_cells();
 
   // Get the material map.
-  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = d_mesh->material_map();
 
   // Error flag
   bool flag;
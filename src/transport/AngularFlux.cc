@@ -0,0 +1,136 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   AngularFlux.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  AngularFlux member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#include "AngularFlux.hh"
+#include <cstring>
+
+namespace detran
+{
+
+/// Alignment of the values in bytes
+static const size_t angular_flux_alignment = 64;
+
+//---------------------------------------------------------------------------//
+AngularFlux::AngularFlux()
+  : d_number_groups(0)
+  , d_number_angles(0)
+  , d_number_cells(0)
+  , d_layout(ANGLE_MAJOR)
+  , d_single(false)
+  , d_size(0)
+  , d_buffer(0)
+  , d_data(0)
+{
+  /* ... */
+}
+
+//---------------------------------------------------------------------------//
+AngularFlux::AngularFlux(const size_t number_groups,
+                         const size_t number_angles,
+                         const size_t number_cells,
+                         const int    layout,
+                         const bool   single)
+  : d_number_groups(number_groups)
+  , d_number_angles(number_angles)
+  , d_number_cells(number_cells)
+  , d_layout(layout)
+  , d_single(single)
+  , d_size(number_groups * number_angles * number_cells)
+  , d_buffer(0)
+  , d_data(0)
+{
+  Insist(d_layout >= 0 && d_layout < END_LAYOUT_TYPE,
+         "Unknown angular flux layout.");
+  allocate();
+  clear();
+}
+
+//---------------------------------------------------------------------------//
+AngularFlux::AngularFlux(const AngularFlux &other)
+  : d_number_groups(other.d_number_groups)
+  , d_number_angles(other.d_number_angles)
+  , d_number_cells(other.d_number_cells)
+  , d_layout(other.d_layout)
+  , d_single(other.d_single)
+  , d_size(other.d_size)
+  , d_buffer(0)
+  , d_data(0)
+{
+  allocate();
+  if (d_size) std::memcpy(d_data, other.d_data, memory());
+}
+
+//---------------------------------------------------------------------------//
+AngularFlux& AngularFlux::operator=(const AngularFlux &other)
+{
+  if (this == &other) return *this;
+  if (d_size != other.d_size || d_single != other.d_single)
+  {
+    delete [] d_buffer;
+    d_buffer = 0;
+    d_data = 0;
+    d_size = other.d_size;
+    d_single = other.d_single;
+    allocate();
+  }
+  d_number_groups = other.d_number_groups;
+  d_number_angles = other.d_number_angles;
+  d_number_cells  = other.d_number_cells;
+  d_layout        = other.d_layout;
+  if (d_size) std::memcpy(d_data, other.d_data, memory());
+  return *this;
+}
+
+//---------------------------------------------------------------------------//
+AngularFlux::~AngularFlux()
+{
+  delete [] d_buffer;
+}
+
+//---------------------------------------------------------------------------//
+void AngularFlux::clear()
+{
+  if (d_size) std::memset(d_data, 0, memory());
+}
+
+//---------------------------------------------------------------------------//
+void AngularFlux::scale(const double f)
+{
+  if (d_single)
+  {
+    float *v = (float*) d_data;
+    for (size_t i = 0; i < d_size; ++i)
+      v[i] *= f;
+  }
+  else
+  {
+    double *v = (double*) d_data;
+    for (size_t i = 0; i < d_size; ++i)
+      v[i] *= f;
+  }
+}
+
+//---------------------------------------------------------------------------//
+void AngularFlux::allocate()
+{
+  if (!d_size) return;
+  // Over-allocate, and start the values at the first aligned byte.
+  d_buffer = new char[memory() + angular_flux_alignment];
+  std::size_t address = (std::size_t) d_buffer;
+  std::size_t shift = (angular_flux_alignment -
+                       address % angular_flux_alignment) %
+                      angular_flux_alignment;
+  d_data = d_buffer + shift;
+}
+
+} // end namespace detran
+
+//---------------------------------------------------------------------------//
+//              end of AngularFlux.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,321 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   AngularFlux.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  AngularFlux and AngularFluxView class definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_ANGULARFLUX_HH_
+#define detran_ANGULARFLUX_HH_
+
+#include "transport/transport_export.hh"
+#include "utilities/Definitions.hh"
+#include "utilities/DBC.hh"
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class AngularFluxView
+ *  @brief Writable view of the angular flux of one group and angle.
+ *
+ *  A view refers to double precision storage owned elsewhere, either an
+ *  AngularFlux or a buffer into which single precision values have been
+ *  staged, and indexes it by cell with a fixed stride.  Elements are plain
+ *  doubles, so the sweeps read and write them with no conversion.  Copying
+ *  a view copies only the reference to the storage.
+ */
+//---------------------------------------------------------------------------//
+
+class TRANSPORT_EXPORT AngularFluxView
+{
+
+public:
+
+  //-------------------------------------------------------------------------//
+  // TYPEDEFS
+  //-------------------------------------------------------------------------//
+
+  typedef detran_utilities::size_t  size_t;
+
+  //-------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //-------------------------------------------------------------------------//
+
+  /// Empty view
+  AngularFluxView()
+    : d_values(0), d_size(0), d_stride(1) {}
+  /// View of n doubles with a stride
+  AngularFluxView(double *v, const size_t n, const size_t stride = 1)
+    : d_values(v), d_size(n), d_stride(stride) {}
+
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /// Value in a cell
+  double& operator[](const size_t i) const
+  {
+    Require(i < d_size);
+    return d_values[i * d_stride];
+  }
+  /// Number of cells
+  size_t size() const { return d_size; }
+  /// Is this an empty view?
+  bool empty() const { return d_size == 0; }
+  /// Distance between consecutive cells
+  size_t stride() const { return d_stride; }
+  /// Values with unit stride, or NULL
+  double* data() const { return d_stride == 1 ? d_values : 0; }
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // DATA
+  //-------------------------------------------------------------------------//
+
+  /// Values
+  double *d_values;
+  /// Number of cells
+  size_t d_size;
+  /// Distance between consecutive cells
+  size_t d_stride;
+
+};
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class ConstAngularFluxView
+ *  @brief Read-only view of the angular flux of one group and angle.
+ *
+ *  The values may be stored in single or double precision; either way,
+ *  they are read as doubles.  This is meant for output and other work
+ *  outside of the sweeps, which use an AngularFluxView instead.
+ */
+//---------------------------------------------------------------------------//
+
+class TRANSPORT_EXPORT ConstAngularFluxView
+{
+
+public:
+
+  //-------------------------------------------------------------------------//
+  // TYPEDEFS
+  //-------------------------------------------------------------------------//
+
+  typedef detran_utilities::size_t  size_t;
+
+  //-------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //-------------------------------------------------------------------------//
+
+  /// Empty view
+  ConstAngularFluxView()
+    : d_double(0), d_float(0), d_size(0), d_stride(1) {}
+  /// View of n doubles with a stride
+  ConstAngularFluxView(const double *v, const size_t n, const size_t stride = 1)
+    : d_double(v), d_float(0), d_size(n), d_stride(stride) {}
+  /// View of n floats with a stride
+  ConstAngularFluxView(const float *v, const size_t n, const size_t stride = 1)
+    : d_double(0), d_float(v), d_size(n), d_stride(stride) {}
+
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /// Value in a cell
+  double operator[](const size_t i) const
+  {
+    Require(i < d_size);
+    return d_double ? d_double[i * d_stride] : double(d_float[i * d_stride]);
+  }
+  /// Copy all values into v, which must hold size() values
+  void copy(double *v) const;
+  /// Number of cells
+  size_t size() const { return d_size; }
+  /// Is this an empty view?
+  bool empty() const { return d_size == 0; }
+  /// Distance between consecutive cells
+  size_t stride() const { return d_stride; }
+  /// Values in double precision with unit stride, or NULL
+  const double* data() const { return d_stride == 1 ? d_double : 0; }
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // DATA
+  //-------------------------------------------------------------------------//
+
+  /// Double precision values, if used
+  const double *d_double;
+  /// Single precision values, if used
+  const float *d_float;
+  /// Number of cells
+  size_t d_size;
+  /// Distance between consecutive cells
+  size_t d_stride;
+
+};
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class AngularFlux
+ *  @brief Contiguous angular flux for all groups, angles, and cells.
+ *
+ *  All values live in one buffer aligned to 64 bytes.  The layout is
+ *  either angle major, [group][angle][cell], so that the cells of one
+ *  angle are contiguous, or cell major, [group][cell][angle], so that the
+ *  angles of one cell are contiguous.  The values are stored in double
+ *  precision by default, or optionally in single precision to halve the
+ *  memory.  Clients read one group and angle at a time through a
+ *  ConstAngularFluxView.  To write, they get an AngularFluxView, which
+ *  refers to the values directly in double precision or to a buffer into
+ *  which single precision values are staged, and then store() it.  This
+ *  keeps the choice of precision out of the loops over cells.
+ */
+//---------------------------------------------------------------------------//
+
+class TRANSPORT_EXPORT AngularFlux
+{
+
+public:
+
+  //-------------------------------------------------------------------------//
+  // ENUMERATIONS
+  //-------------------------------------------------------------------------//
+
+  enum layout_type
+  {
+    ANGLE_MAJOR, CELL_MAJOR, END_LAYOUT_TYPE
+  };
+
+  //-------------------------------------------------------------------------//
+  // TYPEDEFS
+  //-------------------------------------------------------------------------//
+
+  typedef detran_utilities::size_t  size_t;
+
+  //-------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //-------------------------------------------------------------------------//
+
+  /// Empty angular flux
+  AngularFlux();
+
+  /**
+   *  @brief Constructor
+   *  @param number_groups    Number of groups
+   *  @param number_angles    Number of angles over all octants
+   *  @param number_cells     Number of cells
+   *  @param layout           Layout of the values
+   *  @param single           Store the values in single precision?
+   */
+  AngularFlux(const size_t number_groups,
+              const size_t number_angles,
+              const size_t number_cells,
+              const int    layout = ANGLE_MAJOR,
+              const bool   single = false);
+
+  /// Copy constructor
+  AngularFlux(const AngularFlux &other);
+
+  /// Assignment
+  AngularFlux& operator=(const AngularFlux &other);
+
+  /// Destructor
+  ~AngularFlux();
+
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /// Read-only view of a group and angle
+  ConstAngularFluxView view(const size_t g, const size_t angle) const;
+
+  /**
+   *  @brief Writable view of a group and angle.
+   *
+   *  Values stored in double precision are viewed directly.  Values stored
+   *  in single precision are copied into the buffer, which is resized as
+   *  needed, and the view refers to it; they are written back by store().
+   *
+   *  @param g        Group
+   *  @param angle    Angle over all octants
+   *  @param buffer   Staging buffer for single precision values
+   */
+  AngularFluxView view(const size_t g,
+                       const size_t angle,
+                       detran_utilities::vec_dbl &buffer);
+
+  /// Write back a view from view(g, angle, buffer); no-op in double precision
+  void store(const size_t g, const size_t angle, const AngularFluxView &v);
+
+  /// Set all values to zero
+  void clear();
+
+  /// Scale all values by a constant
+  void scale(const double f);
+
+  /// Layout of the values
+  int layout() const { return d_layout; }
+
+  /// Are the values stored in single precision?
+  bool single() const { return d_single; }
+
+  /// Memory used by the values in bytes
+  size_t memory() const { return d_size * value_size(); }
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // DATA
+  //-------------------------------------------------------------------------//
+
+  /// Number of groups
+  size_t d_number_groups;
+  /// Number of angles
+  size_t d_number_angles;
+  /// Number of cells
+  size_t d_number_cells;
+  /// Layout
+  int d_layout;
+  /// Single precision?
+  bool d_single;
+  /// Number of values
+  size_t d_size;
+  /// Allocated memory
+  char *d_buffer;
+  /// Aligned start of the values within the buffer
+  void *d_data;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Bytes per value
+  size_t value_size() const { return d_single ? sizeof(float) : sizeof(double); }
+
+  /// Allocate the aligned buffer
+  void allocate();
+
+  /// Offset and stride of a group and angle
+  size_t offset(const size_t g, const size_t angle, size_t &stride) const;
+
+};
+
+} // end namespace detran
+
+//---------------------------------------------------------------------------//
+// INLINE MEMBER DEFINITIONS
+//---------------------------------------------------------------------------//
+
+#include "AngularFlux.i.hh"
+
+#endif /* detran_ANGULARFLUX_HH_ */
+
+//---------------------------------------------------------------------------//
+//              end of AngularFlux.hh
+//---------------------------------------------------------------------------//
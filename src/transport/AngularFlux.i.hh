@@ -0,0 +1,93 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   AngularFlux.i.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  AngularFlux inline member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_ANGULARFLUX_I_HH_
+#define detran_ANGULARFLUX_I_HH_
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+inline void ConstAngularFluxView::copy(double *v) const
+{
+  if (d_double)
+  {
+    for (size_t i = 0; i < d_size; ++i)
+      v[i] = d_double[i * d_stride];
+  }
+  else
+  {
+    for (size_t i = 0; i < d_size; ++i)
+      v[i] = d_float[i * d_stride];
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline AngularFlux::size_t
+AngularFlux::offset(const size_t g, const size_t angle, size_t &stride) const
+{
+  Require(g < d_number_groups);
+  Require(angle < d_number_angles);
+  if (d_layout == ANGLE_MAJOR)
+  {
+    stride = 1;
+    return (g * d_number_angles + angle) * d_number_cells;
+  }
+  stride = d_number_angles;
+  return g * d_number_cells * d_number_angles + angle;
+}
+
+//---------------------------------------------------------------------------//
+inline ConstAngularFluxView
+AngularFlux::view(const size_t g, const size_t angle) const
+{
+  size_t stride = 1;
+  size_t i = offset(g, angle, stride);
+  if (d_single)
+    return ConstAngularFluxView((const float*) d_data + i, d_number_cells, stride);
+  return ConstAngularFluxView((const double*) d_data + i, d_number_cells, stride);
+}
+
+//---------------------------------------------------------------------------//
+inline AngularFluxView
+AngularFlux::view(const size_t g,
+                  const size_t angle,
+                  detran_utilities::vec_dbl &buffer)
+{
+  size_t stride = 1;
+  size_t i = offset(g, angle, stride);
+  if (!d_single)
+    return AngularFluxView((double*) d_data + i, d_number_cells, stride);
+  buffer.resize(d_number_cells);
+  const float *v = (const float*) d_data + i;
+  for (size_t cell = 0; cell < d_number_cells; ++cell)
+    buffer[cell] = v[cell * stride];
+  return AngularFluxView(&buffer[0], d_number_cells);
+}
+
+//---------------------------------------------------------------------------//
+inline void AngularFlux::store(const size_t g,
+                               const size_t angle,
+                               const AngularFluxView &v)
+{
+  if (!d_single) return;
+  Require(v.size() == d_number_cells);
+  size_t stride = 1;
+  float *f = (float*) d_data + offset(g, angle, stride);
+  for (size_t cell = 0; cell < d_number_cells; ++cell)
+    f[cell * stride] = float(v[cell]);
+}
+
+} // end namespace detran
+
+#endif /* detran_ANGULARFLUX_I_HH_ */
+
+//---------------------------------------------------------------------------//
+//              end of AngularFlux.i.hh
+//---------------------------------------------------------------------------//
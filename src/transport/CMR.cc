@@ -100,7 +100,7 @@ void CMR<_1D>::integrate(State::moments_type &phi, SP_sweepsource sweepsource)
 {
   int number_coarse = b_coarse_mesh->number_cells();
 
-  vec_int mat_map = b_mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = b_mesh->material_map();
 
   for (int cell_coarse = 0; cell_coarse < number_coarse; cell_coarse++)
   {
@@ -0,0 +1,101 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   CellCrossSections.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  CellCrossSections member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#include "CellCrossSections.hh"
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+CellCrossSections::CellCrossSections(SP_mesh      mesh,
+                                     SP_material  material,
+                                     const double memory)
+  : d_mesh(mesh)
+  , d_material(material)
+  , d_budget(1048576.0 * memory)
+  , d_bytes(0.0)
+  , d_revision(0)
+  , d_updated(false)
+{
+  Require(d_mesh);
+  Require(d_material);
+  Insist(memory >= 0.0, "The cell cross section memory must be nonnegative.");
+
+  d_mat_map = d_mesh->material_map();
+  size_t ng = d_material->number_groups();
+  d_sigma_t.resize(ng);
+  d_nu_sigma_f.resize(ng);
+  d_chi.resize(ng);
+  d_sigma_s.resize(ng * ng);
+  update();
+}
+
+//---------------------------------------------------------------------------//
+CellCrossSections::SP_cellxs
+CellCrossSections::Create(SP_mesh      mesh,
+                          SP_material  material,
+                          const double memory)
+{
+  SP_cellxs p(new CellCrossSections(mesh, material, memory));
+  return p;
+}
+
+//---------------------------------------------------------------------------//
+void CellCrossSections::update()
+{
+  if (current()) return;
+
+  // Discard the arrays of the previous revision.
+  size_t ng = d_sigma_t.size();
+  for (size_t g = 0; g < ng; ++g)
+  {
+    vec_dbl().swap(d_sigma_t[g]);
+    vec_dbl().swap(d_nu_sigma_f[g]);
+    vec_dbl().swap(d_chi[g]);
+  }
+  for (size_t i = 0; i < d_sigma_s.size(); ++i)
+    vec_dbl().swap(d_sigma_s[i]);
+  d_bytes   = 0.0;
+  d_updated = false;
+
+  // The rows used to build the arrays exist only after finalization.
+  if (!d_material->finalized()) return;
+  d_revision = d_material->revision();
+  d_updated  = true;
+
+  // Total cross sections are used by every sweep, so they come first.
+  for (size_t g = 0; g < ng; ++g)
+    expand(d_material->sigma_t_row(g), d_sigma_t[g]);
+  for (size_t g = 0; g < ng; ++g)
+  {
+    expand(d_material->nu_sigma_f_row(g), d_nu_sigma_f[g]);
+    expand(d_material->chi_row(g), d_chi[g]);
+  }
+  for (size_t g = 0; g < ng; ++g)
+    for (size_t gp = d_material->lower(g); gp <= d_material->upper(g); ++gp)
+      expand(d_material->sigma_s_row(g, gp), d_sigma_s[g * ng + gp]);
+}
+
+//---------------------------------------------------------------------------//
+void CellCrossSections::expand(const double *row, vec_dbl &v)
+{
+  size_t nc = d_mesh->number_cells();
+  double bytes = sizeof(double) * nc;
+  if (nc == 0 || d_bytes + bytes > d_budget) return;
+  v.resize(nc);
+  for (size_t cell = 0; cell < nc; ++cell)
+    v[cell] = row[d_mat_map[cell]];
+  d_bytes += bytes;
+}
+
+} // end namespace detran
+
+//---------------------------------------------------------------------------//
+//              end of CellCrossSections.cc
+//---------------------------------------------------------------------------//
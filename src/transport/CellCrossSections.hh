@@ -0,0 +1,173 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   CellCrossSections.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  CellCrossSections class definition.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_CELLCROSSSECTIONS_HH_
+#define detran_CELLCROSSSECTIONS_HH_
+
+#include "transport/transport_export.hh"
+#include "geometry/Mesh.hh"
+#include "material/Material.hh"
+#include "utilities/Definitions.hh"
+#include "utilities/DBC.hh"
+#include "utilities/SP.hh"
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class CellCrossSections
+ *  @brief Cross sections expanded over the cells of a mesh.
+ *
+ *  The equations and sources look up a cross section for each cell
+ *  through the material map, i.e. sigma(mat_map[cell], g).  This class
+ *  gathers the values for a group into an array indexed by cell, so that
+ *  the inner loops stream through memory with unit stride.
+ *
+ *  The arrays are built by update(), which gathers the total cross
+ *  sections of all groups, then the fission cross sections and spectra,
+ *  and then the scatter cross sections, until the memory budget is
+ *  exhausted.  The accessors return NULL for any array not built, and
+ *  the clients fall back to the material map.  The arrays are shared by
+ *  the sweeper, its equations, and the sources, and update() must be
+ *  called again whenever the material revision changes.
+ *
+ *  Updating is not thread safe and must be done outside of parallel
+ *  regions, e.g. in Sweeper::setup_group.  The accessors only read, so
+ *  the equations may use them within parallel regions.
+ */
+//---------------------------------------------------------------------------//
+
+class TRANSPORT_EXPORT CellCrossSections
+{
+
+public:
+
+  //-------------------------------------------------------------------------//
+  // TYPEDEFS
+  //-------------------------------------------------------------------------//
+
+  typedef detran_utilities::SP<CellCrossSections>   SP_cellxs;
+  typedef detran_geometry::Mesh::SP_mesh            SP_mesh;
+  typedef detran_material::Material::SP_material    SP_material;
+  typedef detran_utilities::vec_int                 vec_int;
+  typedef detran_utilities::vec_dbl                 vec_dbl;
+  typedef detran_utilities::vec2_dbl                vec2_dbl;
+  typedef detran_utilities::size_t                  size_t;
+
+  //-------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *  @param mesh       Mesh
+   *  @param material   Material
+   *  @param memory     Memory budget in MB
+   */
+  CellCrossSections(SP_mesh mesh, SP_material material,
+                    const double memory = 128.0);
+
+  /// SP constructor
+  static SP_cellxs Create(SP_mesh mesh, SP_material material,
+                          const double memory = 128.0);
+
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Build the arrays for the current material revision.
+   *
+   *  Nothing is done if they are current or if the material is not
+   *  yet finalized.
+   */
+  void update();
+
+  /// Are the arrays built for the current material revision?
+  bool current() const
+  {
+    return d_updated && d_material->revision() == d_revision;
+  }
+
+  //@{
+  /// Cross section for all cells in a group, or NULL if unavailable.
+  const double* sigma_t(const size_t g) const;
+  const double* nu_sigma_f(const size_t g) const;
+  const double* chi(const size_t g) const;
+  //@}
+
+  /**
+   *  @brief Scatter cross section g <-- gp for all cells.
+   *
+   *  Returns NULL if unavailable or if gp lies outside the scatter
+   *  bounds of g.
+   */
+  const double* sigma_s(const size_t g, const size_t gp) const;
+
+  /// Memory currently used by the arrays in bytes
+  double memory() const { return d_bytes; }
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // DATA
+  //-------------------------------------------------------------------------//
+
+  /// Mesh
+  SP_mesh d_mesh;
+  /// Material
+  SP_material d_material;
+  /// Material map
+  detran_geometry::MeshMap d_mat_map;
+  /// Memory budget in bytes
+  double d_budget;
+  /// Memory used in bytes
+  double d_bytes;
+  /// Material revision of the arrays
+  size_t d_revision;
+  /// Have the arrays been built?
+  bool d_updated;
+  /// Expanded total cross section [group, cell]
+  vec2_dbl d_sigma_t;
+  /// Expanded nu * fission cross section [group, cell]
+  vec2_dbl d_nu_sigma_f;
+  /// Expanded fission spectrum [group, cell]
+  vec2_dbl d_chi;
+  /// Expanded scatter cross section [group * groups + group', cell]
+  vec2_dbl d_sigma_s;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Gather a material row into a cell array if it fits in the budget.
+  void expand(const double *row, vec_dbl &v);
+
+  /// Array or NULL if empty
+  static const double* data(const vec_dbl &v)
+  {
+    return v.empty() ? NULL : &v[0];
+  }
+
+};
+
+} // end namespace detran
+
+//---------------------------------------------------------------------------//
+// INLINE MEMBER DEFINITIONS
+//---------------------------------------------------------------------------//
+
+#include "CellCrossSections.i.hh"
+
+#endif /* detran_CELLCROSSSECTIONS_HH_ */
+
+//---------------------------------------------------------------------------//
+//              end of CellCrossSections.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,56 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   CellCrossSections.i.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  CellCrossSections inline member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_CELLCROSSSECTIONS_I_HH_
+#define detran_CELLCROSSSECTIONS_I_HH_
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+inline const double* CellCrossSections::sigma_t(const size_t g) const
+{
+  Require(g < d_sigma_t.size());
+  Require(current() || !d_material->finalized());
+  return data(d_sigma_t[g]);
+}
+
+//---------------------------------------------------------------------------//
+inline const double* CellCrossSections::nu_sigma_f(const size_t g) const
+{
+  Require(g < d_nu_sigma_f.size());
+  Require(current() || !d_material->finalized());
+  return data(d_nu_sigma_f[g]);
+}
+
+//---------------------------------------------------------------------------//
+inline const double* CellCrossSections::chi(const size_t g) const
+{
+  Require(g < d_chi.size());
+  Require(current() || !d_material->finalized());
+  return data(d_chi[g]);
+}
+
+//---------------------------------------------------------------------------//
+inline const double* CellCrossSections::sigma_s(const size_t g,
+                                                const size_t gp) const
+{
+  Require(g < d_sigma_t.size());
+  Require(gp < d_sigma_t.size());
+  Require(current() || !d_material->finalized());
+  return data(d_sigma_s[g * d_sigma_t.size() + gp]);
+}
+
+} // end namespace detran
+
+#endif /* detran_CELLCROSSSECTIONS_I_HH_ */
+
+//---------------------------------------------------------------------------//
+//              end of CellCrossSections.i.hh
+//---------------------------------------------------------------------------//
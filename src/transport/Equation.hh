@@ -12,6 +12,8 @@
 
 #include "transport/transport_export.hh"
 #include "DimensionTraits.hh"
+#include "transport/AngularFlux.hh"
+#include "transport/CellCrossSections.hh"
 #include "material/Material.hh"
 #include "geometry/Mesh.hh"
 #include "angle/Quadrature.hh"
@@ -66,8 +68,9 @@ public:
   typedef detran_material::Material::SP_material          SP_material;
   typedef detran_geometry::Mesh::SP_mesh                  SP_mesh;
   typedef detran_angle::Quadrature::SP_quadrature         SP_quadrature;
+  typedef CellCrossSections::SP_cellxs                    SP_cellxs;
   typedef detran_utilities::vec_dbl                       moments_type;
-  typedef detran_utilities::vec_dbl                       angular_flux_type;
+  typedef AngularFluxView                                 angular_flux_type;
   typedef typename EquationTraits<D>::face_flux_type      face_flux_type;
   typedef detran_utilities::size_t                        size_t;
 
@@ -93,6 +96,7 @@ public:
     ,  d_g(0)
     ,  d_octant(0)
     ,  d_angle(0)
+    ,  d_sigma_t(NULL)
   {
     // Preconditions
     Require(mesh);
@@ -100,7 +104,7 @@ public:
     Require(quadrature);
 
     // Get the material map.
-    d_mat_map =  mesh->mesh_map("MATERIAL");
+    d_mat_map = mesh->material_map();
   }
 
   // Virtual destructor
@@ -149,6 +153,15 @@ public:
    */
   virtual void setup_angle(const size_t angle) = 0;
 
+  /**
+   *  @brief Use cell-wise cross sections, set before the group.
+   *  @param xs   Cell cross sections; if null, use the material map.
+   */
+  void set_cell_xs(SP_cellxs xs)
+  {
+    d_cell_xs = xs;
+  }
+
 protected:
 
   //-------------------------------------------------------------------------//
@@ -168,7 +181,7 @@ protected:
   /// Current ksi value
   double d_ksi;
   /// Material map
-  detran_utilities::vec_int d_mat_map;
+  detran_geometry::MeshMap d_mat_map;
   /// Update the angular flux?
   bool d_update_psi;
   /// Current group
@@ -177,6 +190,28 @@ protected:
   size_t d_octant;
   /// Current angle index.
   size_t d_angle;
+  /// Optional cell cross sections
+  SP_cellxs d_cell_xs;
+  /// Total cross section by cell for the current group, if available
+  const double *d_sigma_t;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Set the current group and its cell cross sections.
+  void set_group(const size_t g)
+  {
+    d_g = g;
+    d_sigma_t = d_cell_xs ? d_cell_xs->sigma_t(g) : NULL;
+  }
+
+  /// Total cross section of a cell in the current group
+  double sigma_t(const size_t cell) const
+  {
+    if (d_sigma_t) return d_sigma_t[cell];
+    return d_material->sigma_t(d_mat_map[cell], d_g);
+  }
 
 };
 
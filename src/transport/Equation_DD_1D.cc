@@ -28,7 +28,7 @@ void Equation_DD_1D::setup_group(const size_t g)
 {
   Require(g >= 0);
   Require(g < d_material->number_groups());
-  d_g = g;
+  set_group(g);
 }
 
 //---------------------------------------------------------------------------//
@@ -20,15 +20,31 @@ Equation_DD_2D::Equation_DD_2D(SP_mesh       mesh,
   :  Equation<_2D>(mesh, material, quadrature, update_psi)
   ,  d_coef_x(mesh->number_cells_x())
   ,  d_coef_y(mesh->number_cells_y())
+  ,  d_number_angles(quadrature->number_angles_octant())
+  ,  d_coef_x_angles(mesh->number_cells_x() * d_number_angles)
+  ,  d_coef_y_angles(mesh->number_cells_y() * d_number_angles)
+  ,  d_weights(d_number_angles)
 {
-  /* ... */
+  // The coefficients depend only on |mu| and |eta|, so one table
+  // serves every octant of the angle-batched solve.
+  size_t na = d_number_angles;
+  for (size_t a = 0; a < na; ++a)
+  {
+    double mu  = d_quadrature->mu(0, a);
+    double eta = d_quadrature->eta(0, a);
+    for (size_t i = 0; i < d_mesh->number_cells_x(); ++i)
+      d_coef_x_angles[i * na + a] = 2.0 * mu / d_mesh->dx(i);
+    for (size_t j = 0; j < d_mesh->number_cells_y(); ++j)
+      d_coef_y_angles[j * na + a] = 2.0 * eta / d_mesh->dy(j);
+    d_weights[a] = d_quadrature->weight(a);
+  }
 }
 
 //---------------------------------------------------------------------------//
 void Equation_DD_2D::setup_group(const size_t g)
 {
   Require(g < d_material->number_groups());
-  d_g = g;
+  set_group(g);
 }
 
 //---------------------------------------------------------------------------//
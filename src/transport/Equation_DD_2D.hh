@@ -73,6 +73,66 @@ public:
   /// Setup the equations for an angle.
   void setup_angle(const size_t angle);
 
+  //-------------------------------------------------------------------------//
+  // ANGLE-BATCHED INTERFACE
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Solve a cell for all angles of the current octant at once.
+   *
+   *  All angular arrays are stored angle-innermost, so the loop over
+   *  angles is unit stride and can be vectorized by the compiler.  The
+   *  incident edge fluxes are overwritten by the outgoing ones.  The
+   *  result agrees to round-off with solve() applied to each angle in
+   *  turn.
+   *
+   *  @param  i       x cell index
+   *  @param  j       y cell index
+   *  @param  source  sweep source for this cell, [angle]
+   *  @param  psi_v   incident/outgoing vertical edge fluxes, [angle]
+   *  @param  psi_h   incident/outgoing horizontal edge fluxes, [angle]
+   *  @param  psi     cell-center angular fluxes, [angle]
+   *  @return         weighted sum of the cell-center angular fluxes
+   */
+  inline double solve_angles(const size_t  i,
+                             const size_t  j,
+                             const double *source,
+                             double       *psi_v,
+                             double       *psi_h,
+                             double       *psi);
+
+  //-------------------------------------------------------------------------//
+  // GROUP-BLOCKED INTERFACE
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Solve a cell for the current angle and a block of groups.
+   *
+   *  All arrays are stored group-innermost, so the loop over groups is
+   *  unit stride and can be vectorized by the compiler.  The incident
+   *  edge fluxes are overwritten by the outgoing ones.  The result
+   *  matches solve() applied to each group in turn.
+   *
+   *  @param  i             x cell index
+   *  @param  j             y cell index
+   *  @param  number_groups number of groups in the block
+   *  @param  sigma         total cross sections for this cell, [group]
+   *  @param  source        sweep source for this cell, [group]
+   *  @param  psi_v         incident/outgoing vertical edge fluxes, [group]
+   *  @param  psi_h         incident/outgoing horizontal edge fluxes, [group]
+   *  @param  phi           flux moments for this cell, [group], updated
+   *  @param  psi           cell-center angular fluxes, [group]
+   */
+  inline void solve_groups(const size_t  i,
+                           const size_t  j,
+                           const size_t  number_groups,
+                           const double *sigma,
+                           const double *source,
+                           double       *psi_v,
+                           double       *psi_h,
+                           double       *phi,
+                           double       *psi);
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -85,6 +145,18 @@ private:
   /// Y-directed coefficient, \f$ 2|\eta|/\Delta_y \f$.
   detran_utilities::vec_dbl d_coef_y;
 
+  /// Number of angles per octant
+  size_t d_number_angles;
+
+  /// X-directed coefficients for all angles, [i][angle]
+  detran_utilities::vec_dbl d_coef_x_angles;
+
+  /// Y-directed coefficients for all angles, [j][angle]
+  detran_utilities::vec_dbl d_coef_y_angles;
+
+  /// Quadrature weights for all angles
+  detran_utilities::vec_dbl d_weights;
+
 };
 
 } // end namespace detran
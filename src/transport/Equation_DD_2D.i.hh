@@ -28,8 +28,7 @@ inline void Equation_DD_2D::solve(const size_t i,
 
   // Compute cell-center angular flux.
   int cell = d_mesh->index(i, j);
-  double coef = 1.0 / (d_material->sigma_t(d_mat_map[cell], d_g) +
-                       d_coef_x[i] + d_coef_y[j]);
+  double coef = 1.0 / (sigma_t(cell) + d_coef_x[i] + d_coef_y[j]);
   double psi_center = coef * (source[cell] +
                               d_coef_x[i] * psi_in[detran_geometry::Mesh::VERT] +
                               d_coef_y[j] * psi_in[detran_geometry::Mesh::HORZ] );
@@ -49,6 +48,68 @@ inline void Equation_DD_2D::solve(const size_t i,
 
 }
 
+//---------------------------------------------------------------------------//
+inline double Equation_DD_2D::solve_angles(const size_t  i,
+                                           const size_t  j,
+                                           const double *source,
+                                           double       *psi_v,
+                                           double       *psi_h,
+                                           double       *psi)
+{
+  const size_t na = d_number_angles;
+  const double *cx = &d_coef_x_angles[i * na];
+  const double *cy = &d_coef_y_angles[j * na];
+
+  // One material lookup serves all angles.
+  int cell = d_mesh->index(i, j);
+  const double sigma = sigma_t(cell);
+
+  for (size_t a = 0; a < na; ++a)
+  {
+    double coef = 1.0 / (sigma + cx[a] + cy[a]);
+    double psi_center = coef * (source[a] + cx[a] * psi_v[a] +
+                                            cy[a] * psi_h[a]);
+    double two_psi_center = 2.0 * psi_center;
+    psi_h[a] = two_psi_center - psi_h[a];
+    psi_v[a] = two_psi_center - psi_v[a];
+    psi[a]   = psi_center;
+  }
+
+  // Keep the reduction out of the loop above so that loop vectorizes.
+  double phi = 0.0;
+  for (size_t a = 0; a < na; ++a)
+    phi += d_weights[a] * psi[a];
+  return phi;
+}
+
+//---------------------------------------------------------------------------//
+inline void Equation_DD_2D::solve_groups(const size_t  i,
+                                         const size_t  j,
+                                         const size_t  number_groups,
+                                         const double *sigma,
+                                         const double *source,
+                                         double       *psi_v,
+                                         double       *psi_h,
+                                         double       *phi,
+                                         double       *psi)
+{
+  // The coefficients and weight are shared by all groups.
+  const double cx = d_coef_x[i];
+  const double cy = d_coef_y[j];
+  const double w  = d_quadrature->weight(d_angle);
+
+  for (size_t g = 0; g < number_groups; ++g)
+  {
+    double coef = 1.0 / (sigma[g] + cx + cy);
+    double psi_center = coef * (source[g] + cx * psi_v[g] + cy * psi_h[g]);
+    double two_psi_center = 2.0 * psi_center;
+    psi_h[g] = two_psi_center - psi_h[g];
+    psi_v[g] = two_psi_center - psi_v[g];
+    phi[g]  += w * psi_center;
+    psi[g]   = psi_center;
+  }
+}
+
 } // end namespace detran
 
 #endif /* detran_EQUATION_DD_2D_I_HH_ */
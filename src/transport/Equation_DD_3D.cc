@@ -21,15 +21,35 @@ Equation_DD_3D::Equation_DD_3D(SP_mesh       mesh,
   ,  d_coef_x(mesh->number_cells_x())
   ,  d_coef_y(mesh->number_cells_y())
   ,  d_coef_z(mesh->number_cells_z())
+  ,  d_number_angles(quadrature->number_angles_octant())
+  ,  d_coef_x_angles(mesh->number_cells_x() * d_number_angles)
+  ,  d_coef_y_angles(mesh->number_cells_y() * d_number_angles)
+  ,  d_coef_z_angles(mesh->number_cells_z() * d_number_angles)
+  ,  d_weights(d_number_angles)
 {
-  /* ... */
+  // The coefficients depend only on |mu|, |eta|, and |xi|, so one table
+  // serves every octant of the angle-batched solve.
+  size_t na = d_number_angles;
+  for (size_t a = 0; a < na; ++a)
+  {
+    double mu  = d_quadrature->mu(0, a);
+    double eta = d_quadrature->eta(0, a);
+    double xi  = d_quadrature->xi(0, a);
+    for (size_t i = 0; i < d_mesh->number_cells_x(); ++i)
+      d_coef_x_angles[i * na + a] = 2.0 * mu / d_mesh->dx(i);
+    for (size_t j = 0; j < d_mesh->number_cells_y(); ++j)
+      d_coef_y_angles[j * na + a] = 2.0 * eta / d_mesh->dy(j);
+    for (size_t k = 0; k < d_mesh->number_cells_z(); ++k)
+      d_coef_z_angles[k * na + a] = 2.0 * xi / d_mesh->dz(k);
+    d_weights[a] = d_quadrature->weight(a);
+  }
 }
 
 //---------------------------------------------------------------------------//
 void Equation_DD_3D::setup_group(const size_t g)
 {
   Require(g < d_material->number_groups());
-  d_g = g;
+  set_group(g);
 }
 
 //---------------------------------------------------------------------------//
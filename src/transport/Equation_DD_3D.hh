@@ -73,6 +73,35 @@ public:
   /// Setup the equations for an angle.
   void setup_angle(const size_t angle);
 
+  //-------------------------------------------------------------------------//
+  // ANGLE-BATCHED INTERFACE
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Solve a cell for all angles of the current octant at once.
+   *
+   *  See Equation_DD_2D::solve_angles.  The incident face fluxes
+   *  are overwritten by the outgoing ones.
+   *
+   *  @param  i       x cell index
+   *  @param  j       y cell index
+   *  @param  k       z cell index
+   *  @param  source  sweep source for this cell, [angle]
+   *  @param  psi_yz  incident/outgoing yz face fluxes, [angle]
+   *  @param  psi_xz  incident/outgoing xz face fluxes, [angle]
+   *  @param  psi_xy  incident/outgoing xy face fluxes, [angle]
+   *  @param  psi     cell-center angular fluxes, [angle]
+   *  @return         weighted sum of the cell-center angular fluxes
+   */
+  inline double solve_angles(const size_t  i,
+                             const size_t  j,
+                             const size_t  k,
+                             const double *source,
+                             double       *psi_yz,
+                             double       *psi_xz,
+                             double       *psi_xy,
+                             double       *psi);
+
 
 private:
 
@@ -84,6 +113,21 @@ private:
 
   /// Z-directed coefficient, \f$ 2|\xi|/\Delta_z \f$.
   detran_utilities::vec_dbl d_coef_z;
+
+  /// Number of angles per octant
+  size_t d_number_angles;
+
+  /// X-directed coefficients for all angles, [i][angle]
+  detran_utilities::vec_dbl d_coef_x_angles;
+
+  /// Y-directed coefficients for all angles, [j][angle]
+  detran_utilities::vec_dbl d_coef_y_angles;
+
+  /// Z-directed coefficients for all angles, [k][angle]
+  detran_utilities::vec_dbl d_coef_z_angles;
+
+  /// Quadrature weights for all angles
+  detran_utilities::vec_dbl d_weights;
 };
 
 } // end namespace detran
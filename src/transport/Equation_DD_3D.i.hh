@@ -27,7 +27,7 @@ inline void Equation_DD_3D::solve(const size_t i,
 
   // Compute cell-center angular flux.
   int cell = d_mesh->index(i, j, k);
-  double coef = 1.0 / (d_material->sigma_t(d_mat_map[cell], d_g) +
+  double coef = 1.0 / (sigma_t(cell) +
                        d_coef_x[i] + d_coef_y[j] + d_coef_z[k]);
   double psi_center = coef * (source[cell] + d_coef_x[i] * psi_in[Mesh::YZ] +
                                              d_coef_y[j] * psi_in[Mesh::XZ] +
@@ -47,6 +47,45 @@ inline void Equation_DD_3D::solve(const size_t i,
 
 }
 
+//---------------------------------------------------------------------------//
+inline double Equation_DD_3D::solve_angles(const size_t  i,
+                                           const size_t  j,
+                                           const size_t  k,
+                                           const double *source,
+                                           double       *psi_yz,
+                                           double       *psi_xz,
+                                           double       *psi_xy,
+                                           double       *psi)
+{
+  const size_t na = d_number_angles;
+  const double *cx = &d_coef_x_angles[i * na];
+  const double *cy = &d_coef_y_angles[j * na];
+  const double *cz = &d_coef_z_angles[k * na];
+
+  // One material lookup serves all angles.
+  int cell = d_mesh->index(i, j, k);
+  const double sigma = sigma_t(cell);
+
+  for (size_t a = 0; a < na; ++a)
+  {
+    double coef = 1.0 / (sigma + cx[a] + cy[a] + cz[a]);
+    double psi_center = coef * (source[a] + cx[a] * psi_yz[a] +
+                                            cy[a] * psi_xz[a] +
+                                            cz[a] * psi_xy[a]);
+    double two_psi_center = 2.0 * psi_center;
+    psi_yz[a] = two_psi_center - psi_yz[a];
+    psi_xz[a] = two_psi_center - psi_xz[a];
+    psi_xy[a] = two_psi_center - psi_xy[a];
+    psi[a]    = psi_center;
+  }
+
+  // Keep the reduction out of the loop above so that loop vectorizes.
+  double phi = 0.0;
+  for (size_t a = 0; a < na; ++a)
+    phi += d_weights[a] * psi[a];
+  return phi;
+}
+
 } // end namespace detran
 
 #endif /* detran_EQUATION_DD_3D_I_HH_ */
@@ -12,6 +12,9 @@
 
 #include "transport/transport_export.hh"
 #include "DimensionTraits.hh"
+#include "transport/AngularFlux.hh"
+#include "transport/CellCrossSections.hh"
+#include "transport/ExpTable.hh"
 #include "angle/QuadratureMOC.hh"
 #include "material/Material.hh"
 #include "geometry/MeshMOC.hh"
@@ -43,8 +46,10 @@ public:
   typedef detran_geometry::MeshMOC::SP_mesh             SP_mesh;
   typedef detran_geometry::TrackDB::SP_trackdb          SP_trackdb;
   typedef detran_angle::QuadratureMOC::SP_quadrature    SP_quadrature;
+  typedef ExpTable::SP_exptable                         SP_exptable;
+  typedef CellCrossSections::SP_cellxs                  SP_cellxs;
   typedef detran_utilities::vec_dbl                     moments_type;
-  typedef detran_utilities::vec_dbl                     angular_flux_type;
+  typedef AngularFluxView                               angular_flux_type;
   typedef detran_utilities::size_t                      size_t;
 
   //-------------------------------------------------------------------------//
@@ -66,11 +71,12 @@ public:
     ,  d_g(-1)
     ,  d_octant(-1)
     ,  d_angle(-1)
+    ,  d_sigma_t(NULL)
   {
     Require(mesh);
     Require(material);
     Require(quadrature);
-    d_mat_map =  mesh->mesh_map("MATERIAL");
+    d_mat_map = mesh->material_map();
     //Ensure(d_mat_map);
   }
 
@@ -123,6 +129,24 @@ public:
    */
   virtual void setup_polar(const size_t p) = 0;
 
+  /**
+   *  @brief Use a table for the exponential functions.
+   *  @param t    Exponential table; if null, evaluate exactly.
+   */
+  void set_exp_table(SP_exptable t)
+  {
+    d_exp_table = t;
+  }
+
+  /**
+   *  @brief Use cell-wise cross sections, set before the group.
+   *  @param xs   Cell cross sections; if null, use the material map.
+   */
+  void set_cell_xs(SP_cellxs xs)
+  {
+    d_cell_xs = xs;
+  }
+
 protected:
 
   //-------------------------------------------------------------------------//
@@ -148,7 +172,7 @@ protected:
   /// Inverse of the polar sine
   double d_inv_sin;
   /// Material map
-  detran_utilities::vec_int d_mat_map;
+  detran_geometry::MeshMap d_mat_map;
   /// Update the angular flux?
   bool d_update_psi;
   /// Current group
@@ -161,6 +185,30 @@ protected:
   size_t d_azimuth;
   /// Current polar.
   size_t d_polar;
+  /// Optional exponential table
+  SP_exptable d_exp_table;
+  /// Optional cell cross sections
+  SP_cellxs d_cell_xs;
+  /// Total cross section by region for the current group, if available
+  const double *d_sigma_t;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Set the current group and its cell cross sections.
+  void set_group(const size_t g)
+  {
+    d_g = g;
+    d_sigma_t = d_cell_xs ? d_cell_xs->sigma_t(g) : NULL;
+  }
+
+  /// Total cross section of a region in the current group
+  double sigma_t(const size_t region) const
+  {
+    if (d_sigma_t) return d_sigma_t[region];
+    return d_material->sigma_t(d_mat_map[region], d_g);
+  }
 
 };
 
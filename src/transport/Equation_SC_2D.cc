@@ -29,7 +29,7 @@ void Equation_SC_2D::setup_group(const size_t g)
 {
   Require(g >= 0);
   Require(g < d_material->number_groups());
-  d_g = g;
+  set_group(g);
 }
 
 //---------------------------------------------------------------------------//
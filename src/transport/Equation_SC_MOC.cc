@@ -31,7 +31,7 @@ Equation_SC_MOC::Equation_SC_MOC(SP_mesh       mesh,
 void Equation_SC_MOC::setup_group(const size_t g)
 {
   Require(g < d_material->number_groups());
-  d_g = g;
+  set_group(g);
 }
 
 //---------------------------------------------------------------------------//
@@ -65,6 +65,9 @@ public:
 
   typedef Equation_MOC                      Base;
 
+  /// Number of coefficients per segment, i.e. A, B, and C
+  static const int number_coefficients = 3;
+
   //-------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
   //-------------------------------------------------------------------------//
@@ -89,6 +92,33 @@ public:
                     angular_flux_type &psi);
 
 
+  /**
+   *  @brief Solve using given coefficients for the segment.
+   *
+   *  The coefficients (A, B, C) are those of coefficients() for this
+   *  segment and the current polar angle, e.g. taken from a cache.
+   */
+  inline void solve(const size_t region,
+                    const double length,
+                    const double *coefs,
+                    moments_type &source,
+                    double &psi_in,
+                    double &psi_out,
+                    moments_type &phi,
+                    angular_flux_type &psi);
+
+  /**
+   *  @brief Compute the coefficients (A, B, C) of a segment.
+   *  @param region   Flat source region
+   *  @param length   Segment length
+   *  @param polar    Polar index
+   *  @param coefs    The number_coefficients coefficients
+   */
+  inline void coefficients(const size_t  region,
+                           const double  length,
+                           const size_t  polar,
+                           double       *coefs) const;
+
   /// Setup the equations for a group.
   void setup_group(const size_t g);
 
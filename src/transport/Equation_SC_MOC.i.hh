@@ -15,9 +15,57 @@
 namespace detran
 {
 
+//---------------------------------------------------------------------------//
+inline void Equation_SC_MOC::coefficients(const size_t  region,
+                                          const double  length,
+                                          const size_t  polar,
+                                          double       *coefs) const
+{
+  Require(region < d_mesh->number_cells());
+  Require(polar < d_inv_sin.size());
+
+  double sigma = sigma_t(region);
+  double length_over_sin = length * d_inv_sin[polar];
+
+  // Coefficients from Hebert.
+  if (d_exp_table)
+  {
+    // Tabulated in terms of F1 = (1-A)/tau and F2 = (1-F1)/tau.
+    double tau = sigma * length_over_sin;
+    double F1, F2;
+    d_exp_table->evaluate(tau, F1, F2);
+    coefs[0] = 1.0 - tau * F1;
+    coefs[1] = length_over_sin * F1;
+    coefs[2] = length_over_sin * length_over_sin * F2;
+  }
+  else
+  {
+    double A = std::exp(-sigma * length_over_sin);
+    double B = (1.0 - A) / sigma;
+    coefs[0] = A;
+    coefs[1] = B;
+    coefs[2] = (length_over_sin / sigma) * (1.0 - B / length_over_sin);
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline void Equation_SC_MOC::solve(const size_t region,
+                                   const double length,
+                                   moments_type &source,
+                                   double &psi_in,
+                                   double &psi_out,
+                                   moments_type &phi,
+                                   angular_flux_type &psi)
+{
+  double coefs[number_coefficients];
+  coefficients(region, length, d_polar, coefs);
+  solve(region, length, coefs, source, psi_in, psi_out, phi, psi);
+}
+
 //---------------------------------------------------------------------------//
 inline void Equation_SC_MOC::solve(const size_t region,
                                    const double length,
+                                   const double *coefs,
                                    moments_type &source,
                                    double &psi_in,
                                    double &psi_out,
@@ -30,15 +78,12 @@ inline void Equation_SC_MOC::solve(const size_t region,
   // Preconditions.
   Require(region < d_mesh->number_cells());
 
-  double sigma = d_material->sigma_t(d_mat_map[region], d_g);
   double length_over_sin = length * d_inv_sin[d_polar];
   double inv_volume = 1.0 / d_mesh->volume(region);
 
-  // Coefficients from Hebert.
-  double A = std::exp(-sigma * length_over_sin);
-  double B = (1.0 - A) / sigma;
-  double C = (length_over_sin / sigma) * (1.0 - B / length_over_sin);
-  //double C = (length_over_sin / sigma) * (1.0 - (1.0-A)/(length_over_sin*sigma));
+  const double A = coefs[0];
+  const double B = coefs[1];
+  const double C = coefs[2];
 
   // Segment outgoing angular flux.
   psi_out = A * psi_in + B * source[region];
@@ -27,7 +27,7 @@ Equation_SD_1D::Equation_SD_1D(SP_mesh mesh,
 void Equation_SD_1D::setup_group(const size_t g)
 {
   Require(g < d_material->number_groups());
-  d_g = g;
+  set_group(g);
 }
 
 //---------------------------------------------------------------------------//
@@ -45,7 +45,7 @@ inline void Equation_SD_1D::solve(const size_t i,
   // Compute cell-center angular flux.
   int cell = d_mesh->index(i);
   double coef = 1.0 /
-                (d_material->sigma_t(d_mat_map[cell], d_g) + d_coef_x[i]);
+                (sigma_t(cell) + d_coef_x[i]);
   double psi_center = coef * (source[cell] + d_coef_x[i] * psi_in);
 
   // Compute outgoing fluxes.
@@ -0,0 +1,71 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   ExpTable.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  ExpTable member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#include "ExpTable.hh"
+#include <algorithm>
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+const double ExpTable::MINIMUM_TOLERANCE = 1.0e-10;
+
+//---------------------------------------------------------------------------//
+ExpTable::ExpTable(const double tolerance, const double tau_max)
+  : d_tau_max(tau_max)
+{
+  Insist(tolerance >= MINIMUM_TOLERANCE,
+         "The exponential table tolerance is below its minimum.");
+  Insist(tau_max > 0.0, "The exponential table range must be positive.");
+
+  // Linear interpolation errs by at most h^2/8 times the largest second
+  // derivative on an interval.  That is 1/3 for F1 and 1/12 for F2.  The
+  // error in A = 1 - tau F1 is tau times that of F1, and tau |F1''| is
+  // at most 0.17, plus h/3 for the interval's offset from tau.  The
+  // spacing is set by the largest of these.
+  double d2_max = std::max(1.0 / 3.0, 1.0 / 12.0);
+  double h = std::sqrt(8.0 * tolerance / d2_max);
+  d2_max = std::max(d2_max, 0.17 + h / 3.0);
+  h = std::sqrt(8.0 * tolerance / d2_max);
+  d_number_intervals = std::max(1, int(std::ceil(d_tau_max / h)));
+  h = d_tau_max / d_number_intervals;
+  d_inv_h = 1.0 / h;
+
+  // Interpolate between the exact values at the interval ends.
+  d_table.resize(4 * d_number_intervals, 0.0);
+  double f1_l, f2_l, f1_r, f2_r;
+  exact(0.0, f1_l, f2_l);
+  for (size_t i = 0; i < d_number_intervals; ++i)
+  {
+    double tau_l = i * h;
+    exact(tau_l + h, f1_r, f2_r);
+    double b1 = (f1_r - f1_l) * d_inv_h;
+    double b2 = (f2_r - f2_l) * d_inv_h;
+    d_table[4 * i    ] = f1_l - b1 * tau_l;
+    d_table[4 * i + 1] = b1;
+    d_table[4 * i + 2] = f2_l - b2 * tau_l;
+    d_table[4 * i + 3] = b2;
+    f1_l = f1_r;
+    f2_l = f2_r;
+  }
+}
+
+//---------------------------------------------------------------------------//
+ExpTable::SP_exptable
+ExpTable::Create(const double tolerance, const double tau_max)
+{
+  SP_exptable p(new ExpTable(tolerance, tau_max));
+  return p;
+}
+
+} // end namespace detran
+
+//---------------------------------------------------------------------------//
+//              end of ExpTable.cc
+//---------------------------------------------------------------------------//
@@ -0,0 +1,136 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   ExpTable.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  ExpTable class definition.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_EXPTABLE_HH_
+#define detran_EXPTABLE_HH_
+
+#include "transport/transport_export.hh"
+#include "utilities/Definitions.hh"
+#include "utilities/DBC.hh"
+#include "utilities/SP.hh"
+#include <cmath>
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+/**
+ *  @class ExpTable
+ *  @brief Tabulated exponential functions of optical path length for MOC.
+ *
+ *  The step characteristic coefficients can be written in terms of
+ *  @f[
+ *      F_1(\tau) = \frac{1 - e^{-\tau}}{\tau} \, ,
+ *      \qquad
+ *      F_2(\tau) = \frac{\tau - 1 + e^{-\tau}}{\tau^2} \, ,
+ *  @f]
+ *  both of which are smooth and bounded, with \f$ F_1(0) = 1 \f$ and
+ *  \f$ F_2(0) = 1/2 \f$.  Unlike \f$ e^{-\tau} \f$ itself, they
+ *  involve no cancellation for thin segments, so a table of them keeps
+ *  its accuracy for all path lengths.
+ *
+ *  Both are tabulated on a uniform grid over \f$ [0, \tau_{max}] \f$
+ *  and linearly interpolated.  Since \f$ |F_1''| \le 1/3 \f$ and
+ *  \f$ |F_2''| \le 1/12 \f$, a spacing of \f$ h = \sqrt{24\epsilon} \f$
+ *  keeps the absolute error of both below \f$ \epsilon \f$.  Callers
+ *  use \f$ A = e^{-\tau} = 1 - \tau F_1 \f$, whose error is
+ *  \f$ \tau \f$ times that of \f$ F_1 \f$.  It does not grow with
+ *  \f$ \tau \f$, because \f$ \tau |F_1''(\tau)| \le 0.17 \f$, and
+ *  the spacing is reduced where needed so that it too stays below
+ *  \f$ \epsilon \f$.  The coefficients \f$ \ell F_1 \f$ and
+ *  \f$ \ell^2 F_2 \f$ carry the error of the functions times
+ *  \f$ \ell \f$ and \f$ \ell^2 \f$.  Beyond \f$ \tau_{max} \f$, the
+ *  functions are evaluated exactly.
+ *
+ *  The number of intervals grows as \f$ \epsilon^{-1/2} \f$, so the
+ *  tolerance may not fall below MINIMUM_TOLERANCE.  At that floor, a
+ *  table over \f$ [0, 10] \f$ has about 250000 intervals (8 MB).
+ */
+//---------------------------------------------------------------------------//
+
+class TRANSPORT_EXPORT ExpTable
+{
+
+public:
+
+  //-------------------------------------------------------------------------//
+  // TYPEDEFS
+  //-------------------------------------------------------------------------//
+
+  typedef detran_utilities::SP<ExpTable>    SP_exptable;
+  typedef detran_utilities::vec_dbl         vec_dbl;
+  typedef detran_utilities::size_t          size_t;
+
+  /// Smallest allowed tolerance, which bounds the table size
+  static const double MINIMUM_TOLERANCE;
+
+  //-------------------------------------------------------------------------//
+  // CONSTRUCTOR & DESTRUCTOR
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Constructor
+   *  @param tolerance  Maximum absolute error of the interpolation, at
+   *                    least MINIMUM_TOLERANCE
+   *  @param tau_max    Largest tabulated optical path length
+   */
+  ExpTable(const double tolerance = 1.0e-6, const double tau_max = 10.0);
+
+  /// SP constructor
+  static SP_exptable Create(const double tolerance = 1.0e-6,
+                            const double tau_max = 10.0);
+
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Interpolate both functions for a path length.
+   *  @param tau  Optical path length
+   *  @param f1   \f$ F_1(\tau) \f$
+   *  @param f2   \f$ F_2(\tau) \f$
+   */
+  inline void evaluate(const double tau, double &f1, double &f2) const;
+
+  /// Evaluate both functions exactly.
+  static inline void exact(const double tau, double &f1, double &f2);
+
+  /// Number of tabulated intervals
+  size_t size() const { return d_number_intervals; }
+
+private:
+
+  //-------------------------------------------------------------------------//
+  // DATA
+  //-------------------------------------------------------------------------//
+
+  /// Largest tabulated path length
+  double d_tau_max;
+  /// Inverse of the grid spacing
+  double d_inv_h;
+  /// Number of intervals
+  size_t d_number_intervals;
+  /// Intercepts and slopes of both functions, [interval][4]
+  vec_dbl d_table;
+
+};
+
+} // end namespace detran
+
+//---------------------------------------------------------------------------//
+// INLINE MEMBER DEFINITIONS
+//---------------------------------------------------------------------------//
+
+#include "ExpTable.i.hh"
+
+#endif /* detran_EXPTABLE_HH_ */
+
+//---------------------------------------------------------------------------//
+//              end of ExpTable.hh
+//---------------------------------------------------------------------------//
@@ -0,0 +1,58 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   ExpTable.i.hh
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  ExpTable inline member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_EXPTABLE_I_HH_
+#define detran_EXPTABLE_I_HH_
+
+#include <algorithm>
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+inline void ExpTable::evaluate(const double tau, double &f1, double &f2) const
+{
+  Require(tau >= 0.0);
+  if (tau >= d_tau_max)
+  {
+    exact(tau, f1, f2);
+    return;
+  }
+  // Each interval holds (a1, b1, a2, b2), with F_i ~ a_i + b_i * tau.
+  size_t i = std::min(size_t(tau * d_inv_h), d_number_intervals - 1);
+  const double *t = &d_table[4 * i];
+  f1 = t[0] + t[1] * tau;
+  f2 = t[2] + t[3] * tau;
+}
+
+//---------------------------------------------------------------------------//
+inline void ExpTable::exact(const double tau, double &f1, double &f2)
+{
+  // Use the series for thin segments to avoid cancellation.
+  if (tau < 1.0e-2)
+  {
+    f1 = 1.0 - tau * (1.0/2.0 - tau * (1.0/6.0 - tau * (1.0/24.0 -
+               tau * (1.0/120.0 - tau / 720.0))));
+    f2 = 1.0/2.0 - tau * (1.0/6.0 - tau * (1.0/24.0 - tau * (1.0/120.0 -
+                   tau * (1.0/720.0 - tau / 5040.0))));
+    return;
+  }
+  double inv_tau = 1.0 / tau;
+  double one_minus_exp = 1.0 - std::exp(-tau);
+  f1 = one_minus_exp * inv_tau;
+  f2 = (1.0 - f1) * inv_tau;
+}
+
+} // end namespace detran
+
+#endif /* detran_EXPTABLE_I_HH_ */
+
+//---------------------------------------------------------------------------//
+//              end of ExpTable.i.hh
+//---------------------------------------------------------------------------//
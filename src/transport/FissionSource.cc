@@ -22,6 +22,7 @@ FissionSource::FissionSource(SP_state state,
   , d_mesh(mesh)
   , d_material(material)
   , d_scale(1.0)
+  , d_blocks_revision(0)
 {
   // Preconditions
   Require(d_state);
@@ -32,6 +33,10 @@ FissionSource::FissionSource(SP_state state,
   d_density.assign(d_mesh->number_cells(), 0.0);
   d_source.resize(d_material->number_groups(),
                   moments_type(mesh->number_cells(), 0.0));
+  d_mat_map = d_mesh->material_map();
+  d_group_phi.assign(d_number_groups, NULL);
+  d_cell_nu_sigma_f.assign(d_number_groups, NULL);
+  d_cell_chi.assign(d_number_groups, NULL);
 }
 
 //---------------------------------------------------------------------------//
@@ -51,21 +56,51 @@ void FissionSource::initialize()
    *  nu * fission cross section.  Normalized
    *  using the L1 norm.
    */
-  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
-  int ng = d_material->number_groups();
-  for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
+  setup_pass();
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    d_density[cell] = 0.0;
-    for (int g = 0; g < ng; g++)
-    {
-      d_density[cell] += d_material->nu_sigma_f(mat_map[cell], g);
-    }
+    const int m = d_mat_map[cell];
+    double f = 0.0;
+    for (size_t g = 0; g < d_number_groups; ++g)
+      f += nu_sigma_f(cell, m, g);
+    d_density[cell] = f;
   }
   double norm_density = detran_utilities::norm(d_density, "L1");
   Require(norm_density > 0.0);
   detran_utilities::vec_scale(d_density, 1.0/norm_density);
 }
 
+//---------------------------------------------------------------------------//
+void FissionSource::setup_pass()
+{
+  // Copy the fission data of each material into its block.
+  if (d_nu_sigma_f.empty() || d_blocks_revision != d_material->revision())
+  {
+    const size_t nm = d_material->number_materials();
+    d_nu_sigma_f.resize(nm * d_number_groups);
+    d_chi.resize(nm * d_number_groups);
+    for (size_t m = 0; m < nm; ++m)
+    {
+      for (size_t g = 0; g < d_number_groups; ++g)
+      {
+        d_nu_sigma_f[m * d_number_groups + g] = d_material->nu_sigma_f(m, g);
+        d_chi[m * d_number_groups + g]        = d_material->chi(m, g);
+      }
+    }
+    d_blocks_revision = d_material->revision();
+  }
+
+  // Updating the cell cross sections is not thread safe.
+  if (d_cell_xs) d_cell_xs->update();
+  for (size_t g = 0; g < d_number_groups; ++g)
+  {
+    d_cell_nu_sigma_f[g] = d_cell_xs ? d_cell_xs->nu_sigma_f(g) : NULL;
+    d_cell_chi[g]        = d_cell_xs ? d_cell_xs->chi(g) : NULL;
+  }
+}
+
 } // end namespace detran
 
 //---------------------------------------------------------------------------//
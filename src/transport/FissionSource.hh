@@ -11,6 +11,7 @@
 #define detran_FISSIONSOURCE_HH_
 
 #include "transport/transport_export.hh"
+#include "transport/CellCrossSections.hh"
 #include "transport/State.hh"
 #include "geometry/Mesh.hh"
 #include "material/Material.hh"
@@ -24,6 +25,13 @@ namespace detran
 /**
  *  @class FissionSource
  *  @brief Defines the isotropic source from fission reactions.
+ *
+ *  The fission cross section and spectrum of each material are copied
+ *  into contiguous blocks, rebuilt whenever the material revision
+ *  changes, and the material map is resolved once at construction.
+ *  Every update is then a single threaded pass over the cells that
+ *  sums all groups in each cell, without copying the map or fluxes
+ *  and without allocating.
  */
 class TRANSPORT_EXPORT FissionSource
 {
@@ -38,7 +46,9 @@ public:
   typedef State::SP_state                           SP_state;
   typedef detran_geometry::Mesh::SP_mesh            SP_mesh;
   typedef detran_material::Material::SP_material    SP_material;
+  typedef CellCrossSections::SP_cellxs              SP_cellxs;
   typedef detran_utilities::vec_int                 vec_int;
+  typedef detran_utilities::vec_dbl                 vec_dbl;
   typedef detran_utilities::size_t                  size_t;
   typedef State::moments_type                       moments_type;
   typedef State::vec_moments_type                   vec_moments_type;
@@ -74,6 +84,17 @@ public:
   /// Update the fission density.
   void update();
 
+  /**
+   *   @brief Update the fission density and set up the group sources.
+   *
+   *   This is equivalent to update() followed by setup_outer(scale), but
+   *   produces the density and all group sources in one pass over the
+   *   cells.
+   *
+   *   @param scale     Scaling factor (typically 1/keff)
+   */
+  void update(const double scale);
+
   /**
    *   @brief Setup the fission source for an outer iteration.
    *
@@ -126,6 +147,20 @@ public:
     d_density = f;
   }
 
+  /**
+   *   @brief Exchange the fission density with another vector.
+   *
+   *   This lets a client keep the previous density, or fill the next
+   *   one, without a copy.
+   *
+   *   @param   f   Density to install; on return, the previous density.
+   */
+  void swap_density(moments_type& f)
+  {
+    Require(f.size() == d_density.size());
+    d_density.swap(f);
+  }
+
   /// Methods to treat fission like scatter
 
   /**
@@ -183,6 +218,15 @@ public:
   /// Get the state
   SP_state state() {return d_state;}
 
+  /**
+   *  @brief Use cell-wise cross sections.
+   *  @param xs   Cell cross sections; if null, use the material map.
+   */
+  void set_cell_xs(SP_cellxs xs)
+  {
+    d_cell_xs = xs;
+  }
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -203,6 +247,47 @@ private:
   double d_scale;
   /// Number of groups.
   size_t d_number_groups;
+  /// Optional cell cross sections
+  SP_cellxs d_cell_xs;
+  /// Material map
+  detran_geometry::MeshMap d_mat_map;
+  /// nu * fission cross section of each material, [material][group]
+  vec_dbl d_nu_sigma_f;
+  /// Fission spectrum of each material, [material][group]
+  vec_dbl d_chi;
+  /// Material revision of the blocks
+  size_t d_blocks_revision;
+  /// Group fluxes of the current pass
+  std::vector<const double*> d_group_phi;
+  /// Cell nu * fission cross sections of each group, or NULL if unavailable
+  std::vector<const double*> d_cell_nu_sigma_f;
+  /// Cell fission spectra of each group, or NULL if unavailable
+  std::vector<const double*> d_cell_chi;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Rebuild the material blocks if the material has changed, and get
+  /// the cell cross sections, if any, outside of the parallel region.
+  void setup_pass();
+
+  /// Point the group fluxes at the state.
+  void set_group_phi();
+
+  /// nu * fission cross section of a cell in a group
+  double nu_sigma_f(const int cell, const int m, const size_t g) const
+  {
+    const double *v = d_cell_nu_sigma_f[g];
+    return v ? v[cell] : d_nu_sigma_f[m * d_number_groups + g];
+  }
+
+  /// Fission spectrum of a cell in a group
+  double chi(const int cell, const int m, const size_t g) const
+  {
+    const double *v = d_cell_chi[g];
+    return v ? v[cell] : d_chi[m * d_number_groups + g];
+  }
 
 };
 
@@ -17,31 +17,55 @@ namespace detran
 inline void FissionSource::setup_outer(const double scale)
 {
   d_scale = scale;
-  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
-  for (size_t g = 0; g < d_material->number_groups(); ++g)
+  setup_pass();
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      d_source[g][cell] = d_scale * d_density[cell] *
-                          d_material->chi(mat_map[cell], g);
-    }
+    const int m = d_mat_map[cell];
+    const double f = d_scale * d_density[cell];
+    for (size_t g = 0; g < d_number_groups; ++g)
+      d_source[g][cell] = f * chi(cell, m, g);
   }
 }
 
-
 //---------------------------------------------------------------------------//
 inline void FissionSource::update()
 {
-  d_density.assign(d_density.size(), 0.0);
-  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
-  for(size_t g = 0; g < d_number_groups; g++)
+  setup_pass();
+  set_group_phi();
+  const double *const *phi = &d_group_phi[0];
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    State::moments_type phi = d_state->phi(g);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); cell++)
-    {
-      d_density[cell] += phi[cell] *
-                         d_material->nu_sigma_f(mat_map[cell], g);
-    }
+    const int m = d_mat_map[cell];
+    double f = 0.0;
+    for (size_t g = 0; g < d_number_groups; ++g)
+      f += phi[g][cell] * nu_sigma_f(cell, m, g);
+    d_density[cell] = f;
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline void FissionSource::update(const double scale)
+{
+  d_scale = scale;
+  setup_pass();
+  set_group_phi();
+  const double *const *phi = &d_group_phi[0];
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
+  {
+    const int m = d_mat_map[cell];
+    double f = 0.0;
+    for (size_t g = 0; g < d_number_groups; ++g)
+      f += phi[g][cell] * nu_sigma_f(cell, m, g);
+    d_density[cell] = f;
+    f *= d_scale;
+    for (size_t g = 0; g < d_number_groups; ++g)
+      d_source[g][cell] = f * chi(cell, m, g);
   }
 }
 
@@ -49,12 +73,6 @@ inline void FissionSource::update()
 inline const State::moments_type& FissionSource::source(const size_t g)
 {
   Require(g < d_number_groups);
-//  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
-//  for (int cell = 0; cell < d_mesh->number_cells(); cell++)
-//  {
-//    d_source[cell] = d_scale * d_density[cell] *
-//                     d_material->chi(mat_map[cell], g);
-//  }
   return d_source[g];
 }
 
@@ -73,12 +91,14 @@ build_within_group_source(const size_t g,
   Require(g < d_material->number_groups());
   Require(phi.size() == source.size());
 
-  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
-  for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
+  setup_pass();
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
+    const int m = d_mat_map[cell];
     source[cell] += phi[cell] * d_scale *
-                    d_material->chi(mat_map[cell], g) *
-                    d_material->nu_sigma_f(mat_map[cell], g);
+                    chi(cell, m, g) * nu_sigma_f(cell, m, g);
   }
 }
 
@@ -89,19 +109,19 @@ build_in_fission_source(const size_t g,
 {
   Require(g < d_material->number_groups());
 
-  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
-  for (size_t gp = 0; gp < d_material->number_groups(); ++gp)
+  setup_pass();
+  set_group_phi();
+  const double *const *phi = &d_group_phi[0];
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    if (gp == g) continue;
-    const moments_type &phi = d_state->phi(gp);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      source[cell] += phi[cell] * d_scale *
-                      d_material->chi(mat_map[cell], g) *
-                      d_material->nu_sigma_f(mat_map[cell], gp);
-    }
+    const int m = d_mat_map[cell];
+    double f = 0.0;
+    for (size_t gp = 0; gp < d_number_groups; ++gp)
+      if (gp != g) f += phi[gp][cell] * nu_sigma_f(cell, m, gp);
+    source[cell] += f * d_scale * chi(cell, m, g);
   }
-
 }
 
 //---------------------------------------------------------------------------//
@@ -111,19 +131,28 @@ build_total_group_source(const size_t g,
                          State::moments_type &source)
 {
   Require(g < d_material->number_groups());
+  Require(phi.size() == d_number_groups);
 
-  vec_int mat_map = d_mesh->mesh_map("MATERIAL");
-  for (size_t gp = 0; gp < d_material->number_groups(); ++gp)
+  setup_pass();
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      source[cell] += phi[gp][cell] * d_scale *
-                      d_material->chi(mat_map[cell], g) *
-                      d_material->nu_sigma_f(mat_map[cell], gp);
-    }
+    const int m = d_mat_map[cell];
+    double f = 0.0;
+    for (size_t gp = 0; gp < d_number_groups; ++gp)
+      f += phi[gp][cell] * nu_sigma_f(cell, m, gp);
+    source[cell] += f * d_scale * chi(cell, m, g);
   }
 }
 
+//---------------------------------------------------------------------------//
+inline void FissionSource::set_group_phi()
+{
+  for (size_t g = 0; g < d_number_groups; ++g)
+    d_group_phi[g] = &d_state->phi(g)[0];
+}
+
 } // namespace detran
 
 #endif /* detran_FISSIONSOURCE_I_HH_ */
@@ -27,12 +27,14 @@ Homogenize::homogenize(SP_state     state,
                        SP_mesh      mesh,
                        std::string  key,
                        vec_int      coarsegroup,
-                       size_t       dc_weight)
+                       size_t       dc_weight,
+                       size_t       chi_weight)
 {
   Require(state);
   Require(mesh);
   Require(detran_utilities::vec_sum(coarsegroup) == d_number_groups);
   Require(dc_weight < END_DIFF_COEF_WEIGHTING);
+  Require(chi_weight < END_CHI_WEIGHTING);
 
   using detran_material::Material;
 
@@ -45,7 +47,7 @@ Homogenize::homogenize(SP_state     state,
 
   // Coarse mesh maps
   const vec_int &mesh_map = mesh->mesh_map(key);
-  const vec_int &mat_map  = mesh->mesh_map("MATERIAL");
+  detran_geometry::MeshMap mat_map = mesh->material_map();
 
   // Maximum number of unique coarse cells, i.e. materials
   size_t number_coarse_cells = detran_utilities::vec_max(mesh_map) + 1;
@@ -57,6 +59,29 @@ Homogenize::homogenize(SP_state     state,
   SP_material cmat =
     Material::Create(number_coarse_cells, number_coarse_groups);
 
+  // Spectrum weights, i.e. the volume or the fission density.  Coarse
+  // cells without fission fall back to the volume.
+  vec_dbl spectrum_weight(mesh->number_cells(), 0.0);
+  vec_dbl spectrum_norm(number_coarse_cells, 0.0);
+  if (chi_weight == FISSION_CHI)
+  {
+    for (size_t fi = 0; fi < mesh->number_cells(); ++fi)
+    {
+      size_t m = mat_map[fi];
+      for (size_t g = 0; g < d_number_groups; ++g)
+        spectrum_weight[fi] +=
+          state->phi(g)[fi] * d_material->nu_sigma_f(m, g);
+      spectrum_weight[fi] *= mesh->volume(fi);
+      spectrum_norm[mesh_map[fi]] += spectrum_weight[fi];
+    }
+  }
+  for (size_t fi = 0; fi < mesh->number_cells(); ++fi)
+    if (chi_weight == VOLUME_CHI || spectrum_norm[mesh_map[fi]] <= 0.0)
+      spectrum_weight[fi] = mesh->volume(fi);
+  spectrum_norm.assign(number_coarse_cells, 0.0);
+  for (size_t fi = 0; fi < mesh->number_cells(); ++fi)
+    spectrum_norm[mesh_map[fi]] += spectrum_weight[fi];
+
   // Condense
   fg = 0;
   for (size_t cg = 0; cg < number_coarse_groups; ++cg)
@@ -94,7 +119,7 @@ Homogenize::homogenize(SP_state     state,
         sigma_a[ci]    += pv * d_material->sigma_a(m, fg);
         sigma_f[ci]    += pv * d_material->sigma_f(m, fg);
         nu_sigma_f[ci] += pv * d_material->nu_sigma_f(m, fg);
-        chi[ci]        += mesh->volume(fi) * d_material->chi(m, fg);
+        chi[ci]        += spectrum_weight[fi] * d_material->chi(m, fg);
         for (size_t gp = 0; gp < d_number_groups; ++gp)
           sigma_s[ci][fg_to_cg[gp]] += pv * d_material->sigma_s(m, gp, fg);
         if (dc_weight == PHI_D || dc_weight == CURRENT_D)
@@ -116,7 +141,7 @@ Homogenize::homogenize(SP_state     state,
           cmat->set_nu_sigma_f(ci, cg, nu_sigma_f[ci]/phi_vol[ci]);
           cmat->set_nu(ci, cg, nu_sigma_f[ci]/sigma_f[ci]);
         }
-        cmat->set_chi(ci, cg, chi[ci]/vol[ci]);
+        cmat->set_chi(ci, cg, chi[ci]/spectrum_norm[ci]);
         for (size_t cgp = 0; cgp < number_coarse_groups; ++cgp)
           cmat->set_sigma_s(ci, cgp, cg, sigma_s[ci][cgp]/phi_vol[ci]);
         if (dc_weight == PHI_D || dc_weight == CURRENT_D)
@@ -148,10 +173,11 @@ Homogenize::SP_material
 Homogenize::homogenize(SP_state     state,
                        SP_mesh      mesh,
                        std::string  key,
-                       size_t       dc_weight)
+                       size_t       dc_weight,
+                       size_t       chi_weight)
 {
   vec_int coarsegroup(d_number_groups, 1);
-  return homogenize(state, mesh, key, coarsegroup, dc_weight);
+  return homogenize(state, mesh, key, coarsegroup, dc_weight, chi_weight);
 }
 
 //---------------------------------------------------------------------------//
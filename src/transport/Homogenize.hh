@@ -24,7 +24,10 @@ namespace detran
  *  @class Homogenize
  *  @brief Condenses materials on a coarser space and/or energy mesh
  *
- *  Homogenization is based on flux or current weighting.
+ *  Homogenization is based on flux or current weighting.  The fission
+ *  spectrum is volume weighted by default.  Weighting it by the fission
+ *  density instead (FISSION_CHI) makes the coarse fission source
+ *  preserve the fine one, as needed by coarse mesh acceleration.
  */
 class TRANSPORT_EXPORT Homogenize
 {
@@ -43,6 +46,13 @@ public:
     END_DIFF_COEF_WEIGHTING
   };
 
+  enum chi_weighting
+  {
+    VOLUME_CHI,    // volume-weighted fission spectrum
+    FISSION_CHI,   // fission density-weighted fission spectrum
+    END_CHI_WEIGHTING
+  };
+
   //-------------------------------------------------------------------------//
   // TYPEDEFS
   //-------------------------------------------------------------------------//
@@ -72,12 +82,14 @@ public:
    *  @param key            Coarse mesh map key
    *  @param coarsegroup    Vector of fine groups per coarse group
    *  @param dc_weight      Selects weighting scheme for diffusion coefficient
+   *  @param chi_weight     Selects weighting scheme for fission spectrum
    */
   SP_material homogenize(SP_state state,
                          SP_mesh mesh,
                          std::string key,
                          vec_int coarsegroup,
-                         size_t dc_weight = 0);
+                         size_t dc_weight = 0,
+                         size_t chi_weight = VOLUME_CHI);
 
   /**
    *  @brief Homogenize the material on a coarser space mesh.
@@ -85,11 +97,13 @@ public:
    *  @param mesh           Fine mesh with appropriate coarse mesh map
    *  @param key            Coarse mesh map key
    *  @param dc_weight      Selects weighting scheme for diffusion coefficient
+   *  @param chi_weight     Selects weighting scheme for fission spectrum
    */
   SP_material homogenize(SP_state state,
                          SP_mesh mesh,
                          std::string key,
-                         size_t dc_weight = 0);
+                         size_t dc_weight = 0,
+                         size_t chi_weight = VOLUME_CHI);
 
 private:
 
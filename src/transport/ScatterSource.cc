@@ -8,6 +8,7 @@
 //---------------------------------------------------------------------------//
 
 #include "ScatterSource.hh"
+#include <algorithm>
 
 namespace detran
 {
@@ -19,6 +20,7 @@ ScatterSource::ScatterSource(SP_mesh     mesh,
   :  d_mesh(mesh)
   ,  d_material(material)
   ,  d_state(state)
+  ,  d_blocks_revision(0)
 {
   // Preconditions
   Require(d_mesh);
@@ -26,7 +28,103 @@ ScatterSource::ScatterSource(SP_mesh     mesh,
   Require(d_state);
 
   // \todo Add a check function to mesh like input has.
-  d_mat_map = d_mesh->mesh_map("MATERIAL");
+  d_mat_map = d_mesh->material_map();
+}
+
+//---------------------------------------------------------------------------//
+void ScatterSource::
+build_total_group_sources(const size_t                   g_cutoff,
+                          const State::vec_moments_type &phi,
+                          State::vec_moments_type       &source)
+{
+  const int ng = d_material->number_groups();
+  Require(g_cutoff <= ng);
+  Require(phi.size() == ng);
+  Require(source.size() == ng);
+  update_blocks();
+
+  // Band of incident groups within the active set for each group.
+  const int number_active = ng - g_cutoff;
+  vec_int gp_begin(ng, 0), number_terms(ng, 0), index(ng, 0);
+  for (int g = g_cutoff; g < ng; ++g)
+  {
+    int lower = d_material->lower(g);
+    gp_begin[g] = std::max(int(g_cutoff), lower);
+    number_terms[g] = d_material->upper(g) + 1 - gp_begin[g];
+    index[g] = d_blocks_offset[g] + gp_begin[g] - lower;
+  }
+
+  const int  number_cells = d_mesh->number_cells();
+  const int  block_size   = d_blocks_offset.back();
+  const int  tile_size    = 64;
+  const int  number_tiles = (number_cells + tile_size - 1) / tile_size;
+
+  #pragma omp parallel default(shared)
+  {
+    // Cell-major view of the active group fluxes for a tile of cells.
+    vec_dbl phi_tile(tile_size * number_active, 0.0);
+
+    #pragma omp for
+    for (int tile = 0; tile < number_tiles; ++tile)
+    {
+      const int c0 = tile * tile_size;
+      const int nc = std::min(tile_size, number_cells - c0);
+
+      // Gather the tile's fluxes, one contiguous run per group.
+      for (int gp = g_cutoff; gp < ng; ++gp)
+      {
+        const double *phi_gp = &phi[gp][c0];
+        for (int c = 0; c < nc; ++c)
+          phi_tile[c * number_active + gp - g_cutoff] = phi_gp[c];
+      }
+
+      // Each group's source is a short dot product per cell.
+      for (int g = g_cutoff; g < ng; ++g)
+      {
+        double *source_g = &source[g][c0];
+        for (int c = 0; c < nc; ++c)
+        {
+          const double *sigma_s =
+            &d_blocks[d_mat_map[c0 + c] * block_size + index[g]];
+          const double *phi_c =
+            &phi_tile[c * number_active + gp_begin[g] - g_cutoff];
+          double q = 0.0;
+          for (int t = 0; t < number_terms[g]; ++t)
+            q += sigma_s[t] * phi_c[t];
+          source_g[c] += q;
+        }
+      }
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+void ScatterSource::setup_blocks()
+{
+  // Offsets of each group's band within the block of a material.
+  const size_t ng = d_material->number_groups();
+  const size_t nm = d_material->number_materials();
+  d_blocks_offset.assign(ng + 1, 0);
+  for (size_t g = 0; g < ng; ++g)
+  {
+    d_blocks_offset[g + 1] = d_blocks_offset[g] +
+      d_material->upper(g) + 1 - d_material->lower(g);
+  }
+
+  // Copy the banded scatter matrix of each material into its block.
+  const size_t block_size = d_blocks_offset[ng];
+  d_blocks.assign(nm * block_size, 0.0);
+  for (size_t g = 0; g < ng; ++g)
+  {
+    for (size_t gp = d_material->lower(g); gp <= d_material->upper(g); ++gp)
+    {
+      const double *sigma_s = d_material->sigma_s_row(g, gp);
+      size_t i = d_blocks_offset[g] + gp - d_material->lower(g);
+      for (size_t m = 0; m < nm; ++m)
+        d_blocks[m * block_size + i] = sigma_s[m];
+    }
+  }
+  d_blocks_revision = d_material->revision();
 }
 
 } // end namespace detran
@@ -25,6 +25,14 @@ namespace detran
 /**
  *  @class ScatterSource
  *  @brief Methods for constructing various scattering sources.
+ *
+ *  The banded scatter matrix of each material is copied into a small
+ *  contiguous block.  Each group source is then built with a single
+ *  pass over the cells, summing all incident groups in each cell, so
+ *  the source and material map are streamed once rather than once per
+ *  incident group.  The incident groups of a source are gathered by
+ *  the building call, so sources for different groups may be built
+ *  concurrently.
  *  @todo  Implement something in group bounds for adjoint
  */
 //---------------------------------------------------------------------------//
@@ -44,6 +52,7 @@ public:
   typedef State::SP_state                           SP_state;
   typedef State::moments_type                       moments_type;
   typedef detran_utilities::vec_int                 vec_int;
+  typedef detran_utilities::vec_dbl                 vec_dbl;
   typedef detran_utilities::size_t                  size_t;
 
   //-------------------------------------------------------------------------//
@@ -144,6 +153,24 @@ public:
                                 const State::vec_moments_type &phi,
                                 moments_type &source);
 
+  /**
+   *  @brief Build the total scatter source for all groups at once.
+   *
+   *  This adds the source of build_total_group_source to each group
+   *  at or above the cutoff, but with a single pass over the cells.
+   *  The cells are processed in tiles, for which the fluxes of all
+   *  groups are gathered into a cell-major view, so that each group's
+   *  source is a short, cache-resident dot product per cell.  This is
+   *  the preferred form for multigroup Krylov operators.
+   *
+   *  @param   g_cutoff Highest group to contribute to downscatter.
+   *  @param   phi      Const reference to multigroup flux moments.
+   *  @param   source   Mutable reference to multigroup moments sources.
+   */
+  void build_total_group_sources(const size_t g_cutoff,
+                                 const State::vec_moments_type &phi,
+                                 State::vec_moments_type &source);
+
 protected:
 
   //-------------------------------------------------------------------------//
@@ -157,7 +184,46 @@ protected:
   /// State
   SP_state d_state;
   /// Material map
-  vec_int d_mat_map;
+  detran_geometry::MeshMap d_mat_map;
+  /// Banded scatter matrix of each material [material, group, group']
+  vec_dbl d_blocks;
+  /// Offset of each group's band within a material's block [group + 1]
+  vec_int d_blocks_offset;
+  /// Material revision of the blocks
+  size_t d_blocks_revision;
+
+  /// Incident groups of one group source, owned by the building call
+  struct group_terms
+  {
+    /// Incident group fluxes
+    std::vector<const double*> phi;
+    /// Block index of each incident group
+    vec_int index;
+  };
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Copy the banded scatter matrices into the blocks.
+  void setup_blocks();
+
+  /// Rebuild the blocks if the material changed.
+  void update_blocks();
+
+  /// Start a group source.
+  void setup_group_source(const size_t g, group_terms &terms);
+
+  /// Add an incident group to the group source.
+  void add_group_source(const size_t  g,
+                        const size_t  gp,
+                        const double *phi,
+                        group_terms  &terms);
+
+  /// Add the group source with one pass over the cells.
+  void build_group_source(const size_t       g,
+                          const group_terms &terms,
+                          moments_type      &source);
 
 };
 
@@ -10,6 +10,8 @@
 #ifndef detran_SCATTERSOURCE_I_HH_
 #define detran_SCATTERSOURCE_I_HH_
 
+#include <algorithm>
+
 namespace detran
 {
 
@@ -23,10 +25,10 @@ build_within_group_source(const size_t        g,
   Require(g < d_material->number_groups());
   Require(phi.size() == source.size());
 
-  for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-  {
-    source[cell] += phi[cell] * d_material->sigma_s(d_mat_map[cell], g, g);
-  }
+  group_terms terms;
+  setup_group_source(g, terms);
+  add_group_source(g, g, &phi[0], terms);
+  build_group_source(g, terms, source);
 }
 
 //---------------------------------------------------------------------------//
@@ -37,24 +39,12 @@ build_in_scatter_source(const size_t  g,
   // Preconditions.
   Require(g < d_material->number_groups());
 
-  // Add downscatter.
-  for (size_t gp = d_material->lower(g); gp < g; ++gp) 
-  {
-    const moments_type &phi = d_state->phi(gp);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      source[cell] += phi[cell] * d_material->sigma_s(d_mat_map[cell], g, gp);
-    }
-  }
-  // Add upscatter.
-  for (size_t gp = g + 1; gp <= d_material->upper(g); ++gp)
-  {
-    const moments_type &phi = d_state->phi(gp);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      source[cell] += phi[cell] * d_material->sigma_s(d_mat_map[cell], g, gp);
-    }
-  }
+  // Add down- and upscatter.
+  group_terms terms;
+  setup_group_source(g, terms);
+  for (size_t gp = d_material->lower(g); gp <= d_material->upper(g); ++gp)
+    if (gp != g) add_group_source(g, gp, &d_state->phi(gp)[0], terms);
+  build_group_source(g, terms, source);
 }
 
 //---------------------------------------------------------------------------//
@@ -67,16 +57,13 @@ build_downscatter_source(const size_t  g,
   Require(g < d_material->number_groups());
   Require(g_cutoff <= d_material->number_groups());
 
-  // Add downscatter.
-  for (size_t gp = d_material->lower(g); gp < g_cutoff; ++gp) 
-  {
-    moments_type &phi = d_state->phi(gp);
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      source[cell] += phi[cell] * d_material->sigma_s(d_mat_map[cell], g, gp);
-    }
-  }
-
+  // Add downscatter.  Groups beyond the upper bound do not couple to g.
+  group_terms terms;
+  setup_group_source(g, terms);
+  size_t gp_end = std::min(g_cutoff, d_material->upper(g) + 1);
+  for (size_t gp = d_material->lower(g); gp < gp_end; ++gp)
+    add_group_source(g, gp, &d_state->phi(gp)[0], terms);
+  build_group_source(g, terms, source);
 }
 
 //---------------------------------------------------------------------------//
@@ -88,13 +75,69 @@ build_total_group_source(const size_t                   g,
 {
   Require(g < d_material->number_groups());
 
-  for (size_t gp = g_cutoff; gp <= d_material->upper(g); ++gp)
+  // Groups below the lower bound do not couple to g.
+  group_terms terms;
+  setup_group_source(g, terms);
+  size_t gp_begin = std::max(g_cutoff, d_material->lower(g));
+  for (size_t gp = gp_begin; gp <= d_material->upper(g); ++gp)
+    add_group_source(g, gp, &phi[gp][0], terms);
+  build_group_source(g, terms, source);
+}
+
+//---------------------------------------------------------------------------//
+inline void ScatterSource::update_blocks()
+{
+  #pragma omp critical(scatter_blocks)
+  {
+    if (d_blocks.empty() || d_blocks_revision != d_material->revision())
+      setup_blocks();
+  }
+}
+
+//---------------------------------------------------------------------------//
+inline void ScatterSource::setup_group_source(const size_t  g,
+                                              group_terms  &terms)
+{
+  update_blocks();
+  size_t number_terms = d_material->upper(g) + 1 - d_material->lower(g);
+  terms.phi.reserve(number_terms);
+  terms.index.reserve(number_terms);
+}
+
+//---------------------------------------------------------------------------//
+inline void ScatterSource::add_group_source(const size_t  g,
+                                            const size_t  gp,
+                                            const double *phi,
+                                            group_terms  &terms)
+{
+  Require(gp >= d_material->lower(g) && gp <= d_material->upper(g));
+  terms.phi.push_back(phi);
+  terms.index.push_back(d_blocks_offset[g] + gp - d_material->lower(g));
+}
+
+//---------------------------------------------------------------------------//
+inline void ScatterSource::build_group_source(const size_t       g,
+                                              const group_terms &terms,
+                                              moments_type      &source)
+{
+  const int number_terms = terms.phi.size();
+  if (number_terms == 0) return;
+  const double *const *phi   = &terms.phi[0];
+  const int           *index = &terms.index[0];
+  const double        *block = &d_blocks[0];
+  const int           *mat_map = d_mat_map.data();
+  const int            block_size = d_blocks_offset.back();
+
+  // One pass over the cells, summing all incident groups in each.
+  const int number_cells = d_mesh->number_cells();
+  #pragma omp parallel for default(shared)
+  for (int cell = 0; cell < number_cells; ++cell)
   {
-    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
-    {
-      source[cell] += phi[gp][cell] *
-          d_material->sigma_s(d_mat_map[cell], g, gp);
-    }
+    const double *sigma_s = block + mat_map[cell] * block_size;
+    double q = 0.0;
+    for (int t = 0; t < number_terms; ++t)
+      q += sigma_s[index[t]] * phi[t][cell];
+    source[cell] += q;
   }
 }
 
@@ -70,9 +70,23 @@ State::State(SP_input        input,
   {
     Insist(d_quadrature, "Angular flux requested but no quadrature given.");
     d_store_angular_flux = true;
-    d_angular_flux.resize(d_number_groups,
-                          vec_moments_type(d_quadrature->number_angles(),
-			               moments_type(d_mesh->number_cells(), 0.0)));
+    int layout = AngularFlux::ANGLE_MAJOR;
+    if (input->check("angular_flux_layout"))
+    {
+      std::string name = input->get<std::string>("angular_flux_layout");
+      if (name == "cell")
+        layout = AngularFlux::CELL_MAJOR;
+      else
+        Insist(name == "angle", "Unknown angular_flux_layout: " + name);
+    }
+    bool single = false;
+    if (input->check("angular_flux_single"))
+      single = (0 != input->get<int>("angular_flux_single"));
+    d_angular_flux = AngularFlux(d_number_groups,
+                                 d_quadrature->number_angles(),
+                                 d_mesh->number_cells(),
+                                 layout,
+                                 single);
   }
 
 }
@@ -85,15 +99,9 @@ void State::clear()
     for (size_t i = 0; i < d_mesh->number_cells(); ++i)
     {
       d_moments[g][i] = 0.0;
-      if (d_store_angular_flux)
-      {
-        for (size_t a = 0; a < d_quadrature->number_angles(); ++a)
-        {
-          d_angular_flux[g][a][i] = 0.0;
-        }
-      }
     }
   }
+  d_angular_flux.clear();
 }
 
 //---------------------------------------------------------------------------//
@@ -104,15 +112,9 @@ void State::scale(const double f)
     for (size_t i = 0; i < d_mesh->number_cells(); ++i)
     {
       d_moments[g][i] *= f;
-      if (d_store_angular_flux)
-      {
-        for (size_t a = 0; a < d_quadrature->number_angles(); ++a)
-        {
-          d_angular_flux[g][a][i] *= f;
-        }
-      }
     }
   }
+  d_angular_flux.scale(f);
 }
 
 //---------------------------------------------------------------------------//
@@ -156,12 +158,13 @@ void State::display() const
 
   if (d_store_angular_flux)
   {
+    size_t number_angles = d_quadrature->number_angles();
     printf("\n");
-    for (size_t a = 0; a < d_angular_flux[0].size() + 1; a++)
+    for (size_t a = 0; a < number_angles + 1; a++)
       printf("--------------");
     printf("\n");
     printf("Discrete Angular Flux\n");
-    for (size_t a = 0; a < d_angular_flux[0].size() + 1; a++)
+    for (size_t a = 0; a < number_angles + 1; a++)
       printf("--------------");
     printf("\n");
 
@@ -169,18 +172,18 @@ void State::display() const
     {
       printf("group %4i \n", g);
       printf("cell \\ a");
-      for (size_t a = 0; a < d_angular_flux[g].size(); a++)
+      for (size_t a = 0; a < number_angles; a++)
         printf(" %12i ", a);
       printf("\n");
-      for (size_t a = 0; a < d_angular_flux[0].size() + 1; a++)
+      for (size_t a = 0; a < number_angles + 1; a++)
         printf("--------------");
       printf("\n");
       for (size_t i = 0; i < d_mesh->number_cells(); i++)
       {
         printf("%10i", i);
-        for (size_t a = 0; a < d_angular_flux[g].size(); a++)
+        for (size_t a = 0; a < number_angles; a++)
         {
-          printf(" %12.5e ", d_angular_flux[g][a][i]);
+          printf(" %12.5e ", double(d_angular_flux.view(g, a)[i]));
         }
         printf("\n");
       }
@@ -11,6 +11,7 @@
 #define detran_STATE_HH_
 
 #include "transport/transport_export.hh"
+#include "transport/AngularFlux.hh"
 #include "angle/Quadrature.hh"
 #include "angle/MomentIndexer.hh"
 #include "geometry/Mesh.hh"
@@ -33,9 +34,19 @@ namespace detran
  *  typically what we need (e.g. doses or fission rates).  For eigenvalue
  *  problems, keff is also included.
  *
+ *  The angular flux, if stored, is kept in one contiguous AngularFlux.
+ *  The const psi(g, o, a) returns a read-only view into it rather than a
+ *  vector.  Writers get a view with psi(g, o, a, buffer), which stages
+ *  single precision values in the buffer, and then call store_psi().
+ *
  *  Relevant input entries:
  *  - number_groups (int)
  *  - store_angular_flux (int)
+ *  - angular_flux_layout (string), "angle" to store the cells of each
+ *    angle contiguously (default), or "cell" to store the angles of each
+ *    cell contiguously
+ *  - angular_flux_single (int), 1 to store the angular flux in single
+ *    precision (default 0)
  */
 //---------------------------------------------------------------------------//
 class TRANSPORT_EXPORT State
@@ -55,8 +66,8 @@ public:
   typedef detran_utilities::vec_dbl                     moments_type;
   typedef std::vector<moments_type>                     vec_moments_type;
   typedef std::vector<moments_type>                     group_moments_type;
-  typedef detran_utilities::vec_dbl                     angular_flux_type;
-  typedef std::vector<std::vector<angular_flux_type> >  vec_angular_flux_type;
+  typedef AngularFluxView                               angular_flux_type;
+  typedef ConstAngularFluxView                          const_angular_flux_type;
   typedef detran_utilities::vec_dbl                     vec_dbl;
   typedef detran_utilities::size_t                      size_t;
 
@@ -116,23 +127,38 @@ public:
   void set_moments(const size_t g, std::vector<double>& f);
 
   /**
-   *  @brief Const accessor to a group angular flux.
+   *  @brief Accessor to a group angular flux.
    *  @param    g   Group of field requested.
    *  @param    o   Octant
    *  @param    a   Angle within octant
-   *  @return       Constant reference to group angular flux vector.
+   *  @return       Read-only view of the group angular flux.
    */
-  const angular_flux_type& psi(const size_t g,
-                               const size_t o,
-                               const size_t a) const;
+  const_angular_flux_type psi(const size_t g,
+                              const size_t o,
+                              const size_t a) const;
+
   /**
    *  @brief Mutable accessor to a group angular flux.
-   *  @param    g   Group of field requested.
-   *  @param    o   Octant
-   *  @param    a   Angle within octant
-   *  @return       Mutable reference to group angular flux vector.
+   *  @param    g       Group of field requested.
+   *  @param    o       Octant
+   *  @param    a       Angle within octant
+   *  @param    buffer  Staging buffer used in single precision
+   *  @return           View of the group angular flux, to be passed to
+   *                    store_psi() once written.
    */
-  angular_flux_type& psi(const size_t g, const size_t o, const size_t a);
+  angular_flux_type psi(const size_t g,
+                        const size_t o,
+                        const size_t a,
+                        vec_dbl     &buffer);
+
+  /// Write back a view from psi(g, o, a, buffer).
+  void store_psi(const size_t g,
+                 const size_t o,
+                 const size_t a,
+                 const angular_flux_type &psi);
+
+  /// Access to all angular fluxes.
+  const AngularFlux& angular_flux() const { return d_angular_flux; }
 
   /// Const accessor to a group current field.
   const moments_type& current(const size_t g) const;
@@ -219,8 +245,8 @@ private:
   size_t d_number_moments;
   /// Cell-center scalar flux moments, [energy, (space-moment)]
   vec_moments_type d_moments;
-  /// Cell-center angular flux, [energy, angle, (space)]
-  vec_angular_flux_type d_angular_flux;
+  /// Cell-center angular flux, [energy, angle, space] or [energy, space, angle]
+  AngularFlux d_angular_flux;
   /// Cell-center current magnitude, e.g. sqrt(Jx^2+Jy^2)
   vec_moments_type d_current;
   /// k-eigenvalue
@@ -60,28 +60,37 @@ inline void State::set_moments(const size_t g, std::vector<double>& f)
 }
 
 //---------------------------------------------------------------------------//
-inline const State::angular_flux_type&
+inline State::const_angular_flux_type
 State::psi(const size_t g, const size_t o, const size_t a) const
 {
   Require(d_store_angular_flux);
-  Require(d_angular_flux.size() > 0);
   Require(o < d_quadrature->number_octants());
   Require(a < d_quadrature->number_angles_octant());
   Require(g < d_number_groups);
   int angle = d_quadrature->index(o, a);
-  return d_angular_flux[g][angle];
+  return d_angular_flux.view(g, angle);
 }
 
 //---------------------------------------------------------------------------//
-inline State::angular_flux_type&
-State::psi(const size_t g, const size_t o, const size_t a)
+inline State::angular_flux_type
+State::psi(const size_t g, const size_t o, const size_t a, vec_dbl &buffer)
 {
-  // Cast away return type
-  return const_cast<angular_flux_type&>
-  (
-    // Add const to *this's type and call const version
-    static_cast<const State*>(this)->psi(g, o, a)
-  );
+  Require(d_store_angular_flux);
+  Require(o < d_quadrature->number_octants());
+  Require(a < d_quadrature->number_angles_octant());
+  Require(g < d_number_groups);
+  int angle = d_quadrature->index(o, a);
+  return d_angular_flux.view(g, angle, buffer);
+}
+
+//---------------------------------------------------------------------------//
+inline void State::store_psi(const size_t g,
+                             const size_t o,
+                             const size_t a,
+                             const angular_flux_type &psi)
+{
+  Require(d_store_angular_flux);
+  d_angular_flux.store(g, d_quadrature->index(o, a), psi);
 }
 
 //---------------------------------------------------------------------------//
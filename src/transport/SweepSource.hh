@@ -100,6 +100,7 @@ public:
           ExternalSource::SP_externalsource         SP_externalsource;
   typedef ScatterSource::SP_scattersource           SP_scattersource;
   typedef FissionSource::SP_fissionsource           SP_fissionsource;
+  typedef CellCrossSections::SP_cellxs              SP_cellxs;
   typedef detran_utilities::vec_dbl                 sweep_source_type;
   typedef detran_utilities::size_t                  size_t;
   typedef State::moments_type                       moments_type;
@@ -193,6 +194,17 @@ public:
   {
     Require(source);
     d_fissionsource = source;
+    if (d_cell_xs) d_fissionsource->set_cell_xs(d_cell_xs);
+  }
+
+  /**
+   *  @brief Share cell-wise cross sections with the fission source.
+   *  @param xs   Cell cross sections; if null, use the material map.
+   */
+  void set_cell_xs(SP_cellxs xs)
+  {
+    d_cell_xs = xs;
+    if (d_fissionsource) d_fissionsource->set_cell_xs(xs);
   }
 
   SP_scattersource get_scatter_source()
@@ -250,6 +262,32 @@ public:
    */
   void build_total_scatter(const size_t g, const size_t g_cutoff, const State::vec_moments_type &phi);
 
+  /**
+   *  @brief Build total scattering sources for all groups at once.
+   *
+   *  This builds the sources of build_total_scatter for all groups
+   *  at or above the cutoff with a single pass over the cells.  They
+   *  are kept until set_total_scatter selects one for a group.
+   */
+  void build_total_scatter(const size_t g_cutoff, const State::vec_moments_type &phi);
+
+  /// Use the total scattering source built for all groups in group g.
+  void set_total_scatter(const size_t g);
+
+  /**
+   *  @brief Fill a source vector from the total scattering source of g.
+   *
+   *  Unlike source, this reads the source kept by build_total_scatter
+   *  for group g rather than the current group sources, so that the
+   *  sources of several groups are available at once.  It is meant for
+   *  sweeping a block of groups within a multigroup Krylov operator, and
+   *  so the fixed sources are not included.
+   */
+  void total_scatter_source(const size_t g,
+                            const size_t o,
+                            const size_t a,
+                            sweep_source_type& s);
+
   /// Reset all the internal source vectors to zero.
   void reset();
 
@@ -287,6 +325,8 @@ private:
   moments_type d_fixed_group_source;
   /// Within group scattering applicable to all angles in this group.
   moments_type d_scatter_group_source;
+  /// Total scattering sources built for all groups at once.
+  State::vec_moments_type d_total_scatter_source;
   /// A container of external moments sources
   std::vector<SP_externalsource> d_moment_external_sources;
   /// A container of external discrete sources
@@ -297,6 +337,8 @@ private:
   bool d_implicit_fission;
   /// Scattering source
   SP_scattersource d_scattersource;
+  /// Optional cell cross sections
+  SP_cellxs d_cell_xs;
 
 };
 
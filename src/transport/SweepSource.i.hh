@@ -106,6 +106,39 @@ build_total_scatter(const size_t g, const size_t g_cutoff,
   }
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+inline void SweepSource<D>::
+build_total_scatter(const size_t g_cutoff, const State::vec_moments_type &phi)
+{
+  size_t number_groups = phi.size();
+  d_total_scatter_source.resize(number_groups);
+  for (size_t g = 0; g < number_groups; ++g)
+    d_total_scatter_source[g].assign(g < g_cutoff ? 0 : phi[g].size(), 0.0);
+  // Build total scattering sources
+  d_scattersource->build_total_group_sources(g_cutoff, phi,
+                                             d_total_scatter_source);
+  if (d_implicit_fission)
+  {
+    // For multiplying problems, there should be no downscatter block.
+    Assert(g_cutoff == 0);
+    for (size_t g = 0; g < number_groups; ++g)
+    {
+      d_fissionsource->build_total_group_source(g, phi,
+                                                d_total_scatter_source[g]);
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+inline void SweepSource<D>::set_total_scatter(const size_t g)
+{
+  Require(g < d_total_scatter_source.size());
+  Require(d_total_scatter_source[g].size() == d_scatter_group_source.size());
+  d_scatter_group_source = d_total_scatter_source[g];
+}
+
 //---------------------------------------------------------------------------//
 template <class D>
 inline void SweepSource<D>::
@@ -151,6 +184,28 @@ source(const size_t g, const size_t o, const size_t a, sweep_source_type &s)
 
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+inline void SweepSource<D>::
+total_scatter_source(const size_t g,
+                     const size_t o,
+                     const size_t a,
+                     sweep_source_type &s)
+{
+  Require(g < d_total_scatter_source.size());
+  Require(d_total_scatter_source[g].size() == d_mesh->number_cells());
+  const double *scatter_a = &d_total_scatter_source[g][0];
+  double mtod = (*d_MtoD)(o, a, 0, 0);
+  for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
+    s[cell] = scatter_a[cell] * mtod;
+
+  // Add discrete contributions if present.
+  size_t angle = d_quadrature->index(o, a);
+  for (size_t i = 0; i < d_discrete_external_sources.size(); ++i)
+    for (size_t cell = 0; cell < d_mesh->number_cells(); ++cell)
+      s[cell] += d_discrete_external_sources[i]->source(cell, g, angle);
+}
+
 //---------------------------------------------------------------------------//
 template <class D>
 void SweepSource<D>::reset()
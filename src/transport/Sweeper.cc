@@ -32,6 +32,9 @@ Sweeper<D>::Sweeper(SP_input input,
   , d_number_sweeps(0)
   , d_update_boundary(false)
   , d_ordered_octants(std::pow(2, D::dimension), 0)
+  , d_wavefront(false)
+  , d_angle_batch(false)
+  , d_group_block(1)
 {
   // Preconditions
   Require(d_input);
@@ -46,6 +49,34 @@ Sweeper<D>::Sweeper(SP_input input,
   if (d_input->check("store_angular_flux"))
     d_update_psi = (0 != d_input->get<int>("store_angular_flux"));
 
+  // Check whether we sweep along spatial wavefronts.
+  if (d_input->check("sweeper_wavefront"))
+    d_wavefront = (0 != d_input->get<int>("sweeper_wavefront"));
+
+  // Check whether we batch the angles of an octant in each cell.
+  if (d_input->check("sweeper_angle_batch"))
+    d_angle_batch = (0 != d_input->get<int>("sweeper_angle_batch"));
+
+  // Check how many groups are swept together.
+  if (d_input->check("sweeper_group_block"))
+  {
+    int block = d_input->get<int>("sweeper_group_block");
+    Insist(block >= 0, "The sweeper group block cannot be negative.");
+    d_group_block = std::max(block, 1);
+  }
+  // Check whether the cross sections are gathered by cell.
+  bool cell_xs = false;
+  if (d_input->check("cell_xs"))
+    cell_xs = (0 != d_input->get<int>("cell_xs"));
+  if (cell_xs)
+  {
+    double memory = 128.0;
+    if (d_input->check("cell_xs_memory"))
+      memory = d_input->get<double>("cell_xs_memory");
+    d_cell_xs = CellCrossSections::Create(d_mesh, d_material, memory);
+    d_sweepsource->set_cell_xs(d_cell_xs);
+  }
+
   // Perform templated setup tasks.
   setup();
 
@@ -60,6 +91,30 @@ template <class D>
 void Sweeper<D>::setup_group(const size_t g)
 {
   d_g = g;
+  // Update outside of the sweep, where the equations share it by thread.
+  if (d_cell_xs) d_cell_xs->update();
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+void Sweeper<D>::sweep_groups(const size_t g_first,
+                              State::vec_moments_type &phi)
+{
+  Require(g_first + phi.size() <= d_material->number_groups());
+  for (size_t b = 0; b < phi.size(); ++b)
+  {
+    d_sweepsource->reset();
+    d_sweepsource->set_total_scatter(g_first + b);
+    setup_group(g_first + b);
+    sweep(phi[b]);
+  }
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+detran_utilities::size_t Sweeper<D>::group_block() const
+{
+  return d_group_block;
 }
 
 //---------------------------------------------------------------------------//
@@ -212,6 +267,33 @@ void Sweeper<D>::setup_octant_indices(SP_boundary boundary)
 
 }
 
+//---------------------------------------------------------------------------//
+template <class D>
+void Sweeper<D>::setup_wavefronts()
+{
+  int n[3] = {1, 1, 1};
+  for (size_t dim = 0; dim < D::dimension; ++dim)
+    n[dim] = d_mesh->number_cells(dim);
+  int number_wavefronts = n[0] + n[1] + n[2] - 2;
+
+  // Count the cells on each wavefront and convert to offsets.
+  d_wavefront_offsets.assign(number_wavefronts + 1, 0);
+  for (int kk = 0; kk < n[2]; ++kk)
+    for (int jj = 0; jj < n[1]; ++jj)
+      for (int ii = 0; ii < n[0]; ++ii)
+        ++d_wavefront_offsets[ii + jj + kk + 1];
+  for (int w = 0; w < number_wavefronts; ++w)
+    d_wavefront_offsets[w + 1] += d_wavefront_offsets[w];
+
+  // Bin the sweep-ordered cell indices by wavefront.
+  d_wavefront_cells.resize(d_mesh->number_cells(), 0);
+  vec_int next(d_wavefront_offsets.begin(), d_wavefront_offsets.end() - 1);
+  for (int kk = 0; kk < n[2]; ++kk)
+    for (int jj = 0; jj < n[1]; ++jj)
+      for (int ii = 0; ii < n[0]; ++ii)
+        d_wavefront_cells[next[ii + jj + kk]++] = ii + n[0] * (jj + n[1] * kk);
+}
+
 //---------------------------------------------------------------------------//
 // EXPLICIT INSTANTIATIONS
 //---------------------------------------------------------------------------//
@@ -50,6 +50,22 @@ namespace detran
  *  Relevant input database entries:
  *    - store_angular_flux [int]
  *    - equation [string]
+ *    - sweeper_wavefront [int], 0=parallel over angles only (default),
+ *      1=parallel over diagonal spatial wavefronts, pipelined over the
+ *      angles of an octant (2D and 3D SN only)
+ *    - sweeper_angle_batch [int], 0=solve one angle at a time (default),
+ *      1=solve all angles of an octant together in each cell, with the
+ *      cells of a diagonal wavefront split among threads (2D and 3D
+ *      diamond difference only; others solve one angle at a time)
+ *    - cell_xs [int], 0=look up the cross sections through the material
+ *      map (default), 1=gather the cross sections of each group by cell
+ *      for the equations and sources
+ *    - cell_xs_memory [double], memory budget in MB for the cell cross
+ *      sections, beyond which the material map is used (default 128)
+ *    - sweeper_group_block [int], maximum number of groups swept
+ *      together by sweep_groups in one traversal of the mesh and
+ *      quadrature, with the groups innermost (2D diamond difference
+ *      only; others sweep the groups one at a time).  Default is 1.
  *
  */
 //---------------------------------------------------------------------------//
@@ -131,9 +147,28 @@ public:
   // PUBLIC FUNCTIONS
   //-------------------------------------------------------------------------//
 
-  /// Setup the equations for the group.  Default sets only the group index.
+  /// Setup the equations for the group and build its cell cross sections.
   virtual void setup_group(const size_t g);
 
+  /**
+   *  @brief Sweep a block of independent groups.
+   *
+   *  Each group is swept against the total scattering source kept by
+   *  SweepSource::build_total_scatter, as needed by the multigroup
+   *  Krylov operator, and the incident boundary fluxes of each group
+   *  must already be set.  By default, the groups are swept one at a
+   *  time.  Sweepers with a group-blocked kernel sweep them all in one
+   *  traversal of the mesh and quadrature.
+   *
+   *  @param g_first  first group of the block
+   *  @param phi      moments of groups g_first, g_first + 1, ..., updated
+   */
+  virtual void sweep_groups(const size_t g_first,
+                            State::vec_moments_type &phi);
+
+  /// Maximum number of groups swept together by sweep_groups
+  size_t group_block() const;
+
   /// Allows the psi update to occur whenever needed
   void set_update_psi(const bool v);
 
@@ -150,7 +185,14 @@ public:
   /// Is adjoint?
   bool is_adjoint() const;
 
-  /// Set a boundary flux tally.
+  /**
+   *  @brief Set a coarse mesh current tally.
+   *
+   *  Each sweep of a group first resets the group's tally, so that it
+   *  holds the currents of the last sweep.  Only the default sweeps of
+   *  the SN sweepers tally; wavefront, angle-batched, and group-blocked
+   *  sweeps fall back to the default sweep when a tally is set.
+   */
   void set_tally(SP_tally tally);
 
 protected:
@@ -189,6 +231,20 @@ protected:
   vec3_int d_space_ranges;
   /// Ordered octant indices
   vec_int d_ordered_octants;
+  /// Per-thread moments, kept across sweeps
+  std::vector<moments_type> d_thread_phi;
+  /// Sweep along spatial wavefronts?
+  bool d_wavefront;
+  /// Sweep-ordered cell indices grouped by wavefront
+  vec_int d_wavefront_cells;
+  /// Offset of each wavefront into the wavefront cells
+  vec_int d_wavefront_offsets;
+  /// Solve all angles of an octant together in each cell?
+  bool d_angle_batch;
+  /// Maximum number of groups swept together
+  size_t d_group_block;
+  /// Cross sections by cell shared with the equations and sources
+  CellCrossSections::SP_cellxs d_cell_xs;
 
   //-------------------------------------------------------------------------//
   // IMPLEMENTATION
@@ -203,8 +259,43 @@ protected:
   /// Setup octant sweep indices.
   void setup_octant_indices(SP_boundary);
 
+  /**
+   *  @brief Get the calling thread's moments buffer for a sweep.
+   *
+   *  Each thread sizes and zeros its own buffer, so that the pages are
+   *  first touched (and placed) by the thread that uses them.  Without
+   *  OpenMP, this is just phi.  Must be called inside the parallel region.
+   */
+  inline moments_type& thread_phi(moments_type &phi);
+
+  /**
+   *  @brief Sum the per-thread moments into phi.
+   *
+   *  The cells are split among the threads, and each cell sums the
+   *  thread buffers in thread order, so the result does not depend on
+   *  the timing of the threads.  Must be called by all threads inside
+   *  the parallel region.
+   */
+  inline void reduce_thread_phi(moments_type &phi);
+
+  /**
+   *  @brief Setup the diagonal wavefronts of the spatial mesh.
+   *
+   *  Cells are indexed in sweep order, i.e. (ii, jj, kk) counts from
+   *  the incident corner of an octant, so that the same wavefronts serve
+   *  all octants.  Wavefront w holds all cells with ii + jj + kk = w, none
+   *  of which depend on each other.
+   */
+  void setup_wavefronts();
+
 };
 
 } // end namespace detran
 
+//---------------------------------------------------------------------------//
+// INLINE MEMBER DEFINITIONS
+//---------------------------------------------------------------------------//
+
+#include "Sweeper.i.hh"
+
 #endif /* detran_SWEEPER_HH_ */
@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   Sweeper.i.hh
+ *  @author Jeremy Roberts
+ *  @date   Mar 24, 2012
+ *  @brief  Sweeper inline member definitions.
+ */
+//---------------------------------------------------------------------------//
+
+#ifndef detran_SWEEPER_I_HH_
+#define detran_SWEEPER_I_HH_
+
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+namespace detran
+{
+
+//---------------------------------------------------------------------------//
+template <class D>
+inline typename Sweeper<D>::moments_type&
+Sweeper<D>::thread_phi(moments_type &phi)
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  // Only one thread may resize the container of buffers.
+  #pragma omp single
+  {
+    if ((int)d_thread_phi.size() < omp_get_num_threads())
+      d_thread_phi.resize(omp_get_num_threads());
+  }
+  moments_type &phi_local = d_thread_phi[omp_get_thread_num()];
+  phi_local.resize(phi.size());
+  for (size_t i = 0; i < phi_local.size(); ++i)
+    phi_local[i] = 0.0;
+  return phi_local;
+#else
+  return phi;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+template <class D>
+inline void Sweeper<D>::reduce_thread_phi(moments_type &phi)
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  // All threads must be done sweeping.
+  #pragma omp barrier
+  const int number_threads = omp_get_num_threads();
+  #pragma omp for
+  for (int i = 0; i < (int)phi.size(); ++i)
+  {
+    double value = 0.0;
+    for (int t = 0; t < number_threads; ++t)
+      value += d_thread_phi[t][i];
+    phi[i] = value;
+  }
+#endif
+}
+
+} // end namespace detran
+
+#endif /* detran_SWEEPER_I_HH_ */
+
+//---------------------------------------------------------------------------//
+//              end of Sweeper.i.hh
+//---------------------------------------------------------------------------//
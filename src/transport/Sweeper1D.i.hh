@@ -25,28 +25,27 @@ inline void Sweeper1D<EQ>::sweep(moments_type &phi)
   // Preconditions
   Require(d_g < d_material->number_groups());
 
-  // Reset the flux moments
+  // Reset the flux moments and the group's currents
   phi.assign(phi.size(), 0.0);
+  if (d_tally) d_tally->reset(d_g);
 
-#ifdef DETRAN_ENABLE_OPENMP
-  moments_type phi_local;
-#else
-  moments_type &phi_local = phi;
-#endif
-
-  #pragma omp parallel default(shared) private(phi_local)
+  #pragma omp parallel default(shared)
   {
 
+  // Get this thread's moments.
+  moments_type &phi_local = thread_phi(phi);
+
   // Initialize equation and setup for this group.
   Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.set_cell_xs(d_cell_xs);
   equation.setup_group(d_g);
 
-  // Reset the flux moments
-  phi_local.resize(d_mesh->number_cells(), 0.0);
-
   // Initialize discrete sweep source vector.
   SweepSource<_1D>::sweep_source_type source(d_mesh->number_cells(), 0.0);
 
+  // Staging buffer for an angular flux stored in single precision.
+  State::vec_dbl psi_buffer;
+
   // Temporary edge fluxes
   typename Equation_T::face_flux_type psi_in = 0.0;
   typename Equation_T::face_flux_type psi_out = 0.0;
@@ -75,7 +74,7 @@ inline void Sweeper1D<EQ>::sweep(moments_type &phi)
 
       // Get psi if update requested.
       State::angular_flux_type psi;
-      if (d_update_psi) psi = d_state->psi(d_g, o, a);
+      if (d_update_psi) psi = d_state->psi(d_g, o, a, psi_buffer);
 
       // Update the boundary for this angle.
       if (d_update_boundary) b.update(d_g, o, a);
@@ -97,34 +96,26 @@ inline void Sweeper1D<EQ>::sweep(moments_type &phi)
         psi_in = psi_out;
 
         // Solve the equation in this cell.
-        equation.solve(i, 0, 0, source, psi_in, psi_out, phi, psi);
+        equation.solve(i, 0, 0, source, psi_in, psi_out, phi_local, psi);
 
         // Tally the outgoing cell flux
-        if (d_tally) d_tally->tally(i, 0, 0, d_g, o, a, Tally_T::X_DIRECTED, psi_out);
+        if (d_tally) d_tally->tally(i, 0, 0, d_g, o, a, psi_out);
 
       } // end x loop
 
       // Update boundary.
       b(d_face_index[o][Mesh::VERT][Boundary_T::OUT], o, a, d_g) = psi_out;
 
-      // Update the angular flux.
-      if (d_update_psi) d_state->psi(d_g, o, a) = psi;
+      // Write back psi.
+      if (d_update_psi) d_state->store_psi(d_g, o, a, psi);
 
     } // end angle loop
     // end omp do
 
   } // end octant loop
 
-#ifdef DETRAN_ENABLE_OPENMP
   // Sum local thread fluxes.
-  #pragma omp critical
-  {
-    for (int i = 0; i < d_mesh->number_cells(); i++)
-    {
-      phi[i] += phi_local[i];
-    }
-  }
-#endif
+  reduce_thread_phi(phi);
 
   } // end omp parallel
 
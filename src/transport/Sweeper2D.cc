@@ -26,9 +26,17 @@ Sweeper2D<EQ>::Sweeper2D(SP_input input,
                          SP_sweepsource sweepsource)
   : Base(input, mesh, material, quadrature, state, boundary, sweepsource)
   , d_boundary(boundary)
+  , d_wavefront_update_psi(false)
 {
     // Preconditions
     Require(d_boundary);
+
+    // Only diamond difference has the angle-batched kernel, and the
+    // other equations solve one angle at a time.
+    if (!angle_batch_available()) d_angle_batch = false;
+
+    if (d_wavefront || d_angle_batch) setup_wavefronts();
+    if (d_wavefront) setup_wavefront_storage();
 }
 
 //---------------------------------------------------------------------------//
@@ -49,7 +49,7 @@ public:
   typedef EQ                                        Equation_T;
   typedef BoundarySN<_2D>                           Boundary_T;
   typedef typename Boundary_T::SP_boundary          SP_boundary;
-  typedef typename BoundaryTraits<_2D>::value_type  bf_type;
+  typedef typename BoundaryTraits<_2D>::view_type   bf_type;
 
   //-------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -93,6 +93,20 @@ public:
   /// Sweep.
   inline void sweep(moments_type &phi);
 
+  /**
+   *  @brief Sweep a block of independent groups.
+   *
+   *  For diamond difference, blocks of up to sweeper_group_block groups
+   *  are swept together.  Each cell is solved for all groups of the block
+   *  at once with the equation's group-blocked kernel, so the mesh,
+   *  boundary, and quadrature data are traversed once per block rather
+   *  than once per group.  The angles are split among threads as in
+   *  sweep.  Other equations, and any sweep with a current tally, sweep
+   *  one group at a time.
+   */
+  inline void sweep_groups(const size_t g_first,
+                           State::vec_moments_type &phi);
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -101,6 +115,48 @@ private:
 
   // SN boundary
   SP_boundary d_boundary;
+  /// Equations of the wavefront sweep, one per angle of an octant
+  std::vector<Equation_T> d_wavefront_equations;
+  /// Sweep sources of the wavefront sweep, one per angle
+  std::vector<SweepSource<_2D>::sweep_source_type> d_wavefront_sources;
+  /// Edge flux views of the wavefront sweep, one per angle
+  std::vector<bf_type> d_wavefront_psi_v;
+  std::vector<bf_type> d_wavefront_psi_h;
+  /// Angular flux views of the wavefront sweep and their staging buffers
+  std::vector<angular_flux_type> d_wavefront_psi;
+  std::vector<State::vec_dbl> d_wavefront_psi_buffers;
+  /// Angular flux flag with which the wavefront equations were built
+  bool d_wavefront_update_psi;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /**
+   *  @brief Sweep over diagonal wavefronts.
+   *
+   *  All angles of an octant are pipelined through the wavefronts: at
+   *  stage s, angle a works on wavefront s - a.  Hence, no two threads
+   *  ever touch the same cell in a stage, and the moments are updated
+   *  in place.  The result is identical to the angle-parallel sweep.
+   */
+  inline void sweep_wavefront(moments_type &phi);
+
+  /// Size the wavefront storage, rebuilding it if the psi flag changed
+  inline void setup_wavefront_storage();
+
+  /**
+   *  @brief Sweep over diagonal wavefronts with all angles batched.
+   *
+   *  Each cell is solved for all angles of an octant at once using the
+   *  equation's angle-batched kernel, with sources and edge fluxes stored
+   *  angle-innermost.  The cells of a wavefront are split among threads.
+   *  Only diamond difference provides the batched kernel.
+   */
+  inline void sweep_angle_batch(moments_type &phi);
+
+  /// Whether the equation provides the angle-batched kernel
+  inline static bool angle_batch_available();
 
 };
 
@@ -10,6 +10,8 @@
 #ifndef detran_SWEEPER2D_I_HH_
 #define detran_SWEEPER2D_I_HH_
 
+#include "transport/Equation_DD_2D.hh"
+#include <algorithm>
 #include <iostream>
 #ifdef DETRAN_ENABLE_OPENMP
 #include <omp.h>
@@ -23,28 +25,41 @@ template <class EQ>
 inline void Sweeper2D<EQ>::sweep(moments_type &phi)
 {
 
-  // Reset the flux moments
-  phi.assign(phi.size(), 0.0);
+  // Sweep with batched angles if requested.
+  if (d_angle_batch && !d_tally)
+  {
+    sweep_angle_batch(phi);
+    return;
+  }
 
-#ifdef DETRAN_ENABLE_OPENMP
-  moments_type phi_local;
-#else
-  moments_type &phi_local = phi;
-#endif
+  // Sweep over spatial wavefronts if requested.
+  if (d_wavefront && !d_tally)
+  {
+    sweep_wavefront(phi);
+    return;
+  }
+
+  // Reset the flux moments and the group's currents
+  phi.assign(phi.size(), 0.0);
+  if (d_tally) d_tally->reset(d_g);
 
-  #pragma omp parallel default(shared) private(phi_local)
+  #pragma omp parallel default(shared)
   {
 
+  // Get this thread's moments.
+  moments_type &phi_local = thread_phi(phi);
+
   // Initialize equation and setup for this group.
   Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.set_cell_xs(d_cell_xs);
   equation.setup_group(d_g);
 
-  // Reset the flux moments
-  phi_local.resize(d_mesh->number_cells(), 0.0);
-
   // Initialize discrete sweep source vector.
   SweepSource<_2D>::sweep_source_type source(d_mesh->number_cells(), 0.0);
 
+  // Staging buffer for an angular flux stored in single precision.
+  State::vec_dbl psi_buffer;
+
   // Reference to boundary to simplify clutter.
   Boundary_T &b = *d_boundary;
 
@@ -75,14 +90,17 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
 
       // Get psi if needed.
       State::angular_flux_type psi;
-      if (d_update_psi) psi = d_state->psi(d_g, o, a);
+      if (d_update_psi) psi = d_state->psi(d_g, o, a, psi_buffer);
 
       // Update the boundary for this angle.
       if (d_update_boundary) b.update(d_g, o, a);
 
-      // Get boundary fluxes.
-      bf_type psi_v = b(face_V_i, o, a, d_g);
-      bf_type psi_h = b(face_H_i, o, a, d_g);
+      // Get views of the incident and outgoing boundary fluxes.  The
+      // outgoing sides hold the edge fluxes as the sweep proceeds.
+      const bf_type psi_v_in = b(face_V_i, o, a, d_g);
+      const bf_type psi_h_in = b(face_H_i, o, a, d_g);
+      const bf_type psi_v    = b(face_V_o, o, a, d_g);
+      const bf_type psi_h    = b(face_H_o, o, a, d_g);
 
       // Temporary edge fluxes.
       Equation<_2D>::face_flux_type psi_in  = {0.0, 0.0};
@@ -95,7 +113,10 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
       {
         // Note the index: incident boundaries are access from
         // "left to right" w/r to self.
-        psi_out[Mesh::VERT] = psi_v[j];
+        psi_out[Mesh::VERT] = psi_v_in[j];
+
+        // The first row reads the incident horizontal fluxes.
+        const bf_type &psi_h_last = jj ? psi_h : psi_h_in;
 
         // Sweep over all x.
         int i  = d_space_ranges[o][0][0]; // actual index
@@ -103,16 +124,29 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
         for (size_t ii = 0; ii < d_mesh->number_cells_x(); ++ii, i += di)
         {
           // Set the incident cell surface fluxes.
-          psi_in[Mesh::HORZ] = psi_h[i];
+          psi_in[Mesh::HORZ] = psi_h_last[i];
           psi_in[Mesh::VERT] = psi_out[Mesh::VERT];
 
+          // Tally the incident boundary fluxes.
+          if (d_tally && !ii)
+          {
+            d_tally->tally(i, j, 0, d_g, o, a, Tally_T::X_DIRECTED,
+                           psi_in[Mesh::VERT]);
+          }
+          if (d_tally && !jj)
+          {
+            d_tally->tally(i, j, 0, d_g, o, a, Tally_T::Y_DIRECTED,
+                           psi_in[Mesh::HORZ]);
+          }
+
           // Solve the equation in this cell.
           equation.solve(i, j, 0, source, psi_in, psi_out, phi_local, psi);
 
           // Save the horizontal flux.
           psi_h[i] = psi_out[Mesh::HORZ];
 
-          // INSERT ACCELERATION MESH STUFF HERE
+          // Tally the outgoing cell fluxes.
+          if (d_tally) d_tally->tally(i, j, 0, d_g, o, a, psi_out);
 
         } // end x loop
 
@@ -121,35 +155,496 @@ inline void Sweeper2D<EQ>::sweep(moments_type &phi)
 
       } // end y loop
 
-      // Update boundary
-      b(face_V_o, o, a, d_g) = psi_v;
-      b(face_H_o, o, a, d_g) = psi_h;
-
-      // Update the angular flux.
-      if (d_update_psi) d_state->psi(d_g, o, a) = psi;
+      // Write back psi.
+      if (d_update_psi) d_state->store_psi(d_g, o, a, psi);
 
     } // end angle loop
     // end omp do
 
   } // end octant loop
 
-#ifdef DETRAN_ENABLE_OPENMP
   // Sum local thread fluxes.
-  #pragma omp critical
+  reduce_thread_phi(phi);
+
+  } // end omp parallel
+
+  #pragma omp master
+  {
+    d_number_sweeps++;
+  }
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper2D<EQ>::sweep_wavefront(moments_type &phi)
+{
+  // Reset the flux moments
+  phi.assign(phi.size(), 0.0);
+
+  const int number_angles     = d_quadrature->number_angles_octant();
+  const int number_wavefronts = d_wavefront_offsets.size() - 1;
+  const int nx                = d_mesh->number_cells_x();
+
+  // Equations, sources, and edge flux views for all angles in an octant.
+  // These are shared by all threads, since each angle is swept by all
+  // threads.
+  setup_wavefront_storage();
+  std::vector<Equation_T> &equation = d_wavefront_equations;
+  std::vector<SweepSource<_2D>::sweep_source_type> &source =
+    d_wavefront_sources;
+  std::vector<bf_type> &psi_v = d_wavefront_psi_v;
+  std::vector<bf_type> &psi_h = d_wavefront_psi_h;
+  std::vector<angular_flux_type> &psi = d_wavefront_psi;
+
+  // Reference to boundary to simplify clutter.
+  Boundary_T &b = *d_boundary;
+
+  #pragma omp parallel default(shared)
   {
-    for (int i = 0; i < d_mesh->number_cells(); i++)
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 4; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+
+    // Get face indices
+    const int face_V_i = d_face_index[o][Mesh::VERT][Boundary_T::IN];
+    const int face_H_i = d_face_index[o][Mesh::HORZ][Boundary_T::IN];
+    const int face_V_o = d_face_index[o][Mesh::VERT][Boundary_T::OUT];
+    const int face_H_o = d_face_index[o][Mesh::HORZ][Boundary_T::OUT];
+
+    // Setup the equation, source, and incident fluxes for each angle.  The
+    // outgoing sides start from the incident fluxes and hold the edge
+    // fluxes as the wavefronts advance.
+    #pragma omp for
+    for (int a = 0; a < number_angles; ++a)
     {
-      phi[i] += phi_local[i];
+      equation[a].set_cell_xs(d_cell_xs);
+      equation[a].setup_group(d_g);
+      equation[a].setup_octant(o);
+      equation[a].setup_angle(a);
+      d_sweepsource->source(d_g, o, a, source[a]);
+      if (d_update_boundary) b.update(d_g, o, a);
+      if (d_update_psi)
+        psi[a] = d_state->psi(d_g, o, a, d_wavefront_psi_buffers[a]);
+      psi_v[a] = b(face_V_o, o, a, d_g);
+      psi_h[a] = b(face_H_o, o, a, d_g);
+      psi_v[a].assign(b(face_V_i, o, a, d_g));
+      psi_h[a].assign(b(face_H_i, o, a, d_g));
     }
+
+    // Sweep-ordered index to actual index.
+    const int i0 = d_space_ranges[o][0][0];
+    const int di = d_space_ranges[o][0][1];
+    const int j0 = d_space_ranges[o][1][0];
+    const int dj = d_space_ranges[o][1][1];
+
+    // Pipeline the angles through the wavefronts.
+    for (int stage = 0; stage < number_wavefronts + number_angles - 1; ++stage)
+    {
+      int a_lo = std::max(0, stage - number_wavefronts + 1);
+      int a_hi = std::min(number_angles - 1, stage);
+      for (int a = a_lo; a <= a_hi; ++a)
+      {
+        const int w = stage - a;
+
+        // Cells on a wavefront are independent.  Threads finished with
+        // this angle move on to the next one in the stage.
+        #pragma omp for nowait
+        for (int c = d_wavefront_offsets[w]; c < d_wavefront_offsets[w+1]; ++c)
+        {
+          const int i = i0 + di * (d_wavefront_cells[c] % nx);
+          const int j = j0 + dj * (d_wavefront_cells[c] / nx);
+
+          Equation<_2D>::face_flux_type psi_in;
+          Equation<_2D>::face_flux_type psi_out;
+          psi_in[Mesh::VERT] = psi_v[a][j];
+          psi_in[Mesh::HORZ] = psi_h[a][i];
+
+          // Solve the equation in this cell.
+          equation[a].solve(i, j, 0, source[a], psi_in, psi_out, phi, psi[a]);
+
+          // Save the edge fluxes for the next wavefront.
+          psi_v[a][j] = psi_out[Mesh::VERT];
+          psi_h[a][i] = psi_out[Mesh::HORZ];
+        }
+
+      } // end angle loop
+
+      #pragma omp barrier
+
+    } // end stage loop
+
+    // Write back psi.
+    if (d_update_psi)
+    {
+      #pragma omp for
+      for (int a = 0; a < number_angles; ++a)
+        d_state->store_psi(d_g, o, a, psi[a]);
+    }
+
+  } // end octant loop
+
+  } // end omp parallel
+
+  d_number_sweeps++;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper2D<EQ>::setup_wavefront_storage()
+{
+  const size_t number_angles = d_quadrature->number_angles_octant();
+  if (d_wavefront_equations.size() == number_angles &&
+      d_wavefront_update_psi == d_update_psi)
+  {
+    return;
   }
-#endif
+  d_wavefront_equations.assign(number_angles,
+    Equation_T(d_mesh, d_material, d_quadrature, d_update_psi));
+  d_wavefront_sources.assign(number_angles,
+    SweepSource<_2D>::sweep_source_type(d_mesh->number_cells(), 0.0));
+  d_wavefront_psi_v.resize(number_angles);
+  d_wavefront_psi_h.resize(number_angles);
+  d_wavefront_psi.resize(number_angles);
+  d_wavefront_psi_buffers.resize(number_angles);
+  d_wavefront_update_psi = d_update_psi;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline bool Sweeper2D<EQ>::angle_batch_available()
+{
+  return false;
+}
+
+//---------------------------------------------------------------------------//
+template <>
+inline bool Sweeper2D<Equation_DD_2D>::angle_batch_available()
+{
+  return true;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper2D<EQ>::sweep_angle_batch(moments_type &phi)
+{
+  THROW("Angle-batched sweeps are only available for diamond difference.");
+}
+
+//---------------------------------------------------------------------------//
+template <>
+inline void Sweeper2D<Equation_DD_2D>::sweep_angle_batch(moments_type &phi)
+{
+  // Reset the flux moments
+  phi.assign(phi.size(), 0.0);
+
+  const int number_angles     = d_quadrature->number_angles_octant();
+  const int number_wavefronts = d_wavefront_offsets.size() - 1;
+  const int number_cells      = d_mesh->number_cells();
+  const int nx                = d_mesh->number_cells_x();
+  const int ny                = d_mesh->number_cells_y();
+
+  // The batched solve is read-only on the equation, so one is shared.
+  Equation_DD_2D equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.set_cell_xs(d_cell_xs);
+  equation.setup_group(d_g);
+
+  // Sources and edge fluxes for all angles, stored [space][angle].
+  detran_utilities::vec_dbl source(number_cells * number_angles, 0.0);
+  detran_utilities::vec_dbl psi_v(ny * number_angles, 0.0);
+  detran_utilities::vec_dbl psi_h(nx * number_angles, 0.0);
+
+  // Angular fluxes of the current octant, if needed, and their staging
+  // buffers.
+  std::vector<State::angular_flux_type> psi(number_angles);
+  std::vector<State::vec_dbl> psi_buffer(number_angles);
+
+  // Reference to boundary to simplify clutter.
+  Boundary_T &b = *d_boundary;
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Cell-center angular fluxes for one cell.
+  detran_utilities::vec_dbl psi_cell(number_angles, 0.0);
+
+  // Sweep source for one angle.
+  SweepSource<_2D>::sweep_source_type source_a(number_cells, 0.0);
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 4; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+
+    // Gather the sources for all angles and update the boundary.
+    #pragma omp for
+    for (int a = 0; a < number_angles; ++a)
+    {
+      d_sweepsource->source(d_g, o, a, source_a);
+      for (int cell = 0; cell < number_cells; ++cell)
+        source[cell * number_angles + a] = source_a[cell];
+      if (d_update_boundary) b.update(d_g, o, a);
+      if (d_update_psi) psi[a] = d_state->psi(d_g, o, a, psi_buffer[a]);
+    }
+
+    // Gather the incident edge fluxes.
+    #pragma omp single
+    {
+      b.octant_psi(d_face_index[o][Mesh::VERT][Boundary_T::IN],
+                   o, d_g, &psi_v[0], Boundary_T::GET);
+      b.octant_psi(d_face_index[o][Mesh::HORZ][Boundary_T::IN],
+                   o, d_g, &psi_h[0], Boundary_T::GET);
+    }
+
+    // Sweep-ordered index to actual index.
+    const int i0 = d_space_ranges[o][0][0];
+    const int di = d_space_ranges[o][0][1];
+    const int j0 = d_space_ranges[o][1][0];
+    const int dj = d_space_ranges[o][1][1];
+
+    for (int w = 0; w < number_wavefronts; ++w)
+    {
+      // Cells on a wavefront are independent and share no edges.
+      #pragma omp for
+      for (int c = d_wavefront_offsets[w]; c < d_wavefront_offsets[w+1]; ++c)
+      {
+        const int i = i0 + di * (d_wavefront_cells[c] % nx);
+        const int j = j0 + dj * (d_wavefront_cells[c] / nx);
+        const int cell = d_mesh->index(i, j);
+
+        phi[cell] += equation.solve_angles(i, j,
+                                           &source[cell * number_angles],
+                                           &psi_v[j * number_angles],
+                                           &psi_h[i * number_angles],
+                                           &psi_cell[0]);
+
+        if (d_update_psi)
+          for (int a = 0; a < number_angles; ++a)
+            psi[a][cell] = psi_cell[a];
+      }
+    }
+
+    // Update boundary
+    #pragma omp single
+    {
+      b.octant_psi(d_face_index[o][Mesh::VERT][Boundary_T::OUT],
+                   o, d_g, &psi_v[0], Boundary_T::SET);
+      b.octant_psi(d_face_index[o][Mesh::HORZ][Boundary_T::OUT],
+                   o, d_g, &psi_h[0], Boundary_T::SET);
+    }
+
+    // Write back psi.
+    if (d_update_psi)
+    {
+      #pragma omp for
+      for (int a = 0; a < number_angles; ++a)
+        d_state->store_psi(d_g, o, a, psi[a]);
+    }
+
+  } // end octant loop
 
   } // end omp parallel
 
-  #pragma omp master
+  d_number_sweeps++;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper2D<EQ>::sweep_groups(const size_t g_first,
+                                        State::vec_moments_type &phi)
+{
+  Base::sweep_groups(g_first, phi);
+}
+
+//---------------------------------------------------------------------------//
+template <>
+inline void Sweeper2D<Equation_DD_2D>::sweep_groups(const size_t g_first,
+                                                    State::vec_moments_type &phi)
+{
+  Require(g_first + phi.size() <= d_material->number_groups());
+
+  // Only the per-group sweep tallies the currents.
+  if (d_tally)
   {
-    d_number_sweeps++;
+    Base::sweep_groups(g_first, phi);
+    return;
+  }
+
+  // Sweep the block in pieces of at most the group block size.
+  if (phi.size() > d_group_block || phi.size() < 2)
+  {
+    for (size_t b = 0; b < phi.size(); b += d_group_block)
+    {
+      size_t n = std::min(d_group_block, (size_t)phi.size() - b);
+      State::vec_moments_type phi_b(phi.begin() + b, phi.begin() + b + n);
+      if (n < 2)
+        Base::sweep_groups(g_first + b, phi_b);
+      else
+        sweep_groups(g_first + b, phi_b);
+      for (size_t bb = 0; bb < n; ++bb)
+        phi[b + bb].swap(phi_b[bb]);
+    }
+    return;
   }
+
+  const int number_groups = phi.size();
+  const int number_angles = d_quadrature->number_angles_octant();
+  const int number_cells  = d_mesh->number_cells();
+  const int nx            = d_mesh->number_cells_x();
+  const int ny            = d_mesh->number_cells_y();
+
+  // Total cross sections of the block, stored [cell][group].  Cell cross
+  // sections are updated here, outside of the parallel region.
+  detran_utilities::vec_dbl sigma(number_cells * number_groups, 0.0);
+  detran_geometry::MeshMap mat_map;
+  if (d_cell_xs) d_cell_xs->update();
+  for (int b = 0; b < number_groups; ++b)
+  {
+    const size_t g = g_first + b;
+    const double *sigma_g = d_cell_xs ? d_cell_xs->sigma_t(g) : NULL;
+    if (!sigma_g && !mat_map.valid()) mat_map = d_mesh->material_map();
+    for (int cell = 0; cell < number_cells; ++cell)
+    {
+      sigma[cell * number_groups + b] = sigma_g ? sigma_g[cell] :
+        d_material->sigma_t(mat_map[cell], g);
+    }
+  }
+
+  // Moments of the block, stored [cell][group].
+  moments_type phi_block(number_cells * number_groups, 0.0);
+  for (int g = 0; g < number_groups; ++g)
+    phi[g].resize(number_cells);
+
+  // Reference to boundary to simplify clutter.
+  Boundary_T &b = *d_boundary;
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Get this thread's moments.
+  moments_type &phi_local = thread_phi(phi_block);
+
+  // Only the angle coefficients of the equation are used.
+  Equation_DD_2D equation(d_mesh, d_material, d_quadrature, d_update_psi);
+
+  // Sources and edge fluxes of the block, stored [space][group].
+  detran_utilities::vec_dbl source(number_cells * number_groups, 0.0);
+  detran_utilities::vec_dbl psi_v(number_groups, 0.0);
+  detran_utilities::vec_dbl psi_h(nx * number_groups, 0.0);
+  detran_utilities::vec_dbl psi_cell(number_groups, 0.0);
+
+  // Sweep source for one group.
+  SweepSource<_2D>::sweep_source_type source_g(number_cells, 0.0);
+
+  // Boundary flux and angular flux views of each group, and staging
+  // buffers for the angular fluxes.
+  std::vector<bf_type> psi_v_in(number_groups), psi_v_out(number_groups);
+  std::vector<bf_type> psi_h_in(number_groups), psi_h_out(number_groups);
+  std::vector<State::angular_flux_type> psi(number_groups);
+  std::vector<State::vec_dbl> psi_buffer(number_groups);
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 4; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+
+    // Setup equation for this octant.
+    equation.setup_octant(o);
+
+    // Get face indices
+    const int face_V_i = d_face_index[o][Mesh::VERT][Boundary_T::IN];
+    const int face_H_i = d_face_index[o][Mesh::HORZ][Boundary_T::IN];
+    const int face_V_o = d_face_index[o][Mesh::VERT][Boundary_T::OUT];
+    const int face_H_o = d_face_index[o][Mesh::HORZ][Boundary_T::OUT];
+
+    // Sweep over all angles.
+    #pragma omp for
+    for (int a = 0; a < number_angles; a++)
+    {
+      // Setup equation for this angle.
+      equation.setup_angle(a);
+
+      // Gather the sources and incident horizontal fluxes of each group.
+      for (int g = 0; g < number_groups; ++g)
+      {
+        d_sweepsource->total_scatter_source(g_first + g, o, a, source_g);
+        for (int cell = 0; cell < number_cells; ++cell)
+          source[cell * number_groups + g] = source_g[cell];
+        if (d_update_boundary) b.update(g_first + g, o, a);
+        if (d_update_psi)
+          psi[g] = d_state->psi(g_first + g, o, a, psi_buffer[g]);
+        psi_v_in[g]  = b(face_V_i, o, a, g_first + g);
+        psi_v_out[g] = b(face_V_o, o, a, g_first + g);
+        psi_h_in[g]  = b(face_H_i, o, a, g_first + g);
+        psi_h_out[g] = b(face_H_o, o, a, g_first + g);
+        for (int i = 0; i < nx; ++i)
+          psi_h[i * number_groups + g] = psi_h_in[g][i];
+      }
+
+      // Sweep over all y.
+      int j  = d_space_ranges[o][1][0]; // actual index
+      int dj = d_space_ranges[o][1][1]; // decrement
+      for (int jj = 0; jj < ny; ++jj, j += dj)
+      {
+        for (int g = 0; g < number_groups; ++g)
+          psi_v[g] = psi_v_in[g][j];
+
+        // Sweep over all x.
+        int i  = d_space_ranges[o][0][0]; // actual index
+        int di = d_space_ranges[o][0][1]; // decrement
+        for (int ii = 0; ii < nx; ++ii, i += di)
+        {
+          const int cell = d_mesh->index(i, j);
+
+          // Solve the equation in this cell for all groups.
+          equation.solve_groups(i, j, number_groups,
+                                &sigma[cell * number_groups],
+                                &source[cell * number_groups],
+                                &psi_v[0],
+                                &psi_h[i * number_groups],
+                                &phi_local[cell * number_groups],
+                                &psi_cell[0]);
+
+          if (d_update_psi)
+            for (int g = 0; g < number_groups; ++g)
+              psi[g][cell] = psi_cell[g];
+
+        } // end x loop
+
+        // Save the vertical fluxes.
+        for (int g = 0; g < number_groups; ++g)
+          psi_v_out[g][j] = psi_v[g];
+
+      } // end y loop
+
+      // Save the horizontal fluxes.
+      for (int g = 0; g < number_groups; ++g)
+        for (int i = 0; i < nx; ++i)
+          psi_h_out[g][i] = psi_h[i * number_groups + g];
+
+      // Write back psi.
+      if (d_update_psi)
+        for (int g = 0; g < number_groups; ++g)
+          d_state->store_psi(g_first + g, o, a, psi[g]);
+
+    } // end angle loop
+    // end omp do
+
+  } // end octant loop
+
+  // Sum local thread fluxes.
+  reduce_thread_phi(phi_block);
+
+  // Scatter the block moments back to the groups.
+  #pragma omp for
+  for (int cell = 0; cell < number_cells; ++cell)
+    for (int g = 0; g < number_groups; ++g)
+      phi[g][cell] = phi_block[cell * number_groups + g];
+
+  } // end omp parallel
+
+  d_number_sweeps += number_groups;
 }
 
 } // end namespace detran
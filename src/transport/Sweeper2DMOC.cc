@@ -24,8 +24,139 @@ Sweeper2DMOC<EQ>::Sweeper2DMOC(SP_input input,
                                SP_sweepsource sweepsource)
   : Base(input, mesh, material, quadrature, state, boundary, sweepsource)
   , d_boundary(boundary)
+  , d_cache(false)
+  , d_cache_budget(256.0 * 1048576.0)
+  , d_sweep_tracks(false)
 {
     d_tracks = mesh->tracks();
+    if (!d_tracks->finalized()) d_tracks->finalize();
+
+    // Build the exponential table if requested.
+    if (d_input->check("moc_exp_table") &&
+        d_input->get<int>("moc_exp_table"))
+    {
+      double tolerance = 1.0e-6;
+      if (d_input->check("moc_exp_tolerance"))
+        tolerance = d_input->get<double>("moc_exp_tolerance");
+      d_exp_table = ExpTable::Create(tolerance);
+    }
+
+    // Check whether we cache the segment coefficients.
+    if (d_input->check("moc_segment_cache"))
+      d_cache = (0 != d_input->get<int>("moc_segment_cache"));
+    if (d_input->check("moc_segment_cache_memory"))
+    {
+      d_cache_budget = 1048576.0 *
+        d_input->get<double>("moc_segment_cache_memory");
+    }
+    if (d_cache)
+    {
+      d_coefficients.resize(d_material->number_groups());
+      d_coefficients_sigma.resize(d_material->number_groups());
+    }
+
+    // Check whether we sweep batches of tracks in parallel.
+    if (d_input->check("moc_sweep_tracks"))
+      d_sweep_tracks = (0 != d_input->get<int>("moc_sweep_tracks"));
+    if (d_sweep_tracks)
+    {
+      int batch_segments = 1024;
+      if (d_input->check("moc_track_batch_segments"))
+        batch_segments = d_input->get<int>("moc_track_batch_segments");
+      Insist(batch_segments > 0,
+             "The segments per batch of tracks must be positive.");
+      build_track_batches(batch_segments);
+    }
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+void Sweeper2DMOC<EQ>::setup_group(const size_t g)
+{
+  Base::setup_group(g);
+  if (d_cache) cache_coefficients(g);
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+void Sweeper2DMOC<EQ>::cache_coefficients(const size_t g)
+{
+  Require(g < d_coefficients.size());
+
+  // The cache is valid as long as the total cross sections are unchanged.
+  size_t number_materials = d_material->number_materials();
+  detran_utilities::vec_dbl sigma(number_materials, 0.0);
+  for (size_t m = 0; m < number_materials; ++m)
+    sigma[m] = d_material->sigma_t(m, g);
+  if (!d_coefficients[g].empty() && sigma == d_coefficients_sigma[g])
+    return;
+  d_coefficients[g].clear();
+
+  // Fall back to on-the-fly coefficients if the group does not fit.
+  const int nc = Equation_T::number_coefficients;
+  SP_quadrature q = d_quadrature;
+  const int number_polar = q->number_polar_octant();
+  const int number_segments = d_tracks->number_segments();
+  double bytes = sizeof(double) * nc * number_polar * number_segments;
+  for (size_t gg = 0; gg < d_coefficients.size(); ++gg)
+    bytes += sizeof(double) * d_coefficients[gg].size();
+  if (bytes > d_cache_budget) return;
+
+  // Compute the coefficients for all polar angles and segments.
+  d_coefficients_sigma[g] = sigma;
+  detran_utilities::vec_dbl &c = d_coefficients[g];
+  c.resize(nc * number_polar * number_segments, 0.0);
+  const int    *regions = d_tracks->segment_regions();
+  const double *lengths = d_tracks->segment_lengths();
+  #pragma omp parallel default(shared)
+  {
+    Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+    equation.set_exp_table(d_exp_table);
+    equation.set_cell_xs(d_cell_xs);
+    equation.setup_group(g);
+    for (int p = 0; p < number_polar; ++p)
+    {
+      #pragma omp for nowait
+      for (int s = 0; s < number_segments; ++s)
+      {
+        equation.coefficients(regions[s], lengths[s], p,
+                              &c[nc * (p * number_segments + s)]);
+      }
+    }
+  }
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+void Sweeper2DMOC<EQ>::build_track_batches(const int batch_segments)
+{
+  SP_quadrature q = d_quadrature;
+  d_track_batches.assign(2, vec_int());
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int a = 0; a < q->number_angles_octant(); ++a)
+    {
+      // Octants 1 and 3 use the second set of azimuths.
+      int azimuth = q->azimuth(a) + i * q->number_azimuths_octant();
+      int number_tracks = d_tracks->number_tracks_angle(azimuth);
+      int first = 0;
+      int segments = 0;
+      for (int t = 0; t < number_tracks; ++t)
+      {
+        segments += d_tracks->number_segments(azimuth, t);
+        if (segments >= batch_segments || t == number_tracks - 1)
+        {
+          d_track_batches[i].push_back(a);
+          d_track_batches[i].push_back(first);
+          d_track_batches[i].push_back(t + 1);
+          first = t + 1;
+          segments = 0;
+        }
+      }
+    }
+  }
+  d_angle_source.resize(q->number_angles_octant(),
+                        sweep_source_type(d_mesh->number_cells(), 0.0));
 }
 
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 #define detran_SWEEPER2DMOC_HH_
 
 #include "transport/Sweeper.hh"
+#include "transport/ExpTable.hh"
 #include "angle/QuadratureMOC.hh"
 #include "boundary/BoundaryMOC.hh"
 #include "geometry/MeshMOC.hh"
@@ -23,6 +24,31 @@ namespace detran
 /**
  *  @class Sweeper2DMOC
  *  @brief Sweeper for 2D MOC problems.
+ *
+ *  Relevant input database entries:
+ *    - moc_exp_table [int], 0=evaluate exponentials exactly (default),
+ *      1=interpolate them from a table
+ *    - moc_exp_tolerance [double], maximum interpolation error (1e-6),
+ *      at least ExpTable::MINIMUM_TOLERANCE
+ *    - moc_segment_cache [int], 0=compute segment coefficients on the fly
+ *      (default), 1=cache them for each group at setup_group
+ *    - moc_segment_cache_memory [double], memory budget of the cache in MB
+ *      (256); groups that do not fit are computed on the fly
+ *    - moc_sweep_tracks [int], 0=parallel over the angles of an octant
+ *      (default), 1=parallel over batches of tracks from all angles of
+ *      an octant
+ *    - moc_track_batch_segments [int], approximate number of segments
+ *      in a batch of tracks (1024)
+ *
+ *  When sweeping by tracks, the octants are still swept in order, since
+ *  reflective boundaries couple them, but all azimuths and polar angles
+ *  of an octant are swept at once.  The tracks of each angle are split
+ *  into batches holding about the same number of segments, and the
+ *  batches are dealt to the threads round robin.  Each thread tallies
+ *  the scalar flux into its own buffer, and the buffers are summed after
+ *  the sweep, so no critical section is needed.  Track sweeps do not
+ *  update the angular flux; if it is requested, the angles are swept as
+ *  usual.
  */
 
 template <class EQ>
@@ -55,6 +81,8 @@ public:
   typedef detran_angle::QuadratureMOC::SP_quadrature    SP_quadrature;
   typedef detran_geometry::TrackDB::SP_trackdb          SP_trackdb;
   typedef detran_geometry::Track::SP_track              SP_track;
+  typedef ExpTable::SP_exptable                         SP_exptable;
+  typedef SweepSource<_2D>::sweep_source_type           sweep_source_type;
 
   //-------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -98,6 +126,13 @@ public:
   /// Sweep.
   inline void sweep(moments_type &phi);
 
+  //-------------------------------------------------------------------------//
+  // PUBLIC FUNCTIONS
+  //-------------------------------------------------------------------------//
+
+  /// Setup the group, building its segment coefficient cache if requested.
+  void setup_group(const size_t g);
+
 private:
 
   //-------------------------------------------------------------------------//
@@ -108,6 +143,36 @@ private:
   SP_boundary d_boundary;
   // Track database
   SP_trackdb d_tracks;
+  // Exponential table, if used
+  SP_exptable d_exp_table;
+  // Cache the segment coefficients?
+  bool d_cache;
+  // Memory budget for the cache in bytes
+  double d_cache_budget;
+  // Cached segment coefficients by group, [g][polar][segment][coef]
+  std::vector<detran_utilities::vec_dbl> d_coefficients;
+  // Total cross sections by material used to build each group's cache
+  detran_utilities::vec2_dbl d_coefficients_sigma;
+  // Sweep batches of tracks in parallel?
+  bool d_sweep_tracks;
+  // Batches of tracks for octants 0 and 2 [0] and 1 and 3 [1], each as
+  // (angle in octant, first track, one past the last track)
+  vec2_int d_track_batches;
+  // Sweep sources of all angles in an octant
+  std::vector<sweep_source_type> d_angle_source;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Build the cached coefficients for a group, unless still valid.
+  void cache_coefficients(const size_t g);
+
+  /// Split the tracks of each angle into batches of about equal segments.
+  void build_track_batches(const int batch_segments);
+
+  /// Sweep batches of tracks in parallel.
+  inline void sweep_tracks(moments_type &phi);
 
 };
 
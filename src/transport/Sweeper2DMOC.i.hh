@@ -26,28 +26,34 @@ inline void Sweeper2DMOC<EQ>::sweep(moments_type &phi)
   using std::cout;
   using std::endl;
 
+  // Sweep batches of tracks if requested.
+  if (d_sweep_tracks && !d_update_psi)
+  {
+    sweep_tracks(phi);
+    return;
+  }
+
   // Reset the flux moments
   phi.assign(phi.size(), 0.0);
 
-#ifdef DETRAN_ENABLE_OPENMP
-  moments_type phi_local;
-#else
-  moments_type &phi_local = phi;
-#endif
-
-  #pragma omp parallel default(shared) private(phi_local)
+  #pragma omp parallel default(shared)
   {
 
+  // Get this thread's moments.
+  moments_type &phi_local = thread_phi(phi);
+
   // Initialize equation and setup for this group.
   Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.set_exp_table(d_exp_table);
+  equation.set_cell_xs(d_cell_xs);
   equation.setup_group(d_g);
 
-  // Reset the flux moments
-  phi_local.resize(d_mesh->number_cells(), 0.0);
-
   // Initialize discrete sweep source vector.
   SweepSource<_2D>::sweep_source_type source(d_mesh->number_cells(), 0.0);
 
+  // Staging buffer for an angular flux stored in single precision.
+  State::vec_dbl psi_buffer;
+
   double psi_in  = 0;
   double psi_out = 0;
 
@@ -104,34 +110,36 @@ inline void Sweeper2DMOC<EQ>::sweep(moments_type &phi)
       // Get sweep source for this angle.
       d_sweepsource->source(d_g, o, a, source);
 
-      // Get psi if update requested.
+      // Get psi if update requested.  Segments accumulate into psi, so it
+      // starts from zero.
       State::angular_flux_type psi;
-      if (d_update_psi) psi = d_state->psi(d_g, o, a);
+      if (d_update_psi)
+      {
+        psi = d_state->psi(d_g, o, a, psi_buffer);
+        for (size_t i = 0; i < psi.size(); ++i)
+          psi[i] = 0.0;
+      }
 
       // Update the boundary for this angle.
       if (d_update_boundary) d_boundary->update(d_g, o, a);
 
+      // Contiguous segment data.
+      const int    *regions = d_tracks->segment_regions();
+      const double *lengths = d_tracks->segment_lengths();
+
+      // Cached segment coefficients for this polar angle, if available.
+      const int nc = Equation_T::number_coefficients;
+      const int number_segments = d_tracks->number_segments();
+      const double *coefs = 0;
+      if (d_cache && !d_coefficients[d_g].empty())
+        coefs = &d_coefficients[d_g][nc * polar * number_segments];
+
       // Sweep over all tracks.
       for (int t = 0; t < d_tracks->number_tracks_angle(azimuth); t++)
       {
-//        if (!track_reverse)
-//          cout << "    TRACK: " << t << endl;
-//        else
-//          cout << "    TRACK: " << t << " in REVERSE" << endl;
-        // Get track.
-        SP_track track = d_tracks->track(azimuth, t);
-
         // *** LOAD THE BOUNDARY FLUX.
-//        if (o == 0)
-//          psi_out = 1.0 + 4*o + t;
-//        else
         psi_out = (*d_boundary)(d_g, o, a, BoundaryMOC<_2D>::IN, t);
 
-//        cout << " OCTANT = " << o << endl;
-//        cout << "   ANGLE = " << a << endl;
-//        cout << "     TRACK = " << t << endl;
-//        cout << "       psi_in = " << psi_out << endl;
-
         // SN access
         // boundary_flux_type psi_v = (*d_boundary)
         //   (d_face_index[o][Mesh::VERT][Boundary_T::IN], o, a, d_g);
@@ -141,31 +149,33 @@ inline void Sweeper2DMOC<EQ>::sweep(moments_type &phi)
         // --> ergo, the side really needn't be part of the storage
         // --> create index maps for which track is on a side, etc.
 
-
-        //cout << "      PSI_IN: " << psi_out << endl;
+        // The track's segments, walked backward for reversed tracks.
+        int number_segments = d_tracks->number_segments(azimuth, t);
+        int s  = d_tracks->segment_offset(azimuth, t);
+        int ds = 1;
+        if (track_reverse)
+        {
+          s += number_segments - 1;
+          ds = -1;
+        }
 
         // Sweep all segments on the track.
-        int s = 0;
-        for (int ss = 0; ss < track->number_segments(); ss++)
+        for (int ss = 0; ss < number_segments; ss++, s += ds)
         {
-          s = ss;
-          if (track_reverse) s = track->number_segments() - ss - 1;
-
-          //cout << "      SEGMENT: " << s << endl;
-
           // Update track angular flux
           psi_in = psi_out;
 
-          // Get segment region.
-          int region = track->segment(s).region();
-
-          // Get segment length.
-          double length = track->segment(s).length();
-
           // Solve.
-          equation.solve(region, length, source, psi_in, psi_out, phi_local, psi);
-
-          //cout << "        PSI_OUT: " << psi_out << endl;
+          if (coefs)
+          {
+            equation.solve(regions[s], lengths[s], &coefs[nc * s], source,
+                           psi_in, psi_out, phi_local, psi);
+          }
+          else
+          {
+            equation.solve(regions[s], lengths[s], source,
+                           psi_in, psi_out, phi_local, psi);
+          }
 
         } // end segment
 
@@ -176,23 +186,16 @@ inline void Sweeper2DMOC<EQ>::sweep(moments_type &phi)
 
       } // end track
 
-
+      // Write back psi.
+      if (d_update_psi) d_state->store_psi(d_g, o, a, psi);
 
     } // end angle loop
     // end omp do
 
   } // end octant loop
 
-#ifdef DETRAN_ENABLE_OPENMP
   // Sum local thread fluxes.
-  #pragma omp critical
-  {
-    for (int i = 0; i < d_mesh->number_cells(); i++)
-    {
-      phi[i] += phi_local[i];
-    }
-  }
-#endif
+  reduce_thread_phi(phi);
 
   } // end omp parallel
 
@@ -203,6 +206,121 @@ inline void Sweeper2DMOC<EQ>::sweep(moments_type &phi)
   return;
 }
 
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper2DMOC<EQ>::sweep_tracks(moments_type &phi)
+{
+  Require(d_track_batches.size() == 2);
+
+  // Reset the flux moments
+  phi.assign(phi.size(), 0.0);
+
+  SP_quadrature q = d_quadrature;
+
+  // Contiguous segment data.
+  const int    *regions = d_tracks->segment_regions();
+  const double *lengths = d_tracks->segment_lengths();
+  const int nc = Equation_T::number_coefficients;
+  const int number_segments = d_tracks->number_segments();
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Get this thread's moments.
+  moments_type &phi_local = thread_phi(phi);
+
+  // Initialize equation and setup for this group.
+  Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.set_exp_table(d_exp_table);
+  equation.set_cell_xs(d_cell_xs);
+  equation.setup_group(d_g);
+
+  // Unused, since the angular flux is not updated.
+  State::angular_flux_type psi;
+
+  // Sweep over all octants.
+  for (size_t oo = 0; oo < 4; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+    equation.setup_octant(o);
+
+    // Octants 1 and 3 use the second set of azimuths, and octants 2 and
+    // 3 walk the tracks backward.
+    // \todo Adjoint sweeps should probably be controlled here
+    const vec_int &batches = d_track_batches[o % 2];
+    const bool track_reverse = o >= 2;
+
+    // Sources and incident boundary fluxes of all angles.
+    #pragma omp for
+    for (int a = 0; a < q->number_angles_octant(); ++a)
+    {
+      d_sweepsource->source(d_g, o, a, d_angle_source[a]);
+      if (d_update_boundary) d_boundary->update(d_g, o, a);
+    }
+
+    // Sweep over all batches of tracks.
+    const int number_batches = batches.size() / 3;
+    #pragma omp for schedule(static, 1)
+    for (int b = 0; b < number_batches; ++b)
+    {
+      size_t a       = batches[3 * b];
+      size_t polar   = q->polar(a);
+      size_t azimuth = q->azimuth(a);
+      equation.setup_azimuth(azimuth);
+      equation.setup_polar(polar);
+      azimuth += (o % 2) * q->number_azimuths_octant();
+      sweep_source_type &source = d_angle_source[a];
+
+      // Cached segment coefficients for this polar angle, if available.
+      const double *coefs = 0;
+      if (d_cache && !d_coefficients[d_g].empty())
+        coefs = &d_coefficients[d_g][nc * polar * number_segments];
+
+      for (int t = batches[3 * b + 1]; t < batches[3 * b + 2]; ++t)
+      {
+        double psi_out = (*d_boundary)(d_g, o, a, BoundaryMOC<_2D>::IN, t);
+        double psi_in  = 0.0;
+
+        // The track's segments, walked backward for reversed tracks.
+        int number_segments_track = d_tracks->number_segments(azimuth, t);
+        int s  = d_tracks->segment_offset(azimuth, t);
+        int ds = 1;
+        if (track_reverse)
+        {
+          s += number_segments_track - 1;
+          ds = -1;
+        }
+
+        // Sweep all segments on the track.
+        for (int ss = 0; ss < number_segments_track; ss++, s += ds)
+        {
+          psi_in = psi_out;
+          if (coefs)
+          {
+            equation.solve(regions[s], lengths[s], &coefs[nc * s], source,
+                           psi_in, psi_out, phi_local, psi);
+          }
+          else
+          {
+            equation.solve(regions[s], lengths[s], source,
+                           psi_in, psi_out, phi_local, psi);
+          }
+        }
+
+        (*d_boundary)(d_g, o, a, BoundaryMOC<_2D>::OUT, t) = psi_out;
+      } // end track
+    } // end batch
+
+  } // end octant loop
+
+  // Sum local thread fluxes.
+  reduce_thread_phi(phi);
+
+  } // end omp parallel
+
+  d_number_sweeps++;
+}
+
 } // end namespace detran
 
 #endif /* detran_SWEEPER2DMOC_I_HH_ */
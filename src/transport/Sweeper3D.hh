@@ -49,7 +49,7 @@ public:
   typedef EQ                                        Equation_T;
   typedef BoundarySN<_3D>                           Boundary_T;
   typedef typename Boundary_T::SP_boundary          SP_boundary;
-  typedef typename BoundaryTraits<_3D>::value_type  bf_type;
+  typedef typename BoundaryTraits<_3D>::view_type   bf_type;
 
   //-------------------------------------------------------------------------//
   // CONSTRUCTOR & DESTRUCTOR
@@ -100,6 +100,35 @@ private:
   //-------------------------------------------------------------------------//
 
   SP_boundary d_boundary;
+  /// Equations of the wavefront sweep, one per angle of an octant
+  std::vector<Equation_T> d_wavefront_equations;
+  /// Sweep sources of the wavefront sweep, one per angle
+  std::vector<SweepSource<_3D>::sweep_source_type> d_wavefront_sources;
+  /// Face flux views of the wavefront sweep, one per angle
+  std::vector<bf_type> d_wavefront_psi_yz;
+  std::vector<bf_type> d_wavefront_psi_xz;
+  std::vector<bf_type> d_wavefront_psi_xy;
+  /// Angular flux views of the wavefront sweep and their staging buffers
+  std::vector<angular_flux_type> d_wavefront_psi;
+  std::vector<State::vec_dbl> d_wavefront_psi_buffers;
+  /// Angular flux flag with which the wavefront equations were built
+  bool d_wavefront_update_psi;
+
+  //-------------------------------------------------------------------------//
+  // IMPLEMENTATION
+  //-------------------------------------------------------------------------//
+
+  /// Sweep over diagonal wavefront planes.  @sa Sweeper2D::sweep_wavefront
+  inline void sweep_wavefront(moments_type &phi);
+
+  /// Size the wavefront storage.  @sa Sweeper2D::setup_wavefront_storage
+  inline void setup_wavefront_storage();
+
+  /// Sweep with all angles batched.  @sa Sweeper2D::sweep_angle_batch
+  inline void sweep_angle_batch(moments_type &phi);
+
+  /// Whether the equation provides the angle-batched kernel
+  inline static bool angle_batch_available();
 
 };
 
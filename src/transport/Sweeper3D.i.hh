@@ -10,6 +10,8 @@
 #ifndef detran_SWEEPER3D_I_HH_
 #define detran_SWEEPER3D_I_HH_
 
+#include "transport/Equation_DD_3D.hh"
+#include <algorithm>
 #include <iostream>
 #ifdef DETRAN_ENABLE_OPENMP
 #include <omp.h>
@@ -25,28 +27,41 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
   using std::cout;
   using std::endl;
 
-  // Reset the flux moments
-  phi.assign(phi.size(), 0.0);
+  // Sweep with batched angles if requested.
+  if (d_angle_batch && !d_tally)
+  {
+    sweep_angle_batch(phi);
+    return;
+  }
 
-#ifdef DETRAN_ENABLE_OPENMP
-  moments_type phi_local;
-#else
-  moments_type &phi_local = phi;
-#endif
+  // Sweep over spatial wavefronts if requested.
+  if (d_wavefront && !d_tally)
+  {
+    sweep_wavefront(phi);
+    return;
+  }
 
-  #pragma omp parallel default(shared) private(phi_local)
+  // Reset the flux moments and the group's currents
+  phi.assign(phi.size(), 0.0);
+  if (d_tally) d_tally->reset(d_g);
+
+  #pragma omp parallel default(shared)
   {
 
+  // Get this thread's moments.
+  moments_type &phi_local = thread_phi(phi);
+
   // Initialize equation and setup for this group.
   Equation_T equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.set_cell_xs(d_cell_xs);
   equation.setup_group(d_g);
 
-  // Reset the flux moments
-  phi_local.resize(d_mesh->number_cells(), 0.0);
-
   // Initialize discrete sweep source vector.
   SweepSource<_3D>::sweep_source_type source(d_mesh->number_cells(), 0.0);
 
+  // Staging buffer for an angular flux stored in single precision.
+  State::vec_dbl psi_buffer;
+
   // Reference to boundary to simplify clutter.
   Boundary_T &b = *d_boundary;
 
@@ -70,15 +85,25 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
 
       // Get psi if update requested.
       State::angular_flux_type psi;
-      if (d_update_psi) psi = d_state->psi(d_g, o, a);
+      if (d_update_psi) psi = d_state->psi(d_g, o, a, psi_buffer);
 
       // Update the boundary for this angle.
       if (d_update_boundary) b.update(d_g, o, a);
 
-      // Get boundary fluxes.
-      bf_type psi_yz = b(d_face_index[o][Mesh::YZ][Boundary_T::IN], o, a, d_g);
-      bf_type psi_xz = b(d_face_index[o][Mesh::XZ][Boundary_T::IN], o, a, d_g);
-      bf_type psi_xy = b(d_face_index[o][Mesh::XY][Boundary_T::IN], o, a, d_g);
+      // Get views of the incident and outgoing boundary fluxes.  The
+      // outgoing sides hold the face fluxes as the sweep proceeds.
+      const bf_type psi_yz_in =
+        b(d_face_index[o][Mesh::YZ][Boundary_T::IN], o, a, d_g);
+      const bf_type psi_xz_in =
+        b(d_face_index[o][Mesh::XZ][Boundary_T::IN], o, a, d_g);
+      const bf_type psi_xy_in =
+        b(d_face_index[o][Mesh::XY][Boundary_T::IN], o, a, d_g);
+      const bf_type psi_yz =
+        b(d_face_index[o][Mesh::YZ][Boundary_T::OUT], o, a, d_g);
+      const bf_type psi_xz =
+        b(d_face_index[o][Mesh::XZ][Boundary_T::OUT], o, a, d_g);
+      const bf_type psi_xy =
+        b(d_face_index[o][Mesh::XY][Boundary_T::OUT], o, a, d_g);
 
       // Temporary edge fluxes.
       Equation<_3D>::face_flux_type psi_in  = { 0.0, 0.0, 0.0 };
@@ -89,6 +114,8 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
       int dk = d_space_ranges[o][2][1];
       for (size_t kk = 0; kk < d_mesh->number_cells_z(); ++kk, k += dk)
       {
+        // The first plane reads the incident xy fluxes.
+        const bf_type &psi_xy_last = kk ? psi_xy : psi_xy_in;
 
         // Sweep over all y
         int j  = d_space_ranges[o][1][0];
@@ -96,7 +123,13 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
         for (size_t jj = 0; jj < d_mesh->number_cells_y(); ++jj, j += dj)
         {
 
-          psi_out[Mesh::YZ] = psi_yz[k][j];
+          psi_out[Mesh::YZ] = psi_yz_in[k][j];
+
+          // The first row reads the incident xz fluxes.
+          const BoundaryLineView xz_last = jj ? psi_xz[k] : psi_xz_in[k];
+          const BoundaryLineView xz      = psi_xz[k];
+          const BoundaryLineView xy_last = psi_xy_last[j];
+          const BoundaryLineView xy      = psi_xy[j];
 
           // Sweep over all x
           size_t i  = d_space_ranges[o][0][0];
@@ -104,17 +137,35 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
           for (size_t ii = 0; ii < d_mesh->number_cells_x(); ++ii, i += di)
           {
             psi_in[Mesh::YZ] = psi_out[Mesh::YZ];
-            psi_in[Mesh::XZ] = psi_xz[k][i];
-            psi_in[Mesh::XY] = psi_xy[j][i];
+            psi_in[Mesh::XZ] = xz_last[i];
+            psi_in[Mesh::XY] = xy_last[i];
+
+            // Tally the incident boundary fluxes.
+            if (d_tally && !ii)
+            {
+              d_tally->tally(i, j, k, d_g, o, a, Tally_T::X_DIRECTED,
+                             psi_in[Mesh::YZ]);
+            }
+            if (d_tally && !jj)
+            {
+              d_tally->tally(i, j, k, d_g, o, a, Tally_T::Y_DIRECTED,
+                             psi_in[Mesh::XZ]);
+            }
+            if (d_tally && !kk)
+            {
+              d_tally->tally(i, j, k, d_g, o, a, Tally_T::Z_DIRECTED,
+                             psi_in[Mesh::XY]);
+            }
 
             // Solve.
-            equation.solve(i, j, k, source, psi_in, psi_out, phi, psi);
+            equation.solve(i, j, k, source, psi_in, psi_out, phi_local, psi);
 
             // Save the horizontal flux.
-            psi_xz[k][i] = psi_out[Mesh::XZ];
-            psi_xy[j][i] = psi_out[Mesh::XY];
+            xz[i] = psi_out[Mesh::XZ];
+            xy[i] = psi_out[Mesh::XY];
 
-            // INSERT ACCELERATION MESH STUFF HERE
+            // Tally the outgoing cell fluxes.
+            if (d_tally) d_tally->tally(i, j, k, d_g, o, a, psi_out);
 
           } // end x loop
 
@@ -124,28 +175,15 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
         } // end y loop
       } // end z loop
 
-      // Update boundary
-      b(d_face_index[o][Mesh::YZ][Boundary_T::OUT], o, a, d_g) = psi_yz;
-      b(d_face_index[o][Mesh::XZ][Boundary_T::OUT], o, a, d_g) = psi_xz;
-      b(d_face_index[o][Mesh::XY][Boundary_T::OUT], o, a, d_g) = psi_xy;
-
-      // Angular flux update
-      if (d_update_psi) d_state->psi(d_g, o, a) = psi;
+      // Write back psi.
+      if (d_update_psi) d_state->store_psi(d_g, o, a, psi);
 
     } // end angle loop
 
   } // end octant loop
 
-#ifdef DETRAN_ENABLE_OPENMP
   // Sum local thread fluxes.
-  #pragma omp critical
-  {
-    for (int i = 0; i < d_mesh->number_cells(); i++)
-    {
-      phi[i] += phi_local[i];
-    }
-  }
-#endif
+  reduce_thread_phi(phi);
 
   } // end omp parallel
 
@@ -157,6 +195,293 @@ inline void Sweeper3D<EQ>::sweep(moments_type &phi)
   return;
 }
 
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper3D<EQ>::sweep_wavefront(moments_type &phi)
+{
+  // Reset the flux moments
+  phi.assign(phi.size(), 0.0);
+
+  const int number_angles     = d_quadrature->number_angles_octant();
+  const int number_wavefronts = d_wavefront_offsets.size() - 1;
+  const int nx                = d_mesh->number_cells_x();
+  const int ny                = d_mesh->number_cells_y();
+
+  // Equations, sources, and face flux views for all angles in an octant.
+  setup_wavefront_storage();
+  std::vector<Equation_T> &equation = d_wavefront_equations;
+  std::vector<SweepSource<_3D>::sweep_source_type> &source =
+    d_wavefront_sources;
+  std::vector<bf_type> &psi_yz = d_wavefront_psi_yz;
+  std::vector<bf_type> &psi_xz = d_wavefront_psi_xz;
+  std::vector<bf_type> &psi_xy = d_wavefront_psi_xy;
+  std::vector<angular_flux_type> &psi = d_wavefront_psi;
+
+  // Reference to boundary to simplify clutter.
+  Boundary_T &b = *d_boundary;
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 8; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+
+    // Setup the equation, source, and incident fluxes for each angle.  The
+    // outgoing sides start from the incident fluxes and hold the face
+    // fluxes as the wavefronts advance.
+    #pragma omp for
+    for (int a = 0; a < number_angles; ++a)
+    {
+      equation[a].set_cell_xs(d_cell_xs);
+      equation[a].setup_group(d_g);
+      equation[a].setup_octant(o);
+      equation[a].setup_angle(a);
+      d_sweepsource->source(d_g, o, a, source[a]);
+      if (d_update_boundary) b.update(d_g, o, a);
+      if (d_update_psi)
+        psi[a] = d_state->psi(d_g, o, a, d_wavefront_psi_buffers[a]);
+      psi_yz[a] = b(d_face_index[o][Mesh::YZ][Boundary_T::OUT], o, a, d_g);
+      psi_xz[a] = b(d_face_index[o][Mesh::XZ][Boundary_T::OUT], o, a, d_g);
+      psi_xy[a] = b(d_face_index[o][Mesh::XY][Boundary_T::OUT], o, a, d_g);
+      psi_yz[a].assign(b(d_face_index[o][Mesh::YZ][Boundary_T::IN], o, a, d_g));
+      psi_xz[a].assign(b(d_face_index[o][Mesh::XZ][Boundary_T::IN], o, a, d_g));
+      psi_xy[a].assign(b(d_face_index[o][Mesh::XY][Boundary_T::IN], o, a, d_g));
+    }
+
+    // Sweep-ordered index to actual index.
+    const int i0 = d_space_ranges[o][0][0];
+    const int di = d_space_ranges[o][0][1];
+    const int j0 = d_space_ranges[o][1][0];
+    const int dj = d_space_ranges[o][1][1];
+    const int k0 = d_space_ranges[o][2][0];
+    const int dk = d_space_ranges[o][2][1];
+
+    // Pipeline the angles through the wavefronts.
+    for (int stage = 0; stage < number_wavefronts + number_angles - 1; ++stage)
+    {
+      int a_lo = std::max(0, stage - number_wavefronts + 1);
+      int a_hi = std::min(number_angles - 1, stage);
+      for (int a = a_lo; a <= a_hi; ++a)
+      {
+        const int w = stage - a;
+
+        #pragma omp for nowait
+        for (int c = d_wavefront_offsets[w]; c < d_wavefront_offsets[w+1]; ++c)
+        {
+          const int cell = d_wavefront_cells[c];
+          const int i = i0 + di * (cell % nx);
+          const int j = j0 + dj * ((cell / nx) % ny);
+          const int k = k0 + dk * (cell / (nx * ny));
+
+          Equation<_3D>::face_flux_type psi_in;
+          Equation<_3D>::face_flux_type psi_out;
+          psi_in[Mesh::YZ] = psi_yz[a][k][j];
+          psi_in[Mesh::XZ] = psi_xz[a][k][i];
+          psi_in[Mesh::XY] = psi_xy[a][j][i];
+
+          // Solve.
+          equation[a].solve(i, j, k, source[a], psi_in, psi_out, phi, psi[a]);
+
+          // Save the face fluxes for the next wavefront.
+          psi_yz[a][k][j] = psi_out[Mesh::YZ];
+          psi_xz[a][k][i] = psi_out[Mesh::XZ];
+          psi_xy[a][j][i] = psi_out[Mesh::XY];
+        }
+
+      } // end angle loop
+
+      #pragma omp barrier
+
+    } // end stage loop
+
+    // Write back psi.
+    if (d_update_psi)
+    {
+      #pragma omp for
+      for (int a = 0; a < number_angles; ++a)
+        d_state->store_psi(d_g, o, a, psi[a]);
+    }
+
+  } // end octant loop
+
+  } // end omp parallel
+
+  d_number_sweeps++;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper3D<EQ>::setup_wavefront_storage()
+{
+  const size_t number_angles = d_quadrature->number_angles_octant();
+  if (d_wavefront_equations.size() == number_angles &&
+      d_wavefront_update_psi == d_update_psi)
+  {
+    return;
+  }
+  d_wavefront_equations.assign(number_angles,
+    Equation_T(d_mesh, d_material, d_quadrature, d_update_psi));
+  d_wavefront_sources.assign(number_angles,
+    SweepSource<_3D>::sweep_source_type(d_mesh->number_cells(), 0.0));
+  d_wavefront_psi_yz.resize(number_angles);
+  d_wavefront_psi_xz.resize(number_angles);
+  d_wavefront_psi_xy.resize(number_angles);
+  d_wavefront_psi.resize(number_angles);
+  d_wavefront_psi_buffers.resize(number_angles);
+  d_wavefront_update_psi = d_update_psi;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline bool Sweeper3D<EQ>::angle_batch_available()
+{
+  return false;
+}
+
+//---------------------------------------------------------------------------//
+template <>
+inline bool Sweeper3D<Equation_DD_3D>::angle_batch_available()
+{
+  return true;
+}
+
+//---------------------------------------------------------------------------//
+template <class EQ>
+inline void Sweeper3D<EQ>::sweep_angle_batch(moments_type &phi)
+{
+  THROW("Angle-batched sweeps are only available for diamond difference.");
+}
+
+//---------------------------------------------------------------------------//
+template <>
+inline void Sweeper3D<Equation_DD_3D>::sweep_angle_batch(moments_type &phi)
+{
+  // Reset the flux moments
+  phi.assign(phi.size(), 0.0);
+
+  const int number_angles     = d_quadrature->number_angles_octant();
+  const int number_wavefronts = d_wavefront_offsets.size() - 1;
+  const int number_cells      = d_mesh->number_cells();
+  const int nx                = d_mesh->number_cells_x();
+  const int ny                = d_mesh->number_cells_y();
+  const int nz                = d_mesh->number_cells_z();
+
+  // The batched solve is read-only on the equation, so one is shared.
+  Equation_DD_3D equation(d_mesh, d_material, d_quadrature, d_update_psi);
+  equation.set_cell_xs(d_cell_xs);
+  equation.setup_group(d_g);
+
+  // Sources and face fluxes for all angles, stored [space][angle].
+  detran_utilities::vec_dbl source(number_cells * number_angles, 0.0);
+  detran_utilities::vec_dbl psi_yz(nz * ny * number_angles, 0.0);
+  detran_utilities::vec_dbl psi_xz(nz * nx * number_angles, 0.0);
+  detran_utilities::vec_dbl psi_xy(ny * nx * number_angles, 0.0);
+
+  // Angular fluxes of the current octant, if needed, and their staging
+  // buffers.
+  std::vector<State::angular_flux_type> psi(number_angles);
+  std::vector<State::vec_dbl> psi_buffer(number_angles);
+
+  // Reference to boundary to simplify clutter.
+  Boundary_T &b = *d_boundary;
+
+  #pragma omp parallel default(shared)
+  {
+
+  // Cell-center angular fluxes for one cell.
+  detran_utilities::vec_dbl psi_cell(number_angles, 0.0);
+
+  // Sweep source for one angle.
+  SweepSource<_3D>::sweep_source_type source_a(number_cells, 0.0);
+
+  // Sweep over all octants
+  for (size_t oo = 0; oo < 8; oo++)
+  {
+    size_t o = d_ordered_octants[oo];
+
+    // Gather the sources for all angles and update the boundary.
+    #pragma omp for
+    for (int a = 0; a < number_angles; ++a)
+    {
+      d_sweepsource->source(d_g, o, a, source_a);
+      for (int cell = 0; cell < number_cells; ++cell)
+        source[cell * number_angles + a] = source_a[cell];
+      if (d_update_boundary) b.update(d_g, o, a);
+      if (d_update_psi) psi[a] = d_state->psi(d_g, o, a, psi_buffer[a]);
+    }
+
+    // Gather the incident face fluxes.
+    #pragma omp single
+    {
+      b.octant_psi(d_face_index[o][Mesh::YZ][Boundary_T::IN],
+                   o, d_g, &psi_yz[0], Boundary_T::GET);
+      b.octant_psi(d_face_index[o][Mesh::XZ][Boundary_T::IN],
+                   o, d_g, &psi_xz[0], Boundary_T::GET);
+      b.octant_psi(d_face_index[o][Mesh::XY][Boundary_T::IN],
+                   o, d_g, &psi_xy[0], Boundary_T::GET);
+    }
+
+    // Sweep-ordered index to actual index.
+    const int i0 = d_space_ranges[o][0][0];
+    const int di = d_space_ranges[o][0][1];
+    const int j0 = d_space_ranges[o][1][0];
+    const int dj = d_space_ranges[o][1][1];
+    const int k0 = d_space_ranges[o][2][0];
+    const int dk = d_space_ranges[o][2][1];
+
+    for (int w = 0; w < number_wavefronts; ++w)
+    {
+      // Cells on a wavefront plane are independent and share no faces.
+      #pragma omp for
+      for (int c = d_wavefront_offsets[w]; c < d_wavefront_offsets[w+1]; ++c)
+      {
+        const int ijk = d_wavefront_cells[c];
+        const int i = i0 + di * (ijk % nx);
+        const int j = j0 + dj * ((ijk / nx) % ny);
+        const int k = k0 + dk * (ijk / (nx * ny));
+        const int cell = d_mesh->index(i, j, k);
+
+        phi[cell] += equation.solve_angles(i, j, k,
+                                           &source[cell * number_angles],
+                                           &psi_yz[(k * ny + j) * number_angles],
+                                           &psi_xz[(k * nx + i) * number_angles],
+                                           &psi_xy[(j * nx + i) * number_angles],
+                                           &psi_cell[0]);
+
+        if (d_update_psi)
+          for (int a = 0; a < number_angles; ++a)
+            psi[a][cell] = psi_cell[a];
+      }
+    }
+
+    // Update boundary
+    #pragma omp single
+    {
+      b.octant_psi(d_face_index[o][Mesh::YZ][Boundary_T::OUT],
+                   o, d_g, &psi_yz[0], Boundary_T::SET);
+      b.octant_psi(d_face_index[o][Mesh::XZ][Boundary_T::OUT],
+                   o, d_g, &psi_xz[0], Boundary_T::SET);
+      b.octant_psi(d_face_index[o][Mesh::XY][Boundary_T::OUT],
+                   o, d_g, &psi_xy[0], Boundary_T::SET);
+    }
+
+    // Write back psi.
+    if (d_update_psi)
+    {
+      #pragma omp for
+      for (int a = 0; a < number_angles; ++a)
+        d_state->store_psi(d_g, o, a, psi[a]);
+    }
+
+  } // end octant loop
+
+  } // end omp parallel
+
+  d_number_sweeps++;
+}
+
 } // end namespace detran
 
 #endif /* SWEEPER3D_I_HH_ */
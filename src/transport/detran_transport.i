@@ -10,6 +10,7 @@
 %{
 #include <stddef.h>
 #include "transport/DimensionTraits.hh"
+#include "transport/AngularFlux.hh"
 #include "transport/FissionSource.hh"
 #include "transport/State.hh"
 #include "transport/SweepSource.hh"
@@ -34,6 +35,7 @@
 
 %include "DimensionTraits.hh"
 
+%include "AngularFlux.hh"
 %include "State.hh"
 %include "FissionSource.hh"
 %include "ScatterSource.hh"
@@ -0,0 +1,103 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   test_CellCrossSections.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  Test of CellCrossSections
+ */
+//---------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                               \
+        FUNC(test_CellCrossSections_basic)      \
+        FUNC(test_CellCrossSections_memory)
+
+// Detran headers
+#include "utilities/TestDriver.hh"
+#include "CellCrossSections.hh"
+
+// Setup
+#include "geometry/test/mesh_fixture.hh"
+#include "material/test/material_fixture.hh"
+
+using namespace detran;
+using namespace detran_geometry;
+using namespace detran_material;
+using namespace detran_utilities;
+using namespace detran_test;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------//
+
+int test_CellCrossSections_basic(int argc, char *argv[])
+{
+  Mesh::SP_mesh mesh = mesh_2d_fixture();
+  Material::SP_material mat = material_fixture_2g();
+  CellCrossSections xs(mesh, mat);
+  vec_int mat_map = mesh->mesh_map("MATERIAL");
+
+  for (int g = 0; g < 2; ++g)
+  {
+    const double *sigma_t    = xs.sigma_t(g);
+    const double *nu_sigma_f = xs.nu_sigma_f(g);
+    const double *chi        = xs.chi(g);
+    TEST(sigma_t);
+    TEST(nu_sigma_f);
+    TEST(chi);
+    for (int cell = 0; cell < mesh->number_cells(); ++cell)
+    {
+      TEST(sigma_t[cell]    == mat->sigma_t(mat_map[cell], g));
+      TEST(nu_sigma_f[cell] == mat->nu_sigma_f(mat_map[cell], g));
+      TEST(chi[cell]        == mat->chi(mat_map[cell], g));
+    }
+  }
+
+  // Downscatter only, so 0 <-- 1 is outside the scatter bounds.
+  const double *sigma_s = xs.sigma_s(1, 0);
+  TEST(sigma_s);
+  for (int cell = 0; cell < mesh->number_cells(); ++cell)
+    TEST(sigma_s[cell] == mat->sigma_s(mat_map[cell], 1, 0));
+  TEST(!xs.sigma_s(0, 1));
+
+  // Changing the material requires an update, which rebuilds the arrays.
+  TEST(xs.current());
+  double v = 2.0 * mat->sigma_t(mat_map[0], 0);
+  mat->set_sigma_t(mat_map[0], 0, v);
+  TEST(!xs.current());
+  xs.update();
+  TEST(xs.current());
+  TEST(xs.sigma_t(0)[0] == v);
+
+  return 0;
+}
+
+int test_CellCrossSections_memory(int argc, char *argv[])
+{
+  Mesh::SP_mesh mesh = mesh_2d_fixture();
+  Material::SP_material mat = material_fixture_2g();
+
+  // Room for exactly one array, which goes to the first total.
+  double mb = sizeof(double) * mesh->number_cells() / 1048576.0;
+  CellCrossSections xs(mesh, mat, mb);
+  TEST(xs.sigma_t(0));
+  TEST(!xs.sigma_t(1));
+  TEST(xs.sigma_t(0));
+  TEST(soft_equiv(xs.memory(), double(sizeof(double) * mesh->number_cells())));
+
+  // Nothing fits.
+  CellCrossSections none(mesh, mat, 0.0);
+  TEST(!none.sigma_t(0));
+  TEST(!none.sigma_s(0, 0));
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+//              end of test_CellCrossSections.cc
+//---------------------------------------------------------------------------//
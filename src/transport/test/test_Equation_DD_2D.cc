@@ -56,7 +56,8 @@ int test_Equation_DD_2D_basic(int argc, char *argv[])
 
   // Create a phi and psi vector
   Equation_DD_2D::moments_type      phi(mesh->number_cells(), 0.0);
-  Equation_DD_2D::angular_flux_type psi(mesh->number_cells(), 0.0);
+  detran_utilities::vec_dbl psi_values(mesh->number_cells(), 0.0);
+  Equation_DD_2D::angular_flux_type psi(&psi_values[0], psi_values.size());
 
   // Cell sweep source [n/cm^2-s-ster]
   Equation_DD_2D::moments_type source(mesh->number_cells(), 1.0);
@@ -82,7 +83,7 @@ int test_Equation_DD_2D_basic(int argc, char *argv[])
   //TEST(psi_out[0] == 0.0);
   //TEST(psi_out[1] == 0.0);
   //TEST(phi[0]     == 0.0);
-  //TEST(psi[0]     == 0.0);
+  //TEST(psi_values[0]     == 0.0);
 
   return 0;
 }
@@ -62,7 +62,8 @@ int test_Equation_SC_1D(int argc, char *argv[])
 
   // Create a phi and psi vector
   Equation_SC_1D::moments_type      phi(mesh->number_cells(), 0.0);
-  Equation_SC_1D::angular_flux_type psi(mesh->number_cells(), 0.0);
+  vec_dbl psi_values(mesh->number_cells(), 0.0);
+  Equation_SC_1D::angular_flux_type psi(&psi_values[0], psi_values.size());
 
   // Cell sweep source [n/cm^2-s-ster]
   Equation_SC_1D::moments_type source(mesh->number_cells(), 1.0);
@@ -82,10 +83,10 @@ int test_Equation_SC_1D(int argc, char *argv[])
            psi);    // reference
 
   // Check the results. FINISH.
-  printf("%20.16f %20.16f %20.16f \n", psi_out, psi[0], phi[0]);
+  printf("%20.16f %20.16f %20.16f \n", psi_out, psi_values[0], phi[0]);
 
   TEST(soft_equiv(psi_out, 0.686907416523104323));
-  TEST(soft_equiv(psi[0],  0.408479080928661801));
+  TEST(soft_equiv(psi_values[0],  0.408479080928661801));
   TEST(soft_equiv(phi[0],  0.142091427438347980));
 
   return 0;
@@ -72,7 +72,8 @@ int test_Equation_SC_MOC(int argc, char *argv[])
 
   // Create a phi and psi vector
   Equation_SC_MOC::moments_type      phi(mesh->number_cells(), 0.0);
-  Equation_SC_MOC::angular_flux_type psi(mesh->number_cells(), 0.0);
+  detran_utilities::vec_dbl psi_values(mesh->number_cells(), 0.0);
+  Equation_SC_MOC::angular_flux_type psi(&psi_values[0], psi_values.size());
 
   // Cell sweep source [n/cm^2-s-ster]
   Equation_SC_MOC::moments_type source(mesh->number_cells(), 1.0);
@@ -104,10 +105,10 @@ int test_Equation_SC_MOC(int argc, char *argv[])
   cout << A << " " << B << " " << C << " space = " << space << endl;
 
   cout << " psi_out " << psi_out << " ref " << ref_psi_out << endl;
-  cout << " psi_avg " << psi[0]  << " ref " << ref_psi_avg << endl;
+  cout << " psi_avg " << psi_values[0]  << " ref " << ref_psi_avg << endl;
   cout << " psi_out " << phi[0]  << " ref " << ref_phi     << endl;
   TEST(soft_equiv(psi_out, ref_psi_out));
-  TEST(soft_equiv(psi[0],  ref_psi_avg));
+  TEST(soft_equiv(psi_values[0],  ref_psi_avg));
   TEST(soft_equiv(phi[0],  ref_phi));
 
   return 0;
@@ -0,0 +1,129 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   test_ExpTable.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  Test of ExpTable
+ */
+//---------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                     \
+        FUNC(test_ExpTable_accuracy)  \
+        FUNC(test_ExpTable_benchmark)
+
+#include "TestDriver.hh"
+#include "transport/ExpTable.hh"
+#include "utilities/Timer.hh"
+#include <cmath>
+#include <cstdio>
+
+using namespace detran;
+using namespace detran_utilities;
+using namespace detran_test;
+using namespace std;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------//
+
+// Largest error in F1, F2, and exp(-tau) = 1 - tau * F1 over [0, tau_max].
+double max_error(const ExpTable &table, const double tau_max)
+{
+  double err = 0.0;
+  for (int i = 0; i <= 100000; ++i)
+  {
+    double tau = tau_max * i / 100000.0;
+    double f1, f2, f1_ref, f2_ref;
+    table.evaluate(tau, f1, f2);
+    ExpTable::exact(tau, f1_ref, f2_ref);
+    err = std::max(err, std::abs(f1 - f1_ref));
+    err = std::max(err, std::abs(f2 - f2_ref));
+    err = std::max(err, std::abs((1.0 - tau * f1) - std::exp(-tau)));
+  }
+  return err;
+}
+
+int test_ExpTable_accuracy(int argc, char *argv[])
+{
+  // The exact functions agree with their definitions.
+  double f1, f2;
+  ExpTable::exact(0.0, f1, f2);
+  TEST(soft_equiv(f1, 1.0));
+  TEST(soft_equiv(f2, 0.5));
+  ExpTable::exact(2.0, f1, f2);
+  TEST(soft_equiv(f1, (1.0 - std::exp(-2.0)) / 2.0));
+  TEST(soft_equiv(f2, (2.0 - 1.0 + std::exp(-2.0)) / 4.0));
+  ExpTable::exact(0.0099, f1, f2);
+  TEST(soft_equiv(f1, -std::expm1(-0.0099) / 0.0099, 1.0e-13));
+
+  // The interpolation error is within the tolerance, including beyond
+  // the table, where the functions are evaluated exactly.
+  double tol[] = {1.0e-4, 1.0e-6, 1.0e-8, ExpTable::MINIMUM_TOLERANCE};
+  for (int i = 0; i < 4; ++i)
+  {
+    ExpTable table(tol[i], 10.0);
+    TEST(max_error(table, 20.0) <= tol[i]);
+  }
+  return 0;
+}
+
+// Compare throughput and accuracy of the step characteristic coefficients
+// computed with std::exp and with the table.
+int test_ExpTable_benchmark(int argc, char *argv[])
+{
+  const int n = 2000000;
+  const double sigma = 0.7;
+  vec_dbl length(n);
+  for (int i = 0; i < n; ++i)
+    length[i] = 0.001 + 2.0 * ((i % 1000) * 7919 % 1000) / 1000.0;
+
+  ExpTable table(1.0e-6);
+  Timer timer;
+
+  // Exact coefficients, as in Equation_SC_MOC without a table.
+  double sum_exact = 0.0;
+  timer.tic();
+  for (int i = 0; i < n; ++i)
+  {
+    double A = std::exp(-sigma * length[i]);
+    double B = (1.0 - A) / sigma;
+    double C = (length[i] / sigma) * (1.0 - B / length[i]);
+    sum_exact += A + B + C;
+  }
+  double time_exact = timer.toc();
+
+  // Tabulated coefficients.
+  double sum_table = 0.0;
+  timer.tic();
+  for (int i = 0; i < n; ++i)
+  {
+    double tau = sigma * length[i];
+    double F1, F2;
+    table.evaluate(tau, F1, F2);
+    double A = 1.0 - tau * F1;
+    double B = length[i] * F1;
+    double C = length[i] * length[i] * F2;
+    sum_table += A + B + C;
+  }
+  double time_table = timer.toc();
+
+  printf(" std::exp: %10.3e s (%8.2f M/s)\n", time_exact,
+         1.0e-6 * n / std::max(time_exact, 1.0e-12));
+  printf("    table: %10.3e s (%8.2f M/s), %i intervals\n", time_table,
+         1.0e-6 * n / std::max(time_table, 1.0e-12), (int)table.size());
+  printf("   rel. difference of sums: %10.3e \n",
+         std::abs(sum_table - sum_exact) / sum_exact);
+  TEST(soft_equiv(sum_table, sum_exact, 1.0e-6));
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+//              end of test_ExpTable.cc
+//---------------------------------------------------------------------------//
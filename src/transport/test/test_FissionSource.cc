@@ -0,0 +1,196 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   test_FissionSource.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  Test of FissionSource
+ */
+//---------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                             \
+        FUNC(test_FissionSource_basic)        \
+        FUNC(test_FissionSource_cell_xs)
+
+// Detran headers
+#include "utilities/TestDriver.hh"
+#include "FissionSource.hh"
+#include "geometry/Mesh2D.hh"
+
+// Setup
+#include "angle/test/quadrature_fixture.hh"
+
+using namespace detran;
+using namespace detran_geometry;
+using namespace detran_material;
+using namespace detran_utilities;
+using namespace detran_test;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------//
+
+// Library with fission in every group of every material.
+Material::SP_material fission_library(const int number_groups,
+                                      const int number_materials)
+{
+  Material::SP_material mat =
+    Material::Create(number_materials, number_groups, "fission");
+  for (int m = 0; m < number_materials; ++m)
+  {
+    for (int g = 0; g < number_groups; ++g)
+    {
+      mat->set_sigma_t(m, g, 1.0);
+      mat->set_nu_sigma_f(m, g, 0.01 * (1 + m) + 0.002 * g);
+      mat->set_chi(m, g, (1.0 + m + g) / (number_groups * (1.0 + m) +
+                   0.5 * number_groups * (number_groups - 1)));
+    }
+  }
+  mat->finalize();
+  return mat;
+}
+
+// Square mesh of n x n cells with materials assigned by coarse cell.
+Mesh::SP_mesh fission_mesh(const int n, const int number_materials)
+{
+  vec_dbl cm(5, 0.0);
+  for (int i = 1; i < 5; ++i)
+    cm[i] = i * 1.0;
+  vec_int fm(4, n / 4);
+  vec_int mt(16, 0);
+  for (int i = 0; i < 16; ++i)
+    mt[i] = (5 * i) % number_materials;
+  Mesh::SP_mesh mesh(new Mesh2D(fm, fm, cm, cm, mt));
+  return mesh;
+}
+
+// Fill the state with a flux that varies by cell and group.
+State::SP_state fission_state(const int number_groups, Mesh::SP_mesh mesh)
+{
+  InputDB::SP_input input(new InputDB());
+  input->put<int>("number_groups", number_groups);
+  State::SP_state state(new State(input, mesh, quadruplerange_fixture()));
+  for (int g = 0; g < number_groups; ++g)
+    for (int cell = 0; cell < mesh->number_cells(); ++cell)
+      state->phi(g)[cell] = 1.0 + 0.1 * g + 0.001 * (cell % 97);
+  return state;
+}
+
+// Compare all sources against direct evaluation with the getters.
+int check_fission_source(FissionSource &q,
+                         Material::SP_material mat,
+                         Mesh::SP_mesh mesh,
+                         State::SP_state state)
+{
+  const int ng = mat->number_groups();
+  const int nc = mesh->number_cells();
+  const vec_int &mt = mesh->mesh_map("MATERIAL");
+  const double scale = 0.8;
+
+  // Reference density
+  vec_dbl density(nc, 0.0);
+  for (int cell = 0; cell < nc; ++cell)
+    for (int g = 0; g < ng; ++g)
+      density[cell] += state->phi(g)[cell] * mat->nu_sigma_f(mt[cell], g);
+
+  // Separate update and setup.
+  q.update();
+  for (int cell = 0; cell < nc; ++cell)
+    TEST(soft_equiv(q.density()[cell], density[cell]));
+  q.setup_outer(scale);
+  for (int g = 0; g < ng; ++g)
+  {
+    for (int cell = 0; cell < nc; ++cell)
+    {
+      TEST(soft_equiv(q.source(g)[cell],
+                      scale * density[cell] * mat->chi(mt[cell], g)));
+    }
+  }
+
+  // Fused update and setup.
+  q.setup_outer(1.0);
+  q.update(scale);
+  for (int g = 0; g < ng; ++g)
+  {
+    for (int cell = 0; cell < nc; ++cell)
+    {
+      TEST(soft_equiv(q.density()[cell], density[cell]));
+      TEST(soft_equiv(q.source(g)[cell],
+                      scale * density[cell] * mat->chi(mt[cell], g)));
+    }
+  }
+
+  // Fission treated like scatter.
+  for (int g = 0; g < ng; ++g)
+  {
+    State::moments_type within(nc, 1.0), in(nc, 1.0), total(nc, 1.0);
+    q.build_within_group_source(g, state->phi(g), within);
+    q.build_in_fission_source(g, in);
+    q.build_total_group_source(g, state->all_phi(), total);
+    for (int cell = 0; cell < nc; ++cell)
+    {
+      double chi = scale * mat->chi(mt[cell], g);
+      double f_g = state->phi(g)[cell] * mat->nu_sigma_f(mt[cell], g);
+      TEST(soft_equiv(within[cell], 1.0 + chi * f_g));
+      TEST(soft_equiv(in[cell],     1.0 + chi * (density[cell] - f_g)));
+      TEST(soft_equiv(total[cell],  1.0 + chi * density[cell]));
+    }
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_FissionSource_basic(int argc, char *argv[])
+{
+  Material::SP_material mat = fission_library(7, 3);
+  Mesh::SP_mesh mesh = fission_mesh(16, 3);
+  State::SP_state state = fission_state(7, mesh);
+  FissionSource q(state, mesh, mat);
+  TEST(!check_fission_source(q, mat, mesh, state));
+
+  // A change of the material is seen by the next update.
+  mat->set_nu_sigma_f(1, 2, 0.5);
+  TEST(!check_fission_source(q, mat, mesh, state));
+
+  // The initial density is the normalized sum of nu * fission.
+  q.initialize();
+  const vec_int &mt = mesh->mesh_map("MATERIAL");
+  vec_dbl f(mesh->number_cells(), 0.0);
+  double norm = 0.0;
+  for (int cell = 0; cell < mesh->number_cells(); ++cell)
+  {
+    for (int g = 0; g < 7; ++g)
+      f[cell] += mat->nu_sigma_f(mt[cell], g);
+    norm += f[cell];
+  }
+  for (int cell = 0; cell < mesh->number_cells(); ++cell)
+    TEST(soft_equiv(q.density()[cell], f[cell] / norm));
+  return 0;
+}
+
+//----------------------------------------------------------------------------//
+int test_FissionSource_cell_xs(int argc, char *argv[])
+{
+  Material::SP_material mat = fission_library(5, 4);
+  Mesh::SP_mesh mesh = fission_mesh(16, 4);
+  State::SP_state state = fission_state(5, mesh);
+  FissionSource q(state, mesh, mat);
+  q.set_cell_xs(CellCrossSections::Create(mesh, mat));
+  TEST(!check_fission_source(q, mat, mesh, state));
+
+  // With a budget too small for every group, some groups use the map.
+  FissionSource q2(state, mesh, mat);
+  double bytes = 3.0 * sizeof(double) * mesh->number_cells();
+  q2.set_cell_xs(CellCrossSections::Create(mesh, mat, bytes / 1048576.0));
+  TEST(!check_fission_source(q2, mat, mesh, state));
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+//              end of test_FissionSource.cc
+//---------------------------------------------------------------------------//
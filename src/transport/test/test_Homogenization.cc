@@ -9,7 +9,8 @@
 
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST                     \
-        FUNC(test_Homogenization)
+        FUNC(test_Homogenization)     \
+        FUNC(test_Homogenization_chi)
 
 #include "utilities/TestDriver.hh"
 #include "Homogenize.hh"
@@ -110,6 +111,61 @@ int test_Homogenization(int argc, char *argv[])
   return 0;
 }
 
+//---------------------------------------------------------------------------//
+int test_Homogenization_chi(int argc, char *argv[])
+{
+  InputDB::SP_input input = InputDB::Create();
+  input->put<int>("number_groups",    2);
+
+  // Material 0 emits fast and material 1, which fissions three times as
+  // much, emits thermal.
+  Material::SP_material mat = Material::Create(2, 2);
+  for (int m = 0; m < 2; ++m)
+  {
+    for (int g = 0; g < 2; ++g)
+    {
+      mat->set_sigma_t(m, g, 1.0);
+      mat->set_sigma_f(m, g, 0.1 * (1 + 2 * m));
+    }
+    mat->set_chi(m, m, 1.0);
+  }
+  mat->compute_sigma_a();
+  mat->compute_diff_coef();
+  mat->finalize();
+
+  // Both materials in one coarse cell
+  vec_dbl cm(3, 0.0);
+  cm[1] = 5;
+  cm[2] = 10;
+  vec_int fm(2, 1);
+  vec_int mt(2, 0);
+  mt[1] = 1;
+  SP_mesh mesh = detran_geometry::Mesh1D::Create(fm, cm, mt);
+  mesh->add_mesh_map("COARSE", vec_int(2, 0));
+
+  State::SP_state state(new State(input, mesh));
+  for (int i = 0; i < mesh->number_cells(); ++i)
+  {
+    (state->phi(0))[i] = 1.0;
+    (state->phi(1))[i] = 1.0;
+  }
+
+  // The volume weighted spectrum is the plain average...
+  Homogenize H(mat);
+  Material::SP_material mat2 = H.homogenize(state, mesh, "COARSE");
+  TEST(soft_equiv(mat2->chi(0, 0), 0.5));
+  TEST(soft_equiv(mat2->chi(0, 1), 0.5));
+
+  // ...while the fission weighted one follows the fission source.
+  Material::SP_material mat3 =
+    H.homogenize(state, mesh, "COARSE", Homogenize::PHI_D,
+                 Homogenize::FISSION_CHI);
+  TEST(soft_equiv(mat3->chi(0, 0), 0.25));
+  TEST(soft_equiv(mat3->chi(0, 1), 0.75));
+
+  return 0;
+}
+
 //---------------------------------------------------------------------------//
 //              end of test_State.cc
 //---------------------------------------------------------------------------//
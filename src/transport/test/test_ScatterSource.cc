@@ -0,0 +1,293 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   test_ScatterSource.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  Test of ScatterSource
+ */
+//---------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                             \
+        FUNC(test_ScatterSource_basic)        \
+        FUNC(test_ScatterSource_benchmark)    \
+        FUNC(test_ScatterSource_threads)
+
+// Detran headers
+#include "utilities/TestDriver.hh"
+#include "utilities/Timer.hh"
+#include "ScatterSource.hh"
+#include "geometry/Mesh2D.hh"
+
+// Setup
+#include "angle/test/quadrature_fixture.hh"
+
+// System
+#include <cstdio>
+
+using namespace detran;
+using namespace detran_geometry;
+using namespace detran_material;
+using namespace detran_utilities;
+using namespace detran_test;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------//
+
+// Library with a few groups of downscatter into each group and
+// upscatter among the thermal groups.
+Material::SP_material scatter_library(const int number_groups,
+                                      const int number_materials)
+{
+  Material::SP_material mat =
+    Material::Create(number_materials, number_groups, "scatter");
+  int thermal = (2 * number_groups) / 3;
+  for (int m = 0; m < number_materials; ++m)
+  {
+    for (int g = 0; g < number_groups; ++g)
+    {
+      mat->set_sigma_t(m, g, 1.0 + 0.01 * m + 0.001 * g);
+      int gp_lower = std::max(0, g - 8);
+      int gp_upper = g < thermal ? g : std::min(number_groups - 1, g + 4);
+      for (int gp = gp_lower; gp <= gp_upper; ++gp)
+        mat->set_sigma_s(m, g, gp, 0.01 + 0.001 * ((m + g + gp) % 7));
+    }
+  }
+  mat->finalize();
+  return mat;
+}
+
+// Square mesh of n x n cells with materials assigned by coarse cell.
+Mesh::SP_mesh scatter_mesh(const int n, const int number_materials)
+{
+  vec_dbl cm(5, 0.0);
+  for (int i = 1; i < 5; ++i)
+    cm[i] = i * 1.0;
+  vec_int fm(4, n / 4);
+  vec_int mt(16, 0);
+  for (int i = 0; i < 16; ++i)
+    mt[i] = (7 * i) % number_materials;
+  Mesh::SP_mesh mesh(new Mesh2D(fm, fm, cm, cm, mt));
+  return mesh;
+}
+
+// Reference in-scatter source using the unpacked getters.
+void reference_source(const int                     g,
+                      Material::SP_material         mat,
+                      const vec_int                &mat_map,
+                      const vec3_dbl               &sigma_s,
+                      const State::vec_moments_type &phi,
+                      State::moments_type          &source)
+{
+  for (int gp = 0; gp < mat->number_groups(); ++gp)
+  {
+    if (gp == g) continue;
+    for (int cell = 0; cell < mat_map.size(); ++cell)
+      source[cell] += phi[gp][cell] * sigma_s[g][gp][mat_map[cell]];
+  }
+}
+
+// Unpacked copy of the scatter matrix, as stored before finalization.
+vec3_dbl unpacked_sigma_s(Material::SP_material mat)
+{
+  int ng = mat->number_groups();
+  int nm = mat->number_materials();
+  vec3_dbl sigma_s(ng, vec2_dbl(ng, vec_dbl(nm, 0.0)));
+  for (int g = 0; g < ng; ++g)
+    for (int gp = 0; gp < ng; ++gp)
+      for (int m = 0; m < nm; ++m)
+        sigma_s[g][gp][m] = mat->sigma_s(m, g, gp);
+  return sigma_s;
+}
+
+// Fill the state with a flux that varies by cell and group.
+State::SP_state scatter_state(const int number_groups, Mesh::SP_mesh mesh)
+{
+  InputDB::SP_input input(new InputDB());
+  input->put<int>("number_groups", number_groups);
+  State::SP_state state(new State(input, mesh, quadruplerange_fixture()));
+  for (int g = 0; g < number_groups; ++g)
+    for (int cell = 0; cell < mesh->number_cells(); ++cell)
+      state->phi(g)[cell] = 1.0 + 0.1 * g + 0.001 * (cell % 97);
+  return state;
+}
+
+// The packed sources must match a direct evaluation.
+int test_ScatterSource_basic(int argc, char *argv[])
+{
+  int ng = 12;
+  Material::SP_material mat = scatter_library(ng, 3);
+  Mesh::SP_mesh mesh = scatter_mesh(8, 3);
+  State::SP_state state = scatter_state(ng, mesh);
+  ScatterSource Q(mesh, mat, state);
+  vec_int mat_map = mesh->mesh_map("MATERIAL");
+  vec3_dbl sigma_s = unpacked_sigma_s(mat);
+  int nc = mesh->number_cells();
+
+  for (int g = 0; g < ng; ++g)
+  {
+    // In-scatter
+    State::moments_type ref(nc, 0.0);
+    reference_source(g, mat, mat_map, sigma_s, state->all_phi(), ref);
+    State::moments_type source(nc, 0.0);
+    Q.build_in_scatter_source(g, source);
+    for (int cell = 0; cell < nc; ++cell)
+      TEST(soft_equiv(source[cell], ref[cell]));
+
+    // Total, i.e. in-scatter plus within-group
+    State::moments_type total(nc, 0.0);
+    Q.build_total_group_source(g, 0, state->all_phi(), total);
+    Q.build_within_group_source(g, state->phi(g), ref);
+    for (int cell = 0; cell < nc; ++cell)
+      TEST(soft_equiv(total[cell], ref[cell]));
+
+    // Downscatter from all groups above g
+    State::moments_type down(nc, 0.0);
+    Q.build_downscatter_source(g, g, down);
+    State::moments_type down_ref(nc, 0.0);
+    for (int gp = 0; gp < g; ++gp)
+      for (int cell = 0; cell < nc; ++cell)
+        down_ref[cell] += state->phi(gp)[cell] * sigma_s[g][gp][mat_map[cell]];
+    for (int cell = 0; cell < nc; ++cell)
+      TEST(soft_equiv(down[cell], down_ref[cell]));
+  }
+
+  // All groups at once must match the group-by-group total sources.
+  for (int g_cutoff = 0; g_cutoff < ng; g_cutoff += 5)
+  {
+    State::vec_moments_type all(ng, State::moments_type(nc, 0.0));
+    Q.build_total_group_sources(g_cutoff, state->all_phi(), all);
+    for (int g = 0; g < ng; ++g)
+    {
+      State::moments_type total(nc, 0.0);
+      if (g >= g_cutoff)
+        Q.build_total_group_source(g, g_cutoff, state->all_phi(), total);
+      for (int cell = 0; cell < nc; ++cell)
+        TEST(soft_equiv(all[g][cell], total[cell]));
+    }
+  }
+
+  return 0;
+}
+
+// Time the scatter sources for 47- and 70-group libraries.  The in-scatter
+// source is compared to a direct evaluation over the full, unpacked
+// scattering matrix, and the total sources of all groups built at once
+// are compared to those built group by group.
+int test_ScatterSource_benchmark(int argc, char *argv[])
+{
+  int number_groups[] = {47, 70};
+  for (int i = 0; i < 2; ++i)
+  {
+    int ng = number_groups[i];
+    int nm = 10;
+    int number_builds = 5;
+    Material::SP_material mat = scatter_library(ng, nm);
+    Mesh::SP_mesh mesh = scatter_mesh(64, nm);
+    State::SP_state state = scatter_state(ng, mesh);
+    ScatterSource Q(mesh, mat, state);
+    vec_int mat_map = mesh->mesh_map("MATERIAL");
+    vec3_dbl sigma_s = unpacked_sigma_s(mat);
+    int nc = mesh->number_cells();
+    Timer timer;
+
+    // Unpacked
+    double sum_ref = 0.0;
+    timer.tic();
+    for (int b = 0; b < number_builds; ++b)
+    {
+      for (int g = 0; g < ng; ++g)
+      {
+        State::moments_type source(nc, 0.0);
+        reference_source(g, mat, mat_map, sigma_s, state->all_phi(), source);
+        sum_ref += source[nc / 2];
+      }
+    }
+    double time_ref = timer.toc();
+
+    // Packed
+    double sum = 0.0;
+    timer.tic();
+    for (int b = 0; b < number_builds; ++b)
+    {
+      for (int g = 0; g < ng; ++g)
+      {
+        State::moments_type source(nc, 0.0);
+        Q.build_in_scatter_source(g, source);
+        sum += source[nc / 2];
+      }
+    }
+    double time = timer.toc();
+
+    // Total sources, group by group
+    State::vec_moments_type source(ng, State::moments_type(nc, 0.0));
+    timer.tic();
+    for (int b = 0; b < number_builds; ++b)
+      for (int g = 0; g < ng; ++g)
+        Q.build_total_group_source(g, 0, state->all_phi(), source[g]);
+    double time_group = timer.toc();
+    double sum_group = source[ng - 1][nc / 2];
+
+    // Total sources, all groups at once
+    source.assign(ng, State::moments_type(nc, 0.0));
+    timer.tic();
+    for (int b = 0; b < number_builds; ++b)
+      Q.build_total_group_sources(0, state->all_phi(), source);
+    double time_all = timer.toc();
+    double sum_all = source[ng - 1][nc / 2];
+
+    printf(" %i groups, %i materials, %i cells \n", ng, nm, nc);
+    printf("    in-scatter, unpacked: %10.3e s \n", time_ref);
+    printf("    in-scatter,   packed: %10.3e s (speedup %6.2f) \n", time,
+           time_ref / std::max(time, 1.0e-12));
+    printf("   total, group by group: %10.3e s \n", time_group);
+    printf("   total,    all at once: %10.3e s (speedup %6.2f) \n", time_all,
+           time_group / std::max(time_all, 1.0e-12));
+    TEST(soft_equiv(sum, sum_ref));
+    TEST(soft_equiv(sum_all, sum_group));
+  }
+
+  return 0;
+}
+
+// Sources for different groups built by concurrent threads must match
+// those built one at a time.
+int test_ScatterSource_threads(int argc, char *argv[])
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  int ng = 12;
+  Material::SP_material mat = scatter_library(ng, 3);
+  Mesh::SP_mesh mesh = scatter_mesh(8, 3);
+  State::SP_state state = scatter_state(ng, mesh);
+  int nc = mesh->number_cells();
+
+  ScatterSource Q_ref(mesh, mat, state);
+  State::vec_moments_type ref(ng, State::moments_type(nc, 0.0));
+  for (int g = 0; g < ng; ++g)
+    Q_ref.build_in_scatter_source(g, ref[g]);
+
+  // The blocks are built by the first of the threads.
+  ScatterSource Q(mesh, mat, state);
+  for (int r = 0; r < 100; ++r)
+  {
+    State::vec_moments_type source(ng, State::moments_type(nc, 0.0));
+    #pragma omp parallel for num_threads(4)
+    for (int g = 0; g < ng; ++g)
+      Q.build_in_scatter_source(g, source[g]);
+    for (int g = 0; g < ng; ++g)
+      for (int cell = 0; cell < nc; ++cell)
+        TEST(source[g][cell] == ref[g][cell]);
+  }
+#endif
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+//              end of test_ScatterSource.cc
+//---------------------------------------------------------------------------//
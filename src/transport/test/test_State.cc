@@ -9,7 +9,8 @@
 
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST                     \
-        FUNC(test_State_basic)
+        FUNC(test_State_basic)        \
+        FUNC(test_State_angular_flux)
 
 #include "utilities/TestDriver.hh"
 #include "State.hh"
@@ -72,6 +73,86 @@ int test_State_basic(int argc, char *argv[])
   return 0;
 }
 
+// Fill psi with values unique to group, angle, and cell.
+void fill_psi(State &state)
+{
+  State::vec_dbl buffer;
+  for (int g = 0; g < state.number_groups(); ++g)
+  {
+    for (int o = 0; o < 4; ++o)
+    {
+      for (int a = 0; a < 2; ++a)
+      {
+        State::angular_flux_type psi = state.psi(g, o, a, buffer);
+        for (int cell = 0; cell < psi.size(); ++cell)
+          psi[cell] = 100.0 * g + 10.0 * (2 * o + a) + cell;
+        state.store_psi(g, o, a, psi);
+      }
+    }
+  }
+}
+
+int test_State_angular_flux(int argc, char *argv[])
+{
+  SP_mesh mesh          = mesh_2d_fixture();
+  SP_quadrature quad    = quadruplerange_fixture();
+  int nc = mesh->number_cells();
+
+  const char *layout[] = {"angle", "cell"};
+  for (int single = 0; single < 2; ++single)
+  {
+    for (int l = 0; l < 2; ++l)
+    {
+      State::SP_input input(new InputDB());
+      input->put<int>("number_groups",          2);
+      input->put<int>("store_angular_flux",     1);
+      input->put<std::string>("angular_flux_layout", layout[l]);
+      input->put<int>("angular_flux_single",    single);
+      State state(input, mesh, quad);
+      const AngularFlux &psi = state.angular_flux();
+      TEST(psi.layout() == l);
+      TEST(psi.single() == bool(single));
+      TEST(psi.memory() == 2 * 8 * nc * (single ? 4 : 8));
+
+      // Values are aligned, and views of the angle-major layout in double
+      // precision expose their values directly.
+      State::const_angular_flux_type v = state.psi(0, 0, 0);
+      TEST(v.size() == nc);
+      TEST(v.stride() == (l ? 8 : 1));
+      TEST((v.data() != 0) == (!l && !single));
+      if (v.data()) TEST((std::size_t) v.data() % 64 == 0);
+
+      // Writable views refer to the values directly in double precision,
+      // and to the unit stride staging buffer in single precision.
+      State::vec_dbl buffer;
+      State::angular_flux_type w = state.psi(0, 0, 0, buffer);
+      TEST(w.size() == nc);
+      TEST(w.stride() == (single ? 1 : (l ? 8 : 1)));
+      TEST(single ? w.data() == &buffer[0] : w.data() == v.data());
+
+      // Stored views write through to the state, and copies are deep.
+      fill_psi(state);
+      State copy(state);
+      for (int g = 0; g < 2; ++g)
+        for (int o = 0; o < 4; ++o)
+          for (int a = 0; a < 2; ++a)
+            for (int cell = 0; cell < nc; ++cell)
+            {
+              double ref = 100.0 * g + 10.0 * (2 * o + a) + cell;
+              TEST(state.psi(g, o, a)[cell] == ref);
+              TEST(copy.psi(g, o, a)[cell] == ref);
+            }
+      state.scale(2.0);
+      TEST(state.psi(1, 3, 1)[nc - 1] == 2.0 * (170.0 + nc - 1));
+      TEST(copy.psi(1, 3, 1)[nc - 1] == 170.0 + nc - 1);
+      state.clear();
+      TEST(state.psi(1, 3, 1)[nc - 1] == 0.0);
+    }
+  }
+
+  return 0;
+}
+
 //---------------------------------------------------------------------------//
 //              end of test_State.cc
 //---------------------------------------------------------------------------//
@@ -9,7 +9,13 @@
 
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST                     \
-        FUNC(test_Sweeper2D_basic)
+        FUNC(test_Sweeper2D_basic)    \
+        FUNC(test_Sweeper2D_wavefront)  \
+        FUNC(test_Sweeper2D_angle_batch) \
+        FUNC(test_Sweeper2D_angular_flux) \
+        FUNC(test_Sweeper2D_group_block) \
+        FUNC(test_Sweeper2D_threads)  \
+        FUNC(test_Sweeper2D_group_block_tally)
 
 // Detran headers
 #include "utilities/TestDriver.hh"
@@ -17,14 +23,23 @@
 #include "Equation_DD_2D.hh"
 #include "Equation_SD_2D.hh"
 #include "Equation_SC_2D.hh"
+#include "boundary/BoundaryFactory.t.hh"
+#include "external_source/ConstantSource.hh"
+#include "CoarseMesh.hh"
+#include "CurrentTally.hh"
 
 // Setup
 #include "geometry/test/mesh_fixture.hh"
 #include "material/test/material_fixture.hh"
 #include "angle/test/quadrature_fixture.hh"
 
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
 using namespace detran;
 using namespace detran_angle;
+using namespace detran_external_source;
 using namespace detran_geometry;
 using namespace detran_utilities;
 using namespace detran_test;
@@ -78,3 +93,240 @@ int test_Sweeper2D_basic(int argc, char *argv[])
 
   return 0;
 }
+
+//---------------------------------------------------------------------------//
+// Sweep twice with angle parallelism and with the given option and compare.
+// The second sweep may also store psi in another layout or precision.
+template <class EQ>
+bool matches_angle_sweep(const std::string &option,
+                         const std::string &layout = "angle",
+                         const int          single = 0)
+{
+  typedef Sweeper2D<EQ> Sweeper_T;
+
+  SP_mesh mesh          = mesh_2d_fixture();
+  SP_material mat       = material_fixture_1g();
+  SP_quadrature quad    = quadruplerange_fixture();
+
+  MomentIndexer::SP_momentindexer indexer = MomentIndexer::Create(2, 0);
+  MomentToDiscrete::SP_MtoD m2d(new MomentToDiscrete(indexer));
+  m2d->build(quad);
+  ConstantSource::SP_externalsource q_e(new ConstantSource(1, mesh, 1.0, quad));
+
+  State::moments_type phi[2];
+  State::SP_state state[2];
+  for (int w = 0; w < 2; ++w)
+  {
+    InputDB::SP_input input(new InputDB());
+    input->put<int>("number_groups",      1);
+    input->put<int>("store_angular_flux", 1);
+    input->put<int>(option,               w);
+    input->put<std::string>("bc_west",    "reflect");
+    if (w)
+    {
+      input->put<std::string>("angular_flux_layout", layout);
+      input->put<int>("angular_flux_single", single);
+    }
+    state[w] = new State(input, mesh, quad);
+    BoundarySN<_2D>::SP_boundary
+      bound = BoundaryFactory<_2D, BoundarySN>::build(input, mesh, quad);
+    SweepSource<_2D>::SP_sweepsource
+      source(new SweepSource<_2D>(state[w], mesh, quad, mat, m2d));
+    source->set_moment_source(q_e);
+    source->build_fixed(0);
+    Sweeper_T sweeper(input, mesh, mat, quad, state[w], bound, source);
+    sweeper.set_update_boundary(true);
+    sweeper.setup_group(0);
+    phi[w].resize(mesh->number_cells(), 0.0);
+    sweeper.sweep(phi[w]);
+    sweeper.sweep(phi[w]);
+  }
+  for (int i = 0; i < mesh->number_cells(); ++i)
+    if (!soft_equiv(phi[0][i], phi[1][i])) return false;
+  for (int o = 0; o < 4; ++o)
+    for (int i = 0; i < mesh->number_cells(); ++i)
+      if (!soft_equiv(state[0]->psi(0, o, 0)[i],
+                      state[1]->psi(0, o, 0)[i],
+                      single ? 1.0e-6 : 1.0e-12))
+        return false;
+  return true;
+}
+
+int test_Sweeper2D_wavefront(int argc, char *argv[])
+{
+  TEST(matches_angle_sweep<Equation_DD_2D>("sweeper_wavefront"));
+  TEST(matches_angle_sweep<Equation_SD_2D>("sweeper_wavefront"));
+  TEST(matches_angle_sweep<Equation_SC_2D>("sweeper_wavefront"));
+  return 0;
+}
+
+int test_Sweeper2D_angle_batch(int argc, char *argv[])
+{
+  TEST(matches_angle_sweep<Equation_DD_2D>("sweeper_angle_batch"));
+  // Other equations fall back to one angle at a time.
+  TEST(matches_angle_sweep<Equation_SD_2D>("sweeper_angle_batch"));
+  return 0;
+}
+
+int test_Sweeper2D_angular_flux(int argc, char *argv[])
+{
+  TEST(matches_angle_sweep<Equation_DD_2D>("sweeper_wavefront", "cell"));
+  TEST(matches_angle_sweep<Equation_DD_2D>("sweeper_angle_batch", "cell"));
+  TEST(matches_angle_sweep<Equation_DD_2D>("sweeper_wavefront", "angle", 1));
+  TEST(matches_angle_sweep<Equation_SC_2D>("sweeper_wavefront", "cell", 1));
+  TEST(matches_angle_sweep<Equation_DD_2D>("sweeper_angle_batch", "cell", 1));
+  return 0;
+}
+
+// Sweep all groups of a multigroup problem one group at a time and in
+// blocks of three, and compare the moments and angular fluxes.
+int test_Sweeper2D_group_block(int argc, char *argv[])
+{
+  typedef Sweeper2D<Equation_DD_2D> Sweeper_T;
+
+  SP_mesh mesh          = mesh_2d_fixture();
+  SP_material mat       = material_fixture_7g();
+  SP_quadrature quad    = quadruplerange_fixture();
+  int ng = mat->number_groups();
+
+  MomentIndexer::SP_momentindexer indexer = MomentIndexer::Create(2, 0);
+  MomentToDiscrete::SP_MtoD m2d(new MomentToDiscrete(indexer));
+  m2d->build(quad);
+
+  State::vec_moments_type phi[2];
+  State::SP_state state[2];
+  for (int w = 0; w < 2; ++w)
+  {
+    InputDB::SP_input input(new InputDB());
+    input->put<int>("number_groups",       ng);
+    input->put<int>("store_angular_flux",  1);
+    input->put<int>("sweeper_group_block", w ? 3 : 1);
+    input->put<int>("cell_xs",             w ? 0 : 1);
+    input->put<std::string>("bc_west",     "reflect");
+    state[w] = new State(input, mesh, quad);
+    for (int g = 0; g < ng; ++g)
+      for (int i = 0; i < mesh->number_cells(); ++i)
+        state[w]->phi(g)[i] = 1.0 + 0.1 * g + 0.01 * i;
+    BoundarySN<_2D>::SP_boundary
+      bound = BoundaryFactory<_2D, BoundarySN>::build(input, mesh, quad);
+    SweepSource<_2D>::SP_sweepsource
+      source(new SweepSource<_2D>(state[w], mesh, quad, mat, m2d));
+    source->build_total_scatter(0, state[w]->all_phi());
+    Sweeper_T sweeper(input, mesh, mat, quad, state[w], bound, source);
+    sweeper.set_update_boundary(true);
+    phi[w] = state[w]->all_phi();
+    sweeper.sweep_groups(0, phi[w]);
+    sweeper.sweep_groups(0, phi[w]);
+    TEST(sweeper.number_sweeps() == 2 * ng);
+  }
+  for (int g = 0; g < ng; ++g)
+  {
+    for (int i = 0; i < mesh->number_cells(); ++i)
+      TEST(soft_equiv(phi[0][g][i], phi[1][g][i]));
+    for (int o = 0; o < 4; ++o)
+      for (int i = 0; i < mesh->number_cells(); ++i)
+        TEST(soft_equiv(state[0]->psi(g, o, 0)[i],
+                        state[1]->psi(g, o, 0)[i]));
+  }
+  return 0;
+}
+
+// Sweep with one thread and with several, and compare the moments, which
+// the threaded sweep reduces from per-thread buffers.
+int test_Sweeper2D_threads(int argc, char *argv[])
+{
+#ifdef DETRAN_ENABLE_OPENMP
+  typedef Sweeper2D<Equation_DD_2D> Sweeper_T;
+
+  SP_mesh mesh          = mesh_2d_fixture();
+  SP_material mat       = material_fixture_1g();
+  SP_quadrature quad    = quadruplerange_fixture();
+
+  MomentIndexer::SP_momentindexer indexer = MomentIndexer::Create(2, 0);
+  MomentToDiscrete::SP_MtoD m2d(new MomentToDiscrete(indexer));
+  m2d->build(quad);
+  ConstantSource::SP_externalsource q_e(new ConstantSource(1, mesh, 1.0, quad));
+
+  const int number_threads = omp_get_max_threads();
+  State::moments_type phi[2];
+  for (int w = 0; w < 2; ++w)
+  {
+    omp_set_num_threads(w ? 4 : 1);
+    InputDB::SP_input input(new InputDB());
+    input->put<int>("number_groups",      1);
+    input->put<std::string>("bc_west",    "reflect");
+    State::SP_state state(new State(input, mesh, quad));
+    BoundarySN<_2D>::SP_boundary
+      bound = BoundaryFactory<_2D, BoundarySN>::build(input, mesh, quad);
+    SweepSource<_2D>::SP_sweepsource
+      source(new SweepSource<_2D>(state, mesh, quad, mat, m2d));
+    source->set_moment_source(q_e);
+    source->build_fixed(0);
+    Sweeper_T sweeper(input, mesh, mat, quad, state, bound, source);
+    sweeper.set_update_boundary(true);
+    sweeper.setup_group(0);
+    phi[w].resize(mesh->number_cells(), 0.0);
+    sweeper.sweep(phi[w]);
+    sweeper.sweep(phi[w]);
+  }
+  omp_set_num_threads(number_threads);
+  for (int i = 0; i < mesh->number_cells(); ++i)
+    TEST(soft_equiv(phi[0][i], phi[1][i]));
+#endif
+  return 0;
+}
+
+// With a current tally, blocks of groups are swept one group at a time,
+// so that the tally holds the currents of every group.
+int test_Sweeper2D_group_block_tally(int argc, char *argv[])
+{
+  typedef Sweeper2D<Equation_DD_2D> Sweeper_T;
+
+  SP_mesh mesh          = mesh_2d_fixture();
+  SP_material mat       = material_fixture_7g();
+  SP_quadrature quad    = quadruplerange_fixture();
+  int ng = mat->number_groups();
+  CoarseMesh::SP_coarsemesh coarse(new CoarseMesh(mesh, 2));
+  SP_mesh cmesh = coarse->get_coarse_mesh();
+
+  MomentIndexer::SP_momentindexer indexer = MomentIndexer::Create(2, 0);
+  MomentToDiscrete::SP_MtoD m2d(new MomentToDiscrete(indexer));
+  m2d->build(quad);
+
+  typedef CurrentTally<_2D> Tally_T;
+  detran_utilities::SP<Tally_T> tally[2];
+  for (int w = 0; w < 2; ++w)
+  {
+    InputDB::SP_input input(new InputDB());
+    input->put<int>("number_groups",       ng);
+    input->put<int>("sweeper_group_block", w ? 3 : 1);
+    State::SP_state state(new State(input, mesh, quad));
+    for (int g = 0; g < ng; ++g)
+      for (int i = 0; i < mesh->number_cells(); ++i)
+        state->phi(g)[i] = 1.0 + 0.1 * g + 0.01 * i;
+    BoundarySN<_2D>::SP_boundary
+      bound = BoundaryFactory<_2D, BoundarySN>::build(input, mesh, quad);
+    SweepSource<_2D>::SP_sweepsource
+      source(new SweepSource<_2D>(state, mesh, quad, mat, m2d));
+    source->build_total_scatter(0, state->all_phi());
+    Sweeper_T sweeper(input, mesh, mat, quad, state, bound, source);
+    tally[w] = new Tally_T(coarse, quad, ng);
+    sweeper.set_tally(tally[w]);
+    State::vec_moments_type phi = state->all_phi();
+    sweeper.sweep_groups(0, phi);
+  }
+  // Nothing enters through the vacuum west face.
+  for (int g = 0; g < ng; ++g)
+  {
+    for (int i = 1; i <= cmesh->number_cells_x(); ++i)
+    {
+      for (int j = 0; j < cmesh->number_cells_y(); ++j)
+      {
+        double J = tally[0]->partial_current(i, j, 0, g, 0, 1);
+        TEST(J > 0.0);
+        TEST(soft_equiv(tally[1]->partial_current(i, j, 0, g, 0, 1), J));
+      }
+    }
+  }
+  return 0;
+}
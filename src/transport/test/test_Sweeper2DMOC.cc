@@ -0,0 +1,176 @@
+//----------------------------------*-C++-*----------------------------------//
+/**
+ *  @file   test_Sweeper2DMOC.cc
+ *  @author robertsj
+ *  @date   Oct 18, 2026
+ *  @brief  Test of Sweeper2DMOC
+ */
+//---------------------------------------------------------------------------//
+
+// LIST OF TEST FUNCTIONS
+#define TEST_LIST                           \
+        FUNC(test_Sweeper2DMOC_cache)       \
+        FUNC(test_Sweeper2DMOC_tracks)
+
+// Detran headers
+#include "utilities/TestDriver.hh"
+#include "Sweeper2DMOC.hh"
+#include "Equation_SC_MOC.hh"
+#include "boundary/BoundaryFactory.t.hh"
+#include "external_source/ConstantSource.hh"
+#include "geometry/Mesh2D.hh"
+#include "geometry/Tracker.hh"
+#include "angle/Uniform.hh"
+
+// Setup
+#include "material/test/material_fixture.hh"
+
+// System
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+using namespace detran;
+using namespace detran_angle;
+using namespace detran_external_source;
+using namespace detran_geometry;
+using namespace detran_material;
+using namespace detran_utilities;
+using namespace detran_test;
+
+int main(int argc, char *argv[])
+{
+  RUN(argc, argv);
+}
+
+//----------------------------------------------//
+// TEST DEFINITIONS
+//----------------------------------------------//
+
+typedef Sweeper2DMOC<Equation_SC_MOC> Sweeper_T;
+
+// Sweep twice with the given options and return the flux.
+State::moments_type sweep_moc(InputDB::SP_input  input,
+                              Sweeper_T::SP_mesh mesh,
+                              Material::SP_material mat,
+                              Sweeper_T::SP_quadrature quad)
+{
+  MomentIndexer::SP_momentindexer indexer = MomentIndexer::Create(2, 0);
+  MomentToDiscrete::SP_MtoD m2d(new MomentToDiscrete(indexer));
+  m2d->build(quad);
+  ConstantSource::SP_externalsource q_e(new ConstantSource(1, mesh, 1.0, quad));
+
+  input->put<int>("number_groups", 1);
+  input->put<std::string>("bc_west", "reflect");
+  State::SP_state state(new State(input, mesh, quad));
+  Sweeper_T::SP_boundary
+    bound = BoundaryFactory<_2D, BoundaryMOC>::build(input, mesh, quad);
+  SweepSource<_2D>::SP_sweepsource
+    source(new SweepSource<_2D>(state, mesh, quad, mat, m2d));
+  source->set_moment_source(q_e);
+  source->build_fixed(0);
+  Sweeper_T sweeper(input, mesh, mat, quad, state, bound, source);
+  sweeper.set_update_boundary(true);
+  sweeper.setup_group(0);
+  State::moments_type phi(mesh->number_cells(), 0.0);
+  sweeper.sweep(phi);
+  sweeper.sweep(phi);
+
+  // A changed cross section must not reuse the cached coefficients.
+  mat->set_sigma_t(0, 0, 2.0 * mat->sigma_t(0, 0));
+  sweeper.setup_group(0);
+  sweeper.sweep(phi);
+  mat->set_sigma_t(0, 0, 0.5 * mat->sigma_t(0, 0));
+  return phi;
+}
+
+// Tracked 4x4 mesh with three materials.
+Sweeper_T::SP_mesh tracked_mesh(QuadratureMOC::SP_quadrature quad)
+{
+  vec_dbl cm(3, 0.0);
+  cm[1] = 0.5;
+  cm[2] = 1.0;
+  vec_int fm(2, 2);
+  vec_int mt(4, 0);
+  mt[1] = 1;
+  mt[2] = 2;
+  Mesh::SP_mesh mesh0(new Mesh2D(fm, fm, cm, cm, mt));
+  Tracker tracker(mesh0, quad);
+  tracker.normalize();
+  return tracker.meshmoc();
+}
+
+int test_Sweeper2DMOC_cache(int argc, char *argv[])
+{
+  QuadratureMOC::SP_quadrature quad(new Uniform(2, 2, 5, 3, "TY"));
+  Sweeper_T::SP_mesh mesh = tracked_mesh(quad);
+  Material::SP_material mat = material_fixture_1g();
+
+  // Reference without and with the exponential table.
+  InputDB::SP_input input(new InputDB());
+  State::moments_type phi_ref = sweep_moc(input, mesh, mat, quad);
+  input = new InputDB();
+  input->put<int>("moc_exp_table", 1);
+  State::moments_type phi_table = sweep_moc(input, mesh, mat, quad);
+
+  // Cached coefficients give the same flux.
+  input = new InputDB();
+  input->put<int>("moc_segment_cache", 1);
+  State::moments_type phi = sweep_moc(input, mesh, mat, quad);
+  for (int i = 0; i < mesh->number_cells(); ++i)
+    TEST(soft_equiv(phi[i], phi_ref[i]));
+
+  // Cached tabulated coefficients give the same flux as the table.
+  input->put<int>("moc_exp_table", 1);
+  phi = sweep_moc(input, mesh, mat, quad);
+  for (int i = 0; i < mesh->number_cells(); ++i)
+    TEST(soft_equiv(phi[i], phi_table[i]));
+
+  // Without room in the cache, the coefficients are computed on the fly.
+  input = new InputDB();
+  input->put<int>("moc_segment_cache", 1);
+  input->put<double>("moc_segment_cache_memory", 0.0);
+  phi = sweep_moc(input, mesh, mat, quad);
+  for (int i = 0; i < mesh->number_cells(); ++i)
+    TEST(soft_equiv(phi[i], phi_ref[i]));
+
+  return 0;
+}
+
+// Sweeping batches of tracks gives the same flux as sweeping by angle.
+int test_Sweeper2DMOC_tracks(int argc, char *argv[])
+{
+  QuadratureMOC::SP_quadrature quad(new Uniform(2, 2, 5, 3, "TY"));
+  Sweeper_T::SP_mesh mesh = tracked_mesh(quad);
+  Material::SP_material mat = material_fixture_1g();
+
+  InputDB::SP_input input(new InputDB());
+  State::moments_type phi_ref = sweep_moc(input, mesh, mat, quad);
+
+  int batch_segments[] = {1, 7, 100000};
+  for (int b = 0; b < 3; ++b)
+  {
+    for (int threads = 1; threads <= 3; ++threads)
+    {
+#ifdef DETRAN_ENABLE_OPENMP
+      omp_set_num_threads(threads);
+#endif
+      input = new InputDB();
+      input->put<int>("moc_sweep_tracks", 1);
+      input->put<int>("moc_track_batch_segments", batch_segments[b]);
+      input->put<int>("moc_segment_cache", b % 2);
+      State::moments_type phi = sweep_moc(input, mesh, mat, quad);
+      for (int i = 0; i < mesh->number_cells(); ++i)
+        TEST(soft_equiv(phi[i], phi_ref[i]));
+    }
+  }
+#ifdef DETRAN_ENABLE_OPENMP
+  omp_set_num_threads(1);
+#endif
+
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+//              end of test_Sweeper2DMOC.cc
+//---------------------------------------------------------------------------//
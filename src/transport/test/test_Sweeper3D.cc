@@ -9,13 +9,16 @@
 
 // LIST OF TEST FUNCTIONS
 #define TEST_LIST                     \
-        FUNC(test_Sweeper3D_basic)
+        FUNC(test_Sweeper3D_basic)    \
+        FUNC(test_Sweeper3D_wavefront)  \
+        FUNC(test_Sweeper3D_angle_batch)
 
 #include "utilities/TestDriver.hh"
 #include "Sweeper3D.hh"
 #include "Equation_DD_3D.hh"
 
 #include "angle/LevelSymmetric.hh"
+#include "boundary/BoundaryFactory.t.hh"
 #include "external_source/ConstantSource.hh"
 #include "geometry/Mesh3D.hh"
 
@@ -109,3 +112,77 @@ int test_Sweeper3D_basic(int argc, char *argv[])
 //  out.finalize();
   return 0;
 }
+
+//---------------------------------------------------------------------------//
+// Sweep twice with angle parallelism and with the given option and compare.
+bool matches_angle_sweep(const std::string &option)
+{
+  typedef Sweeper3D<Equation_DD_3D> Sweeper_T;
+
+  // Uneven mesh so the wavefronts are not symmetric.
+  vec_int fmx(1, 4), fmy(1, 3), fmz(1, 2);
+  vec_dbl cm(2, 0.0);
+  cm[1] = 1.0;
+  vec_int mt(1, 0);
+  Sweeper_T::SP_mesh mesh =
+    Mesh3D::Create(fmx, fmy, fmz, cm, cm, cm, mt);
+  Sweeper_T::SP_material mat    = material_fixture_1g();
+  Sweeper_T::SP_quadrature quad = LevelSymmetric::Create(4, 3);
+
+  MomentIndexer::SP_momentindexer indexer = MomentIndexer::Create(3, 0);
+  MomentToDiscrete::SP_MtoD m2d(new MomentToDiscrete(indexer));
+  m2d->build(quad);
+  ConstantSource::SP_externalsource q_e(new ConstantSource(1, mesh, 1.0, quad));
+
+  // Sweep with angle parallelism (0) and the option (1).
+  State::moments_type phi[2];
+  Sweeper_T::SP_state state[2];
+  for (int w = 0; w < 2; ++w)
+  {
+    Sweeper_T::SP_input input(new InputDB());
+    input->put<int>("number_groups",      1);
+    input->put<int>("store_angular_flux", 1);
+    input->put<int>(option,               w);
+    input->put<std::string>("bc_west",    "reflect");
+    input->put<std::string>("bc_south",   "reflect");
+    state[w] = new State(input, mesh, quad);
+    Sweeper_T::SP_boundary
+      bound = BoundaryFactory<_3D, BoundarySN>::build(input, mesh, quad);
+    Sweeper_T::SP_sweepsource
+      source(new SweepSource<_3D>(state[w], mesh, quad, mat, m2d));
+    source->set_moment_source(q_e);
+    source->build_fixed(0);
+    Sweeper_T sweeper(input, mesh, mat, quad, state[w], bound, source);
+    sweeper.set_update_boundary(true);
+    sweeper.setup_group(0);
+    phi[w].resize(mesh->number_cells(), 0.0);
+    sweeper.sweep(phi[w]);
+    sweeper.sweep(phi[w]);
+  }
+  for (int i = 0; i < mesh->number_cells(); ++i)
+    if (!soft_equiv(phi[0][i], phi[1][i])) return false;
+  for (int o = 0; o < 8; ++o)
+    for (int i = 0; i < mesh->number_cells(); ++i)
+      if (!soft_equiv(state[0]->psi(0, o, 1)[i],
+                      state[1]->psi(0, o, 1)[i]))
+        return false;
+  return true;
+}
+
+//---------------------------------------------------------------------------//
+int test_Sweeper3D_wavefront(int argc, char *argv[])
+{
+  TEST(matches_angle_sweep("sweeper_wavefront"));
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+int test_Sweeper3D_angle_batch(int argc, char *argv[])
+{
+  TEST(matches_angle_sweep("sweeper_angle_batch"));
+  return 0;
+}
+
+//---------------------------------------------------------------------------//
+//              end of test_Sweeper3D.cc
+//---------------------------------------------------------------------------//
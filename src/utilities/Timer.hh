@@ -11,6 +11,9 @@
 #define TIMER_HH_
 
 #include "DBC.hh"
+#ifdef DETRAN_ENABLE_OPENMP
+#include <omp.h>
+#endif
 
 #include <cstdlib>
 #include <ctime>
@@ -32,7 +35,7 @@ public:
   void tic()
   {
     d_started = true;
-    d_value = (double) std::clock() / (double)CLOCKS_PER_SEC;
+    d_value = wtime();
   }
 
   /// Return the time elapsed around a single code block
@@ -47,14 +50,19 @@ public:
   /// Return the current wall time (only differences are meaningful)
   double wtime()
   {
+#ifdef DETRAN_ENABLE_OPENMP
+    // std::clock sums the processor time of all threads.
+    return omp_get_wtime();
+#else
     return (double) std::clock() / (double)CLOCKS_PER_SEC;
+#endif
   }
 
   /// Begin the timer at the beginning of a function call.
   void function_tic()
   {
     d_started = true;
-    d_value = (double) std::clock() / (double)CLOCKS_PER_SEC;
+    d_value = wtime();
   }
 
   /// Log the function time.